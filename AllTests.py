@@ -228,6 +228,7 @@ gAllTests = [ TestCase('TestBuffer', [], True)
              ,TestCase('TestFifo', [], True)
              ,TestCase('TestQueue', [], True)
              ,TestCase('TestTextUtils', [], True)
+             ,TestCase('TestDeflate', [], True)
              ,TestCase('TestNetwork', [], True)
              #,TestCase('TestTimer', [])
              ,TestCase('TestSsdpMListen', ['-d', '10'], True)
@@ -242,6 +243,7 @@ gAllTests = [ TestCase('TestBuffer', [], True)
              ,TestCase('TestDviDiscovery', ['-l'], True)
              ,TestCase('TestDviDeviceList', ['-l'], True)
              ,TestCase('TestDvInvocation', ['-l'], True)
+             ,TestCase('TestDvInvocation', ['-l', '-t'], True)
              ,TestCase('TestDvSubscription', ['-l'], True)
              ,TestCase('TestDvDeviceStd', ['-l'], True)
              ,TestCase('TestDvDeviceC', [], True)
@@ -0,0 +1,14 @@
+#ifndef HEADER_OHNET_MIME_TYPES
+#define HEADER_OHNET_MIME_TYPES
+
+/* Common MIME types which may be useful for implementations of IResourceManager */
+extern const char kOhNetMimeTypeCss[];
+extern const char kOhNetMimeTypeHtml[];
+extern const char kOhNetMimeTypeJs[];
+extern const char kOhNetMimeTypeXml[];
+extern const char kOhNetMimeTypeBmp[];
+extern const char kOhNetMimeTypeGif[];
+extern const char kOhNetMimeTypeJpeg[];
+extern const char kOhNetMimeTypePng[];
+
+#endif // HEADER_OHNET_MIME_TYPES
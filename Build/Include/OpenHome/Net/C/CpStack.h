@@ -0,0 +1,16 @@
+#ifndef HEADER_OHNET_CONTROLPOINT_C
+#define HEADER_OHNET_CONTROLPOINT_C
+
+#include <OpenHome/OsTypes.h>
+#include <OpenHome/OhNetDefines.h>
+#include <OpenHome/MimeTypes.h>
+#include <OpenHome/Net/C/OhNet.h>
+#include <OpenHome/Net/C/Async.h>
+#include <OpenHome/Net/C/Service.h>
+#include <OpenHome/Net/C/CpService.h>
+#include <OpenHome/Net/C/CpDevice.h>
+#include <OpenHome/Net/C/CpDeviceDv.h>
+#include <OpenHome/Net/C/CpDeviceUpnp.h>
+#include <OpenHome/Net/C/CpProxy.h>
+
+#endif // HEADER_OHNET_CONTROLPOINT_C
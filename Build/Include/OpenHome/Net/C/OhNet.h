@@ -0,0 +1,922 @@
+#ifndef HEADER_UPNPC
+#define HEADER_UPNPC
+
+#include <OpenHome/OhNetDefines.h>
+#include <OpenHome/OsTypes.h>
+#include <OpenHome/Net/C/Async.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef THandle OhNetHandleNetworkAdapter;
+typedef THandle OhNetHandleNetworkAdapterList;
+typedef THandle OhNetHandleInitParams;
+
+/**
+ * Callback which runs when a library component has a message to deliver
+ * @ingroup Callbacks
+ *
+ * @param[in] aPtr   Client-specified data
+ * @param[in] aMsg   Nul-terminated message
+ */
+typedef void (STDCALL *OhNetCallbackMsg)(void* aPtr, const char* aMsg);
+/**
+ * Callback which runs to notify a listener of a change in a library component
+ * @ingroup Callbacks
+ *
+ * @param[in] aPtr   Client-specified data
+ */
+typedef void (STDCALL *OhNetCallback)(void* aPtr);
+/**
+ * Callback which runs when a network adapter is added or removed from a subnet list.
+ * @ingroup Callbacks
+ *
+ * @param[in] aPtr      Client-specified data
+ * @param[in] aAdapter  The network adapter that was added or removed.
+ */
+typedef void (STDCALL *OhNetCallbackNetworkAdapter)(void* aPtr, OhNetHandleNetworkAdapter aAdapter);
+/**
+ * Callback pointing to function which can be used to free memory allocated by a client
+ * @ingroup Callbacks
+ *
+ * @param[in] aPtr   Client-allocated memory to be freed
+ */
+typedef void (STDCALL *OhNetCallbackFreeExternal)(void* aPtr);
+
+/**
+ * @addtogroup Library
+ * @ingroup Core
+ * @{
+ */
+
+typedef enum EOhNetLibraryInitError
+{
+    eOhNetInitErrorNone
+   ,eOhNetInitErrorNoMemory
+   ,eOhNetInitErrorGeneral
+   ,eOhNetInitErrorNetworkAddressInUse
+} EOhNetLibraryInitError;
+
+/**
+ * Initialise the UPnP library.
+ *
+ * Must be called before any other library function.
+ *
+ * @param aInitParams  Initialisation options.  Ownership of these passes to the library.
+ *
+ * @return 0 if initialisation succeeded; non-zero otherwise
+ */
+DllExport int32_t STDCALL OhNetLibraryInitialise(OhNetHandleInitParams aInitParams);
+
+/**
+ * Lightweight alternative to UpnpLibraryInitialise.
+ *
+ * Intended for unit tests which are useful to platform porting only.
+ * No class APIs other than Close() can be called if this is used.
+ *
+ * @param aInitParams  Initialisation options.  Only ILogOutput will be used.
+ *                     Ownership of these passes to the library.
+ *
+ * @return 0 if initialisation succeeded; non-zero otherwise
+ */
+DllExport int32_t STDCALL OhNetLibraryInitialiseMinimal(OhNetHandleInitParams aInitParams);
+
+/**
+ * Start the library as a UPnP control point stack
+ *
+ * Must be called after OhNetLibraryInitialise but before any function from other headers
+ *
+ * @param aSubnet      Subnet address of the network adapter to use.
+ */
+DllExport EOhNetLibraryInitError STDCALL OhNetLibraryStartCp(TIpAddress aSubnet);
+
+/**
+ * Start the library as a UPnP device stack
+ *
+ * Must be called after OhNetLibraryInitialise but before any function from other headers
+ */
+DllExport EOhNetLibraryInitError STDCALL OhNetLibraryStartDv();
+
+/**
+ * Start the library as both UPnP control point and device stacks
+ *
+ * Must be called after OhNetLibraryInitialise but before any function from other headers
+ *
+ * @param aSubnet      Subnet address of the network adapter for the control point stack to use.
+ *                     (The device stack operates on all adapters.)
+ */
+DllExport EOhNetLibraryInitError STDCALL OhNetLibraryStartCombined(TIpAddress aSubnet);
+
+/**
+ * Close the UPnP library.
+ *
+ * Will not fail.  No more library functions should be called after this.
+ */
+DllExport void STDCALL OhNetLibraryClose();
+
+/* @} */
+/**
+ * @addtogroup InitParams
+ * @ingroup Core
+ * @{
+ */
+
+/**
+ * Create the initialisation parameters which must be passed to the library's initialiser
+ *
+ * @return  Handle to initialisation params object.
+ */
+DllExport OhNetHandleInitParams STDCALL OhNetInitParamsCreate();
+
+/**
+ * Destroy an object previously created by OhNetInitParamsCreate()
+ *
+ * @param[in] aParams          Initialisation params
+ */
+DllExport void STDCALL OhNetInitParamsDestroy(OhNetHandleInitParams aParams);
+
+/**
+ * Set a callback to run for any logging output
+ * Note that this can only be called before OhNetLibraryInitialise
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run when the library has
+ *                             data to be logged
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetLogOutput(OhNetHandleInitParams aParams, OhNetCallbackMsg aCallback, void* aPtr);
+
+/**
+ * Set a callback which will be run if the library encounters an error it
+ * cannot recover from.
+ *
+ * Suggested action if this is called is to exit the process and restart the
+ * library and its owning application. Note that the string passed to the callback
+ * is an error message so would be useful to log.
+ * Note that this can only be called before OhNetLibraryInitialise
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run if a fatal error occurs
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetFatalErrorHandler(OhNetHandleInitParams aParams, OhNetCallbackMsg aCallback, void* aPtr);
+
+/**
+ * Set a callback which will run at the start of every async opertion
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run at the start of every async opertion
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetAsyncBeginHandler(OhNetHandleInitParams aParams, OhNetCallbackAsync aCallback, void* aPtr);
+
+/**
+ * Set a callback which will run at the end of every async opertion
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run at the end of every async opertion
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetAsyncEndHandler(OhNetHandleInitParams aParams, OhNetCallbackAsync aCallback, void* aPtr);
+
+/**
+ * Set a callback which will run if an async opertion fails
+ * Note that The library supplies a default implementation which logs these errors.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run if an async opertion fails
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetAsyncErrorHandler(OhNetHandleInitParams aParams, OhNetCallbackAsync aCallback, void* aPtr);
+
+/**
+ * Set a listener for changes in the subnet being used
+ *
+ * This will run if the active subnet becomes unavailable or a seemingly more
+ * appropriate subnet becomes available.
+ * Note that this can only be called before OhNetLibraryInitialise
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run if the active subnet changes
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetSubnetListChangedListener(OhNetHandleInitParams aParams, OhNetCallback aCallback, void* aPtr);
+
+/**
+ * Set a listener for when subnets are added to a subnet list
+ *
+ * This will run if a subnet is added to the subnet list.
+ * Note that this can only be called before OhNetLibraryInitialise
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run if a subnet is added to the subnet list
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetSubnetAddedListener(OhNetHandleInitParams aParams, OhNetCallbackNetworkAdapter aCallback, void* aPtr);
+
+/**
+ * Set a listener for when subnets are removed from a subnet list
+ *
+ * This will run if the a subnet is removed from the subnet list.
+ * Note that this can only be called before OhNetLibraryInitialise
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run if a subnet is removed from the subnet list
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetSubnetRemovedListener(OhNetHandleInitParams aParams, OhNetCallbackNetworkAdapter aCallback, void* aPtr);
+
+/**
+ * Set a listener for changes in the adapter being used to access a subnet.
+ *
+ * This will run if the network adapter used to access any given subnet changes.
+ * Note that this can only be called before OhNetLibraryInitialise
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aCallback        Callback which will be run if the network adapter changes
+ * @param[in] aPtr             Data which will be passed to aCallback
+ */
+DllExport void STDCALL OhNetInitParamsSetNetworkAdapterChangedListener(OhNetHandleInitParams aParams, OhNetCallbackNetworkAdapter aCallback, void* aPtr);
+
+/**
+ * Set a custom timeout for TCP connections.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aTimeoutMs       Timeout in milliseconds.  Must be greater that zero
+ */
+DllExport void STDCALL OhNetInitParamsSetTcpConnectTimeout(OhNetHandleInitParams aParams, uint32_t aTimeoutMs);
+
+/**
+ * Set a custom time that msearch responses should be spread out over.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aSecs            Time in seconds.  Must be between 1 and 5 (inclusive)
+ */
+DllExport void STDCALL OhNetInitParamsSetMsearchTime(OhNetHandleInitParams aParams, uint32_t aSecs);
+
+/**
+ * Set a custom time-to-live value for msearches.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aTtl             Time to live
+ */
+DllExport void STDCALL OhNetInitParamsSetMsearchTtl(OhNetHandleInitParams aParams, uint32_t aTtl);
+
+/**
+ * Set a custom number of threads which will be dedicated to eventing (handling
+ * updates to subscribed state variables)
+ *
+ * A higher number of threads may allow faster processing  but will certainly
+ * require more system resources.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetNumEventSessionThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
+/**
+ * Set the number of threads which should be dedicated to fetching device/service XML.
+ *
+ * A higher number of threads will allow faster population of device lists but
+ * will also require more system resources.  At most two fetches run concurrently
+ * against any one host.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetNumXmlFetcherThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
+/**
+ * Set the number of threads which should be dedicated to invoking actions on devices.
+ *
+ * A higher number of threads will allow faster population of device lists
+ * but will also require more system resources.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetNumActionInvokerThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
+/**
+ * Set the maximum number of invocations which may be in progress on any one device.
+ *
+ * Further invocations for that device wait in a per-device queue; devices with
+ * queued invocations are served in turn so that one slow device cannot occupy
+ * every invoker thread.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aMaxInvocations  Maximum in progress per device.  Defaults to 0, meaning no limit.
+ */
+DllExport void STDCALL OhNetInitParamsSetMaxInvocationsPerDevice(OhNetHandleInitParams aParams, uint32_t aMaxInvocations);
+
+/**
+ * Set the number of invocations (actions) which should be pre-allocated.
+ *
+ * If more that this number are pending, the additional attempted invocations
+ * will block until a pre-allocated slot becomes clear.
+ * A higher number of invocations will decrease the likelihood and duration of
+ * any UI-level delays but will also increase the peaks in RAM requirements.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumInvocations  Number of invocations.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetNumInvocations(OhNetHandleInitParams aParams, uint32_t aNumInvocations);
+
+/**
+ * Set how long a control point waits for a device to respond to an invocation.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aTimeoutMs       Timeout in milliseconds.  Defaults to 60000.  Must be greater than zero
+ */
+DllExport void STDCALL OhNetInitParamsSetInvocationTimeout(OhNetHandleInitParams aParams, uint32_t aTimeoutMs);
+
+/**
+ * Set the number of threads which should be dedicated to (un)subscribing
+ * to state variables on a service + device.
+ *
+ * A higher number of threads may allow faster initialisation of some application
+ * views but will also require more system resources.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetNumSubscriberThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
+/**
+ * Set the number of threads which should be dedicated to running timer callbacks.
+ *
+ * Zero (the default) runs all callbacks on a single timer thread so a slow callback
+ * delays all later timers.  A higher number bounds timer latency under load but
+ * allows callbacks for different timers to run concurrently.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be less than 100.
+ */
+DllExport void STDCALL OhNetInitParamsSetNumTimerThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
+/**
+ * Set the duration control point subscriptions will request.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aDurationSecs    Duration in seconds.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetSubscriptionDuration(OhNetHandleInitParams aParams, uint32_t aDurationSecs);
+
+/**
+ * It is possible for initial information on state variables to arrive before
+ * a subscription is noted as complete.
+ * Set the maximim time to wait before rejecting an event update from an unknown source.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aTimeoutMs       Timeout in milliseconds.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetPendingSubscriptionTimeout(OhNetHandleInitParams aParams, uint32_t aTimeoutMs);
+
+/**
+ * Set a callback which will be used to free memory that is allocated outside the library
+ * This is intended for C# wrappers and can be ignored by most (all?) other clients
+ */
+DllExport void STDCALL OhNetInitParamsSetFreeExternalCallback(OhNetHandleInitParams aParams, OhNetCallbackFreeExternal aCallback);
+
+/**
+ * Limit the library to using only the loopback network interface.
+ * Useful for testing but not expected to be used in production code
+ */
+DllExport void STDCALL OhNetInitParamsSetUseLoopbackNetworkAdapter(OhNetHandleInitParams aParams);
+
+/**
+ * Set the maximum time between device announcements for the device stack
+ */
+DllExport void STDCALL OhNetInitParamsSetDvMaxUpdateTime(OhNetHandleInitParams aParams, uint32_t aSecs);
+
+/**
+ * Set the number of threads which should be dedicated to processing
+ * control/eventing/presentation requests.
+ *
+ * A higher number of threads may allow faster response to multiple clients
+ * making concurrent requests but will also require more system resources.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetDvNumServerThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
+/**
+ * Set the maximum number of connections each tcp server will hold open while
+ * waiting for a complete request.
+ *
+ * Server threads are only assigned to connections once a full request header has
+ * arrived so this can be much higher than the number of server/event session threads.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aMaxConnections  Maximum connections per server.  0 dedicates a server
+ *                             thread to each connection for its whole lifetime.
+ */
+DllExport void STDCALL OhNetInitParamsSetMaxParkedConnections(OhNetHandleInitParams aParams, uint32_t aMaxConnections);
+
+/**
+ * Set the number of threads which should be dedicated to publishing changes
+ * to state variables on a service + device.
+ *
+ * A higher number of threads may allow faster publication of changes (enabling more
+ * responsive client apps) views but will also require more system resources.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetDvNumPublisherThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
+/**
+ * Set the time to wait after a state variable changes before publishing it.
+ *
+ * Further changes made to a service during this window are sent to each subscriber in
+ * the same update.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aMs              Delay in milliseconds.  0 publishes each change as soon as
+ *                             a publisher thread is free.
+ */
+DllExport void STDCALL OhNetInitParamsSetDvPublisherCoalesceMs(OhNetHandleInitParams aParams, uint32_t aMs);
+
+/**
+ * Set whether the device stack should deliver UPnP events from a single reactor
+ * thread, which can have events to many subscribers in flight at once.
+ *
+ * Publisher threads then only prepare events and never wait on the network.
+ * Ignored on platforms with no reactor support.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aEnable          1 (the default value) to enable; 0 to disable
+ */
+DllExport void STDCALL OhNetInitParamsSetDvEnableEventReactor(OhNetHandleInitParams aParams, uint32_t aEnable);
+
+/**
+ * Set the number of threads which will be dedicated to published changes to state
+ * variables via WebSockets.
+ *
+ * One thread will be used per active (web browser) connection so a higher number of threads
+ * will allow more concurrent clients but will also require more system resources.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be greater than zero.
+ */
+DllExport void STDCALL OhNetInitParamsSetDvNumWebSocketThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
+/**
+ * Set the tcp port number the control point stack's UPnP event server will run on.
+ *
+ * The default value is 0 (meaning that the OS will assign a port).
+ * You should only set this if you know the full set of services (plus their port
+ * requirements) running on a device.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aPort            Port number.  0 (the default value) implies an OS-assigned port.
+ */ 
+DllExport void STDCALL OhNetInitParamsSetCpUpnpEventServerPort(OhNetHandleInitParams aParams, uint32_t aPort);
+
+/**
+ * Set whether the control point stack should run UPnP invocations on a single reactor
+ * thread, which can hold many in flight at once.
+ *
+ * Action invoker threads then only run invocation completed callbacks.
+ * Ignored on platforms with no reactor support.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aEnable          1 (the default value) to enable; 0 to disable
+ */
+DllExport void STDCALL OhNetInitParamsSetCpEnableInvocationReactor(OhNetHandleInitParams aParams, uint32_t aEnable);
+
+/**
+ * Set the tcp port number the device stack's UPnP web server will run on.
+ *
+ * The default value is 0 (OS-assigned).
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aPort            Port number.
+ */ 
+DllExport void STDCALL OhNetInitParamsSetDvUpnpServerPort(OhNetHandleInitParams aParams, uint32_t aPort);
+
+/**
+ * Set the tcp port number the device stack's websocket server will run on.
+ *
+ * You should only rely on this (or another non-zero value) if you know the full
+ * set of services (plus their port requirements) running on a device.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aPort            Port number.  0 (the default value) implies an OS-assigned port.
+ */
+DllExport void STDCALL OhNetInitParamsSetDvWebSocketPort(OhNetHandleInitParams aParams, uint32_t aPort);
+
+/**
+ * Enable use of Bonjour.
+ * All DvDevice instances with a resource manager will be published using Bonjour.
+ * If a device sets the "Upnp.MdnsHostName" attribute, its presentation will be available via http://[hostname].local.
+ * Behaviour when more than one DvDevice sets the "MdnsHostName" attribute is undefined.
+ * Note that enabling Bonjour will cause the device stack to run a http server on port 80, requiring root privileges on linux.
+ *
+ * @param[in] aParams          Initialisation params
+ */
+DllExport void STDCALL OhNetInitParamsSetDvEnableBonjour(OhNetHandleInitParams aParams);
+
+/**
+ * Query the tcp connection timeout
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  timeout (in milliseconds)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsTcpConnectTimeoutMs(OhNetHandleInitParams aParams);
+
+/**
+ * Query the time msearch responses are requested to be spread over
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  time (in seconds)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsMsearchTimeSecs(OhNetHandleInitParams aParams);
+
+/**
+ * Query the time to live value for multicast queries
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  ttl value
+ */
+DllExport uint32_t STDCALL OhNetInitParamsMsearchTtl(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of event session threads
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads
+ */
+DllExport uint32_t STDCALL OhNetInitParamsNumEventSessionThreads(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of XML fetcher threads
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads
+ */
+DllExport uint32_t STDCALL OhNetInitParamsNumXmlFetcherThreads(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of invocation threads
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads
+ */
+DllExport uint32_t STDCALL OhNetInitParamsNumActionInvokerThreads(OhNetHandleInitParams aParams);
+
+/**
+ * Query the maximum number of invocations which may be in progress on any one device
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  maximum invocations per device (zero for no limit)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsMaxInvocationsPerDevice(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of pre-allocated invocations
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of invocations
+ */
+DllExport uint32_t STDCALL OhNetInitParamsNumInvocations(OhNetHandleInitParams aParams);
+
+/**
+ * Query how long a control point waits for a device to respond to an invocation
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  timeout (in milliseconds)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsInvocationTimeoutMs(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of subscriber threads
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads
+ */
+DllExport uint32_t STDCALL OhNetInitParamsNumSubscriberThreads(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of threads dedicated to running timer callbacks
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads.  Zero means callbacks run on the single timer thread
+ */
+DllExport uint32_t STDCALL OhNetInitParamsNumTimerThreads(OhNetHandleInitParams aParams);
+
+/**
+ * Query the duration control points will request for subscriptions.
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  requested subscription duration (in seconds)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsSubscriptionDurationSecs(OhNetHandleInitParams aParams);
+
+/**
+ * Query the maximum delay allowed between initial values of state variables
+ * being delivered and a subscription identifier being provided
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  maximum delay (in milliseconds)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsPendingSubscriptionTimeoutMs(OhNetHandleInitParams aParams);
+
+/**
+ * Query the maximum delay between device announcements (for the device stack only)
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  maximum delay (in seconds)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvMaxUpdateTimeSecs(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of device stack server threads
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvNumServerThreads(OhNetHandleInitParams aParams);
+
+/**
+ * Query the maximum number of connections each tcp server will hold open while
+ * waiting for a complete request
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  maximum number of connections
+ */
+DllExport uint32_t STDCALL OhNetInitParamsMaxParkedConnections(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of device stack publisher threads
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvNumPublisherThreads(OhNetHandleInitParams aParams);
+
+/**
+ * Query the delay between a state variable changing and it being published
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  delay in milliseconds
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvPublisherCoalesceMs(OhNetHandleInitParams aParams);
+
+/**
+ * Query whether the device stack will deliver UPnP events from a reactor thread
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  1 if enabled; 0 otherwise
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvIsEventReactorEnabled(OhNetHandleInitParams aParams);
+
+/**
+ * Query the number of device stack WebSocket threads
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvNumWebSocketThreads(OhNetHandleInitParams aParams);
+
+/**
+ * Query the port the control point stack's UPnP event server will run on.
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  Port number.  May be 0 (meaning OS will assign a port later).
+ */
+DllExport uint32_t STDCALL OhNetInitParamsCpUpnpEventServerPort(OhNetHandleInitParams aParams);
+
+/**
+ * Query whether the control point stack will run UPnP invocations on a reactor thread
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  1 if enabled; 0 otherwise
+ */
+DllExport uint32_t STDCALL OhNetInitParamsCpIsInvocationReactorEnabled(OhNetHandleInitParams aParams);
+
+/**
+ * Query the port the device stack's UPnP web server will run on.
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  Port number.  May be 0 (meaning OS will assign a port later).
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvUpnpServerPort(OhNetHandleInitParams aParams);
+
+/**
+ * Query the port the device stack's WebSocket server will run on.
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  Port number.  May be 0 (meaning OS will assign a port later).
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvWebSocketPort(OhNetHandleInitParams aParams);
+
+/**
+ * Query whether Bonjour is enabled
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  1 if Bonjour is enabled; 0 otherwise
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvIsBonjourEnabled(OhNetHandleInitParams aParams);
+
+/* @} */
+
+/**
+ * @addtogroup NetworkAdapter
+ * @ingroup Core
+ * @{
+ */
+
+/**
+ * Query the address of a network interface
+ *
+ * @param[in] aNif             Network interface handle
+ *
+ * @return  IpV4 address as network order uint32
+ */
+DllExport TIpAddress STDCALL OhNetNetworkAdapterAddress(OhNetHandleNetworkAdapter aNif);
+
+/**
+ * Query the subnet of a network interface is available on
+ *
+ * @param[in] aNif             Network interface handle
+ *
+ * @return  IpV4 address as network order uint32
+ */
+DllExport TIpAddress STDCALL OhNetNetworkAdapterSubnet(OhNetHandleNetworkAdapter aNif);
+
+/**
+ * Query the name of a network interface
+ *
+ * @param[in] aNif             Network interface handle
+ *
+ * @return  IpV4 address as network order uint32
+ */
+DllExport const char* STDCALL OhNetNetworkAdapterName(OhNetHandleNetworkAdapter aNif);
+
+/**
+ * Get the full name of the network adapter.
+ *
+ * @return  String in the form a.b.c.d (name).
+ *          The caller is responsible for freeing this by calling OhNetFree().
+ */
+DllExport char* STDCALL OhNetNetworkAdapterFullName(OhNetHandleNetworkAdapter aNif);
+
+/**
+ * Claim a reference to a network adapter.
+ *
+ * NetworkAdapter passed to a subnet added listener cannot be used outside the callback
+ * unless the client claims a reference to it.
+ *
+ * @param[in]  aNif       NetworkAdapter originally returned to a subnet added callback.
+ * @param[in] aCookie     String identifying the caller.  Needn't be unique although a
+ *                        recognisable string will help in debugging the cause of any
+ *                        leaked NetworkAdapter references.  The later matching call
+ *                        to OhNetNetworkAdapterRemoveRef must use the same cookie.
+ */
+DllExport void STDCALL OhNetNetworkAdapterAddRef(OhNetHandleNetworkAdapter aNif, const char* aCookie);
+
+/**
+ * Release a reference to a network adapter.
+ *
+ * The network adapter will be destroyed when the last reference is released.
+ * Each call to OhNetNetworkAdapterAddRef() must be matched by exactly one call to
+ * OhNetNetworkAdapterRemoveRef().
+ *
+ * @param[in]  aNif       Network adapter to release the reference for.
+ * @param[in] aCookie     String identifying the caller.  Must match an earlier cookie
+ *                        used in either OhNetCurrentSubnetAdapter or OhNetNetworkAdapterAddRef.
+ */
+DllExport void STDCALL OhNetNetworkAdapterRemoveRef(OhNetHandleNetworkAdapter aNif, const char* aCookie);
+
+/**
+ * Create a list of all available subnets
+ *
+ * @return  Handle to list of subnets.  Ownership transfers to caller.
+ */
+DllExport OhNetHandleNetworkAdapterList STDCALL OhNetSubnetListCreate();
+
+/**
+ * Query the number of elements in a subnet list
+ *
+ * @param[in] aList            Handle returned by OhNetSubnetListCreate()
+ *
+ * @return  number of elements (subnets) in the list
+ */
+DllExport uint32_t STDCALL OhNetSubnetListSize(OhNetHandleNetworkAdapterList aList);
+
+/**
+ * Get a handle to the subnet at a specified position in a subnet list.
+ *
+ * @param[in] aList            Handle returned by OhNetSubnetListCreate()
+ * @param[in] aIndex           Index into the list to return the subnet from
+ *
+ * @return  subnet handle
+ */
+DllExport OhNetHandleNetworkAdapter STDCALL OhNetSubnetAt(OhNetHandleNetworkAdapterList aList, uint32_t aIndex);
+
+/**
+ * Destroy a subnet list
+ *
+ * @param[in] aList            Handle returned by OhNetSubnetListCreate()
+ */
+DllExport void STDCALL OhNetSubnetListDestroy(OhNetHandleNetworkAdapterList aList);
+
+/**
+ * Set which subnet the library should use.
+ *
+ * Device lists and subscriptions will be automatically updated.
+ * No other subnet will be selected if aSubnet is not available
+ *
+ * @param aSubnet              The subnet to use
+ */
+DllExport void STDCALL OhNetSetCurrentSubnet(uint32_t aSubnet);
+
+/**
+ * Query which network adapter is currently selected.
+ *
+ * @param[in] aCookie   String identifying the caller.  Needn't be unique although a
+ *                      recognisable string will help in debugging the cause of any
+ *                      leaked NetworkAdapter references.  The later matching call
+ *                      to RemoveRef must use the same cookie.
+ *
+ * @return  A pointer to the currently selected adapter with a reference claimed.
+ *          Or NULL if there is no currently selected adapter.
+ */
+DllExport OhNetHandleNetworkAdapter STDCALL OhNetCurrentSubnetAdapter(const char* aCookie);
+
+/* @} */
+
+/**
+ * @addtogroup Memory
+ * @ingroup Core
+ * @{
+ */
+
+/**
+ * Free memory returned by the library.
+ *
+ * Use of this function is optional.  Calling free() directly is acceptable.
+ *
+ * @param[in] aPtr             Pointer to be freed
+ */
+DllExport void STDCALL OhNetFree(void* aPtr);
+
+/**
+ * Free memory which was allocated by the client
+ *
+ * @param[in] aPtr             Memory to be freed
+ */
+DllExport void STDCALL OhNetFreeExternal(void* aPtr);
+
+/* @} */
+
+/**
+ * @addtogroup Debug
+ * @ingroup Core
+ * @{
+ */
+
+/**
+ * Enable debug logging.
+ *
+ * Log messages will be passed to the callback registered in OhNetInitParamsSetLogOutput.
+ *
+ * @param[in] aLevel           Bit(s) specifying debug level.  See OpenHome/Private/Debug.h.
+ */
+DllExport void STDCALL OhNetDebugSetLevel(uint32_t aLevel);
+
+/* @} */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // HEADER_UPNPC
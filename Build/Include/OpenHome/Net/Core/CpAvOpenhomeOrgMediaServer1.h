@@ -0,0 +1,644 @@
+#ifndef HEADER_AVOPENHOMEORGMEDIASERVER1
+#define HEADER_AVOPENHOMEORGMEDIASERVER1
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Exception.h>
+#include <OpenHome/Functor.h>
+#include <OpenHome/Net/Core/FunctorAsync.h>
+#include <OpenHome/Net/Core/CpProxy.h>
+
+namespace OpenHome {
+namespace Net {
+
+class CpDevice;
+class Action;
+class PropertyBinary;
+class PropertyBool;
+class PropertyInt;
+class PropertyString;
+class PropertyUint;
+
+/**
+ * Proxy for av.openhome.org:MediaServer:1
+ * @ingroup Proxies
+ */
+class CpProxyAvOpenhomeOrgMediaServer1 : public CpProxy
+{
+public:
+    /**
+     * Constructor.
+     *
+     * Use CpProxy::[Un]Subscribe() to enable/disable querying of state variable
+     * and reporting of their changes.
+     *
+     * @param[in]  aDevice   The device to use
+     */
+    CpProxyAvOpenhomeOrgMediaServer1(CpDevice& aDevice);
+    /**
+     * Destructor.
+     * If any asynchronous method is in progress, this will block until they complete.
+     * [Note that any methods still in progress are likely to complete with an error.]
+     * Clients who have called Subscribe() do not need to call Unsubscribe() before
+     * calling delete.  An unsubscribe will be triggered automatically when required.
+     */
+    ~CpProxyAvOpenhomeOrgMediaServer1();
+
+    /**
+     * Invoke the action synchronously.  Blocks until the action has been processed
+     * on the device and sets any output arguments.
+     *
+     * @param[out] aName
+     * @param[out] aInfo
+     * @param[out] aUrl
+     * @param[out] aImageUri
+     */
+    void SyncManufacturer(Brh& aName, Brh& aInfo, Brh& aUrl, Brh& aImageUri);
+    /**
+     * Invoke the action asynchronously.
+     * Returns immediately and will run the client-specified callback when the action
+     * later completes.  Any output arguments can then be retrieved by calling
+     * EndManufacturer().
+     *
+     * @param[in] aFunctor   Callback to run when the action completes.
+     *                       This is guaranteed to be run but may indicate an error
+     */
+    void BeginManufacturer(FunctorAsync& aFunctor);
+    /**
+     * Retrieve the output arguments from an asynchronously invoked action.
+     * This may only be called from the callback set in the above Begin function.
+     *
+     * @param[in]  aAsync  Argument passed to the callback set in the above Begin function
+     * @param[out] aName
+     * @param[out] aInfo
+     * @param[out] aUrl
+     * @param[out] aImageUri
+     */
+    void EndManufacturer(IAsync& aAsync, Brh& aName, Brh& aInfo, Brh& aUrl, Brh& aImageUri);
+
+    /**
+     * Invoke the action synchronously.  Blocks until the action has been processed
+     * on the device and sets any output arguments.
+     *
+     * @param[out] aName
+     * @param[out] aInfo
+     * @param[out] aUrl
+     * @param[out] aImageUri
+     */
+    void SyncModel(Brh& aName, Brh& aInfo, Brh& aUrl, Brh& aImageUri);
+    /**
+     * Invoke the action asynchronously.
+     * Returns immediately and will run the client-specified callback when the action
+     * later completes.  Any output arguments can then be retrieved by calling
+     * EndModel().
+     *
+     * @param[in] aFunctor   Callback to run when the action completes.
+     *                       This is guaranteed to be run but may indicate an error
+     */
+    void BeginModel(FunctorAsync& aFunctor);
+    /**
+     * Retrieve the output arguments from an asynchronously invoked action.
+     * This may only be called from the callback set in the above Begin function.
+     *
+     * @param[in]  aAsync  Argument passed to the callback set in the above Begin function
+     * @param[out] aName
+     * @param[out] aInfo
+     * @param[out] aUrl
+     * @param[out] aImageUri
+     */
+    void EndModel(IAsync& aAsync, Brh& aName, Brh& aInfo, Brh& aUrl, Brh& aImageUri);
+
+    /**
+     * Invoke the action synchronously.  Blocks until the action has been processed
+     * on the device and sets any output arguments.
+     *
+     * @param[out] aName
+     * @param[out] aInfo
+     * @param[out] aUrl
+     * @param[out] aImageUri
+     */
+    void SyncProduct(Brh& aName, Brh& aInfo, Brh& aUrl, Brh& aImageUri);
+    /**
+     * Invoke the action asynchronously.
+     * Returns immediately and will run the client-specified callback when the action
+     * later completes.  Any output arguments can then be retrieved by calling
+     * EndProduct().
+     *
+     * @param[in] aFunctor   Callback to run when the action completes.
+     *                       This is guaranteed to be run but may indicate an error
+     */
+    void BeginProduct(FunctorAsync& aFunctor);
+    /**
+     * Retrieve the output arguments from an asynchronously invoked action.
+     * This may only be called from the callback set in the above Begin function.
+     *
+     * @param[in]  aAsync  Argument passed to the callback set in the above Begin function
+     * @param[out] aName
+     * @param[out] aInfo
+     * @param[out] aUrl
+     * @param[out] aImageUri
+     */
+    void EndProduct(IAsync& aAsync, Brh& aName, Brh& aInfo, Brh& aUrl, Brh& aImageUri);
+
+    /**
+     * Invoke the action synchronously.  Blocks until the action has been processed
+     * on the device and sets any output arguments.
+     *
+     * @param[out] aValue
+     */
+    void SyncAttributes(Brh& aValue);
+    /**
+     * Invoke the action asynchronously.
+     * Returns immediately and will run the client-specified callback when the action
+     * later completes.  Any output arguments can then be retrieved by calling
+     * EndAttributes().
+     *
+     * @param[in] aFunctor   Callback to run when the action completes.
+     *                       This is guaranteed to be run but may indicate an error
+     */
+    void BeginAttributes(FunctorAsync& aFunctor);
+    /**
+     * Retrieve the output arguments from an asynchronously invoked action.
+     * This may only be called from the callback set in the above Begin function.
+     *
+     * @param[in]  aAsync  Argument passed to the callback set in the above Begin function
+     * @param[out] aValue
+     */
+    void EndAttributes(IAsync& aAsync, Brh& aValue);
+
+    /**
+     * Invoke the action synchronously.  Blocks until the action has been processed
+     * on the device and sets any output arguments.
+     *
+     * @param[out] aValue
+     */
+    void SyncQueryPort(TUint& aValue);
+    /**
+     * Invoke the action asynchronously.
+     * Returns immediately and will run the client-specified callback when the action
+     * later completes.  Any output arguments can then be retrieved by calling
+     * EndQueryPort().
+     *
+     * @param[in] aFunctor   Callback to run when the action completes.
+     *                       This is guaranteed to be run but may indicate an error
+     */
+    void BeginQueryPort(FunctorAsync& aFunctor);
+    /**
+     * Retrieve the output arguments from an asynchronously invoked action.
+     * This may only be called from the callback set in the above Begin function.
+     *
+     * @param[in]  aAsync  Argument passed to the callback set in the above Begin function
+     * @param[out] aValue
+     */
+    void EndQueryPort(IAsync& aAsync, TUint& aValue);
+
+    /**
+     * Invoke the action synchronously.  Blocks until the action has been processed
+     * on the device and sets any output arguments.
+     *
+     * @param[out] aValue
+     */
+    void SyncBrowsePort(TUint& aValue);
+    /**
+     * Invoke the action asynchronously.
+     * Returns immediately and will run the client-specified callback when the action
+     * later completes.  Any output arguments can then be retrieved by calling
+     * EndBrowsePort().
+     *
+     * @param[in] aFunctor   Callback to run when the action completes.
+     *                       This is guaranteed to be run but may indicate an error
+     */
+    void BeginBrowsePort(FunctorAsync& aFunctor);
+    /**
+     * Retrieve the output arguments from an asynchronously invoked action.
+     * This may only be called from the callback set in the above Begin function.
+     *
+     * @param[in]  aAsync  Argument passed to the callback set in the above Begin function
+     * @param[out] aValue
+     */
+    void EndBrowsePort(IAsync& aAsync, TUint& aValue);
+
+    /**
+     * Invoke the action synchronously.  Blocks until the action has been processed
+     * on the device and sets any output arguments.
+     *
+     * @param[out] aValue
+     */
+    void SyncUpdateCount(TUint& aValue);
+    /**
+     * Invoke the action asynchronously.
+     * Returns immediately and will run the client-specified callback when the action
+     * later completes.  Any output arguments can then be retrieved by calling
+     * EndUpdateCount().
+     *
+     * @param[in] aFunctor   Callback to run when the action completes.
+     *                       This is guaranteed to be run but may indicate an error
+     */
+    void BeginUpdateCount(FunctorAsync& aFunctor);
+    /**
+     * Retrieve the output arguments from an asynchronously invoked action.
+     * This may only be called from the callback set in the above Begin function.
+     *
+     * @param[in]  aAsync  Argument passed to the callback set in the above Begin function
+     * @param[out] aValue
+     */
+    void EndUpdateCount(IAsync& aAsync, TUint& aValue);
+
+    /**
+     * Invoke the action synchronously.  Blocks until the action has been processed
+     * on the device and sets any output arguments.
+     *
+     * @param[in]  aRequest
+     * @param[out] aResult
+     */
+    void SyncQuery(const Brx& aRequest, Brh& aResult);
+    /**
+     * Invoke the action asynchronously.
+     * Returns immediately and will run the client-specified callback when the action
+     * later completes.  Any output arguments can then be retrieved by calling
+     * EndQuery().
+     *
+     * @param[in] aRequest
+     * @param[in] aFunctor   Callback to run when the action completes.
+     *                       This is guaranteed to be run but may indicate an error
+     */
+    void BeginQuery(const Brx& aRequest, FunctorAsync& aFunctor);
+    /**
+     * Retrieve the output arguments from an asynchronously invoked action.
+     * This may only be called from the callback set in the above Begin function.
+     *
+     * @param[in]  aAsync  Argument passed to the callback set in the above Begin function
+     * @param[out] aResult
+     */
+    void EndQuery(IAsync& aAsync, Brh& aResult);
+
+    /**
+     * Set a callback to be run when the ManufacturerName state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyManufacturerNameChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ManufacturerInfo state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyManufacturerInfoChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ManufacturerUrl state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyManufacturerUrlChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ManufacturerImageUri state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyManufacturerImageUriChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ModelName state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyModelNameChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ModelInfo state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyModelInfoChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ModelUrl state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyModelUrlChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ModelImageUri state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyModelImageUriChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ProductName state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyProductNameChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ProductInfo state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyProductInfoChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ProductUrl state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyProductUrlChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the ProductImageUri state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyProductImageUriChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the Attributes state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyAttributesChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the QueryPort state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyQueryPortChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the BrowsePort state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyBrowsePortChanged(Functor& aFunctor);
+    /**
+     * Set a callback to be run when the UpdateCount state variable changes.
+     *
+     * Callbacks may be run in different threads but callbacks for a
+     * CpProxyAvOpenhomeOrgMediaServer1 instance will not overlap.
+     *
+     * @param[in]  aFunctor  The callback to run when the state variable changes
+     */
+    void SetPropertyUpdateCountChanged(Functor& aFunctor);
+
+    /**
+     * Query the value of the ManufacturerName property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aManufacturerName
+     */
+    void PropertyManufacturerName(Brhz& aManufacturerName) const;
+    /**
+     * Query the value of the ManufacturerInfo property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aManufacturerInfo
+     */
+    void PropertyManufacturerInfo(Brhz& aManufacturerInfo) const;
+    /**
+     * Query the value of the ManufacturerUrl property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aManufacturerUrl
+     */
+    void PropertyManufacturerUrl(Brhz& aManufacturerUrl) const;
+    /**
+     * Query the value of the ManufacturerImageUri property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aManufacturerImageUri
+     */
+    void PropertyManufacturerImageUri(Brhz& aManufacturerImageUri) const;
+    /**
+     * Query the value of the ModelName property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aModelName
+     */
+    void PropertyModelName(Brhz& aModelName) const;
+    /**
+     * Query the value of the ModelInfo property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aModelInfo
+     */
+    void PropertyModelInfo(Brhz& aModelInfo) const;
+    /**
+     * Query the value of the ModelUrl property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aModelUrl
+     */
+    void PropertyModelUrl(Brhz& aModelUrl) const;
+    /**
+     * Query the value of the ModelImageUri property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aModelImageUri
+     */
+    void PropertyModelImageUri(Brhz& aModelImageUri) const;
+    /**
+     * Query the value of the ProductName property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aProductName
+     */
+    void PropertyProductName(Brhz& aProductName) const;
+    /**
+     * Query the value of the ProductInfo property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aProductInfo
+     */
+    void PropertyProductInfo(Brhz& aProductInfo) const;
+    /**
+     * Query the value of the ProductUrl property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aProductUrl
+     */
+    void PropertyProductUrl(Brhz& aProductUrl) const;
+    /**
+     * Query the value of the ProductImageUri property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aProductImageUri
+     */
+    void PropertyProductImageUri(Brhz& aProductImageUri) const;
+    /**
+     * Query the value of the Attributes property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aAttributes
+     */
+    void PropertyAttributes(Brhz& aAttributes) const;
+    /**
+     * Query the value of the QueryPort property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aQueryPort
+     */
+    void PropertyQueryPort(TUint& aQueryPort) const;
+    /**
+     * Query the value of the BrowsePort property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aBrowsePort
+     */
+    void PropertyBrowsePort(TUint& aBrowsePort) const;
+    /**
+     * Query the value of the UpdateCount property.
+     *
+     * This function is threadsafe and can only be called if Subscribe() has been
+     * called and a first eventing callback received more recently than any call
+     * to Unsubscribe().
+     *
+     * @param[out] aUpdateCount
+     */
+    void PropertyUpdateCount(TUint& aUpdateCount) const;
+private:
+    void ManufacturerNamePropertyChanged();
+    void ManufacturerInfoPropertyChanged();
+    void ManufacturerUrlPropertyChanged();
+    void ManufacturerImageUriPropertyChanged();
+    void ModelNamePropertyChanged();
+    void ModelInfoPropertyChanged();
+    void ModelUrlPropertyChanged();
+    void ModelImageUriPropertyChanged();
+    void ProductNamePropertyChanged();
+    void ProductInfoPropertyChanged();
+    void ProductUrlPropertyChanged();
+    void ProductImageUriPropertyChanged();
+    void AttributesPropertyChanged();
+    void QueryPortPropertyChanged();
+    void BrowsePortPropertyChanged();
+    void UpdateCountPropertyChanged();
+private:
+    Action* iActionManufacturer;
+    Action* iActionModel;
+    Action* iActionProduct;
+    Action* iActionAttributes;
+    Action* iActionQueryPort;
+    Action* iActionBrowsePort;
+    Action* iActionUpdateCount;
+    Action* iActionQuery;
+    PropertyString* iManufacturerName;
+    PropertyString* iManufacturerInfo;
+    PropertyString* iManufacturerUrl;
+    PropertyString* iManufacturerImageUri;
+    PropertyString* iModelName;
+    PropertyString* iModelInfo;
+    PropertyString* iModelUrl;
+    PropertyString* iModelImageUri;
+    PropertyString* iProductName;
+    PropertyString* iProductInfo;
+    PropertyString* iProductUrl;
+    PropertyString* iProductImageUri;
+    PropertyString* iAttributes;
+    PropertyUint* iQueryPort;
+    PropertyUint* iBrowsePort;
+    PropertyUint* iUpdateCount;
+    Functor iManufacturerNameChanged;
+    Functor iManufacturerInfoChanged;
+    Functor iManufacturerUrlChanged;
+    Functor iManufacturerImageUriChanged;
+    Functor iModelNameChanged;
+    Functor iModelInfoChanged;
+    Functor iModelUrlChanged;
+    Functor iModelImageUriChanged;
+    Functor iProductNameChanged;
+    Functor iProductInfoChanged;
+    Functor iProductUrlChanged;
+    Functor iProductImageUriChanged;
+    Functor iAttributesChanged;
+    Functor iQueryPortChanged;
+    Functor iBrowsePortChanged;
+    Functor iUpdateCountChanged;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+#endif // HEADER_AVOPENHOMEORGMEDIASERVER1
+
@@ -0,0 +1,425 @@
+#ifndef HEADER_DVAVOPENHOMEORGRADIO1
+#define HEADER_DVAVOPENHOMEORGRADIO1
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Net/Core/DvDevice.h>
+#include <OpenHome/Net/Core/DvProvider.h>
+
+namespace OpenHome {
+namespace Net {
+
+class DviDevice;
+class IDviInvocation;
+class PropertyInt;
+class PropertyUint;
+class PropertyBool;
+class PropertyString;
+class PropertyBinary;
+
+/**
+ * Provider for the av.openhome.org:Radio:1 UPnP service
+ * @ingroup Providers
+ */
+class DvProviderAvOpenhomeOrgRadio1 : public DvProvider
+{
+public:
+    virtual ~DvProviderAvOpenhomeOrgRadio1() {}
+    /**
+     * Set the value of the Uri property
+     *
+     * Can only be called if EnablePropertyUri has previously been called.
+     *
+     * @return  true if the value has been updated; false if aValue was the same as the previous value
+     */
+    TBool SetPropertyUri(const Brx& aValue);
+    /**
+     * Get a copy of the value of the Uri property
+     *
+     * Can only be called if EnablePropertyUri has previously been called.
+     */
+    void GetPropertyUri(Brhz& aValue);
+    /**
+     * Set the value of the Metadata property
+     *
+     * Can only be called if EnablePropertyMetadata has previously been called.
+     *
+     * @return  true if the value has been updated; false if aValue was the same as the previous value
+     */
+    TBool SetPropertyMetadata(const Brx& aValue);
+    /**
+     * Get a copy of the value of the Metadata property
+     *
+     * Can only be called if EnablePropertyMetadata has previously been called.
+     */
+    void GetPropertyMetadata(Brhz& aValue);
+    /**
+     * Set the value of the TransportState property
+     *
+     * Can only be called if EnablePropertyTransportState has previously been called.
+     *
+     * @return  true if the value has been updated; false if aValue was the same as the previous value
+     */
+    TBool SetPropertyTransportState(const Brx& aValue);
+    /**
+     * Get a copy of the value of the TransportState property
+     *
+     * Can only be called if EnablePropertyTransportState has previously been called.
+     */
+    void GetPropertyTransportState(Brhz& aValue);
+    /**
+     * Set the value of the Id property
+     *
+     * Can only be called if EnablePropertyId has previously been called.
+     *
+     * @return  true if the value has been updated; false if aValue was the same as the previous value
+     */
+    TBool SetPropertyId(TUint aValue);
+    /**
+     * Get a copy of the value of the Id property
+     *
+     * Can only be called if EnablePropertyId has previously been called.
+     */
+    void GetPropertyId(TUint& aValue);
+    /**
+     * Set the value of the IdArray property
+     *
+     * Can only be called if EnablePropertyIdArray has previously been called.
+     *
+     * @return  true if the value has been updated; false if aValue was the same as the previous value
+     */
+    TBool SetPropertyIdArray(const Brx& aValue);
+    /**
+     * Get a copy of the value of the IdArray property
+     *
+     * Can only be called if EnablePropertyIdArray has previously been called.
+     */
+    void GetPropertyIdArray(Brh& aValue);
+    /**
+     * Set the value of the ChannelsMax property
+     *
+     * Can only be called if EnablePropertyChannelsMax has previously been called.
+     *
+     * @return  true if the value has been updated; false if aValue was the same as the previous value
+     */
+    TBool SetPropertyChannelsMax(TUint aValue);
+    /**
+     * Get a copy of the value of the ChannelsMax property
+     *
+     * Can only be called if EnablePropertyChannelsMax has previously been called.
+     */
+    void GetPropertyChannelsMax(TUint& aValue);
+    /**
+     * Set the value of the ProtocolInfo property
+     *
+     * Can only be called if EnablePropertyProtocolInfo has previously been called.
+     *
+     * @return  true if the value has been updated; false if aValue was the same as the previous value
+     */
+    TBool SetPropertyProtocolInfo(const Brx& aValue);
+    /**
+     * Get a copy of the value of the ProtocolInfo property
+     *
+     * Can only be called if EnablePropertyProtocolInfo has previously been called.
+     */
+    void GetPropertyProtocolInfo(Brhz& aValue);
+protected:
+    /**
+     * Constructor
+     *
+     * @param[in] aDevice  Device which owns this provider
+     */
+    DvProviderAvOpenhomeOrgRadio1(DvDevice& aDevice);
+    /**
+     * Constructor.  Not for external use.
+     *
+     * @param[in] aDevice  Device which owns this provider
+     */
+    DvProviderAvOpenhomeOrgRadio1(DviDevice& aDevice);
+    /**
+     * Enable the Uri property.
+     */
+    void EnablePropertyUri();
+    /**
+     * Enable the Metadata property.
+     */
+    void EnablePropertyMetadata();
+    /**
+     * Enable the TransportState property.
+     */
+    void EnablePropertyTransportState();
+    /**
+     * Enable the Id property.
+     */
+    void EnablePropertyId();
+    /**
+     * Enable the IdArray property.
+     */
+    void EnablePropertyIdArray();
+    /**
+     * Enable the ChannelsMax property.
+     */
+    void EnablePropertyChannelsMax();
+    /**
+     * Enable the ProtocolInfo property.
+     */
+    void EnablePropertyProtocolInfo();
+    /**
+     * Signal that the action Play is supported.
+     * The action's availability will be published in the device's service.xml.
+     * Play must be overridden if this is called.
+     */
+    void EnableActionPlay();
+    /**
+     * Signal that the action Pause is supported.
+     * The action's availability will be published in the device's service.xml.
+     * Pause must be overridden if this is called.
+     */
+    void EnableActionPause();
+    /**
+     * Signal that the action Stop is supported.
+     * The action's availability will be published in the device's service.xml.
+     * Stop must be overridden if this is called.
+     */
+    void EnableActionStop();
+    /**
+     * Signal that the action SeekSecondAbsolute is supported.
+     * The action's availability will be published in the device's service.xml.
+     * SeekSecondAbsolute must be overridden if this is called.
+     */
+    void EnableActionSeekSecondAbsolute();
+    /**
+     * Signal that the action SeekSecondRelative is supported.
+     * The action's availability will be published in the device's service.xml.
+     * SeekSecondRelative must be overridden if this is called.
+     */
+    void EnableActionSeekSecondRelative();
+    /**
+     * Signal that the action Channel is supported.
+     * The action's availability will be published in the device's service.xml.
+     * Channel must be overridden if this is called.
+     */
+    void EnableActionChannel();
+    /**
+     * Signal that the action SetChannel is supported.
+     * The action's availability will be published in the device's service.xml.
+     * SetChannel must be overridden if this is called.
+     */
+    void EnableActionSetChannel();
+    /**
+     * Signal that the action TransportState is supported.
+     * The action's availability will be published in the device's service.xml.
+     * TransportState must be overridden if this is called.
+     */
+    void EnableActionTransportState();
+    /**
+     * Signal that the action Id is supported.
+     * The action's availability will be published in the device's service.xml.
+     * Id must be overridden if this is called.
+     */
+    void EnableActionId();
+    /**
+     * Signal that the action SetId is supported.
+     * The action's availability will be published in the device's service.xml.
+     * SetId must be overridden if this is called.
+     */
+    void EnableActionSetId();
+    /**
+     * Signal that the action Read is supported.
+     * The action's availability will be published in the device's service.xml.
+     * Read must be overridden if this is called.
+     */
+    void EnableActionRead();
+    /**
+     * Signal that the action ReadList is supported.
+     * The action's availability will be published in the device's service.xml.
+     * ReadList must be overridden if this is called.
+     */
+    void EnableActionReadList();
+    /**
+     * Signal that the action IdArray is supported.
+     * The action's availability will be published in the device's service.xml.
+     * IdArray must be overridden if this is called.
+     */
+    void EnableActionIdArray();
+    /**
+     * Signal that the action IdArrayChanged is supported.
+     * The action's availability will be published in the device's service.xml.
+     * IdArrayChanged must be overridden if this is called.
+     */
+    void EnableActionIdArrayChanged();
+    /**
+     * Signal that the action ChannelsMax is supported.
+     * The action's availability will be published in the device's service.xml.
+     * ChannelsMax must be overridden if this is called.
+     */
+    void EnableActionChannelsMax();
+    /**
+     * Signal that the action ProtocolInfo is supported.
+     * The action's availability will be published in the device's service.xml.
+     * ProtocolInfo must be overridden if this is called.
+     */
+    void EnableActionProtocolInfo();
+private:
+    /**
+     * Play action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * Play action for the owning device.
+     * Must be implemented iff EnableActionPlay was called.
+     */
+    virtual void Play(IDvInvocation& aInvocation);
+    /**
+     * Pause action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * Pause action for the owning device.
+     * Must be implemented iff EnableActionPause was called.
+     */
+    virtual void Pause(IDvInvocation& aInvocation);
+    /**
+     * Stop action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * Stop action for the owning device.
+     * Must be implemented iff EnableActionStop was called.
+     */
+    virtual void Stop(IDvInvocation& aInvocation);
+    /**
+     * SeekSecondAbsolute action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * SeekSecondAbsolute action for the owning device.
+     * Must be implemented iff EnableActionSeekSecondAbsolute was called.
+     */
+    virtual void SeekSecondAbsolute(IDvInvocation& aInvocation, TUint aValue);
+    /**
+     * SeekSecondRelative action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * SeekSecondRelative action for the owning device.
+     * Must be implemented iff EnableActionSeekSecondRelative was called.
+     */
+    virtual void SeekSecondRelative(IDvInvocation& aInvocation, TInt aValue);
+    /**
+     * Channel action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * Channel action for the owning device.
+     * Must be implemented iff EnableActionChannel was called.
+     */
+    virtual void Channel(IDvInvocation& aInvocation, IDvInvocationResponseString& aUri, IDvInvocationResponseString& aMetadata);
+    /**
+     * SetChannel action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * SetChannel action for the owning device.
+     * Must be implemented iff EnableActionSetChannel was called.
+     */
+    virtual void SetChannel(IDvInvocation& aInvocation, const Brx& aUri, const Brx& aMetadata);
+    /**
+     * TransportState action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * TransportState action for the owning device.
+     * Must be implemented iff EnableActionTransportState was called.
+     */
+    virtual void TransportState(IDvInvocation& aInvocation, IDvInvocationResponseString& aValue);
+    /**
+     * Id action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * Id action for the owning device.
+     * Must be implemented iff EnableActionId was called.
+     */
+    virtual void Id(IDvInvocation& aInvocation, IDvInvocationResponseUint& aValue);
+    /**
+     * SetId action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * SetId action for the owning device.
+     * Must be implemented iff EnableActionSetId was called.
+     */
+    virtual void SetId(IDvInvocation& aInvocation, TUint aValue, const Brx& aUri);
+    /**
+     * Read action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * Read action for the owning device.
+     * Must be implemented iff EnableActionRead was called.
+     */
+    virtual void Read(IDvInvocation& aInvocation, TUint aId, IDvInvocationResponseString& aMetadata);
+    /**
+     * ReadList action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * ReadList action for the owning device.
+     * Must be implemented iff EnableActionReadList was called.
+     */
+    virtual void ReadList(IDvInvocation& aInvocation, const Brx& aIdList, IDvInvocationResponseString& aChannelList);
+    /**
+     * IdArray action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * IdArray action for the owning device.
+     * Must be implemented iff EnableActionIdArray was called.
+     */
+    virtual void IdArray(IDvInvocation& aInvocation, IDvInvocationResponseUint& aToken, IDvInvocationResponseBinary& aArray);
+    /**
+     * IdArrayChanged action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * IdArrayChanged action for the owning device.
+     * Must be implemented iff EnableActionIdArrayChanged was called.
+     */
+    virtual void IdArrayChanged(IDvInvocation& aInvocation, TUint aToken, IDvInvocationResponseBool& aValue);
+    /**
+     * ChannelsMax action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * ChannelsMax action for the owning device.
+     * Must be implemented iff EnableActionChannelsMax was called.
+     */
+    virtual void ChannelsMax(IDvInvocation& aInvocation, IDvInvocationResponseUint& aValue);
+    /**
+     * ProtocolInfo action.
+     *
+     * Will be called when the device stack receives an invocation of the
+     * ProtocolInfo action for the owning device.
+     * Must be implemented iff EnableActionProtocolInfo was called.
+     */
+    virtual void ProtocolInfo(IDvInvocation& aInvocation, IDvInvocationResponseString& aValue);
+private:
+    DvProviderAvOpenhomeOrgRadio1();
+    void Construct();
+    void DoPlay(IDviInvocation& aInvocation);
+    void DoPause(IDviInvocation& aInvocation);
+    void DoStop(IDviInvocation& aInvocation);
+    void DoSeekSecondAbsolute(IDviInvocation& aInvocation);
+    void DoSeekSecondRelative(IDviInvocation& aInvocation);
+    void DoChannel(IDviInvocation& aInvocation);
+    void DoSetChannel(IDviInvocation& aInvocation);
+    void DoTransportState(IDviInvocation& aInvocation);
+    void DoId(IDviInvocation& aInvocation);
+    void DoSetId(IDviInvocation& aInvocation);
+    void DoRead(IDviInvocation& aInvocation);
+    void DoReadList(IDviInvocation& aInvocation);
+    void DoIdArray(IDviInvocation& aInvocation);
+    void DoIdArrayChanged(IDviInvocation& aInvocation);
+    void DoChannelsMax(IDviInvocation& aInvocation);
+    void DoProtocolInfo(IDviInvocation& aInvocation);
+private:
+    PropertyString* iPropertyUri;
+    PropertyString* iPropertyMetadata;
+    PropertyString* iPropertyTransportState;
+    PropertyUint* iPropertyId;
+    PropertyBinary* iPropertyIdArray;
+    PropertyUint* iPropertyChannelsMax;
+    PropertyString* iPropertyProtocolInfo;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+#endif // HEADER_DVAVOPENHOMEORGRADIO1
+
@@ -0,0 +1,20 @@
+#ifndef HEADER_OHNET_CONTROLPOINT_CPP
+#define HEADER_OHNET_CONTROLPOINT_CPP
+
+#include <OpenHome/OsTypes.h>
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/OhNetDefines.h>
+#include <OpenHome/MimeTypes.h>
+#include <OpenHome/Functor.h>
+#include <OpenHome/Exception.h>
+#include <OpenHome/FunctorMsg.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Net/Core/OhNet.h>
+#include <OpenHome/Net/Core/FunctorAsync.h>
+#include <OpenHome/Net/Core/CpProxy.h>
+#include <OpenHome/Net/Core/CpDevice.h>
+#include <OpenHome/Net/Core/CpDeviceDv.h>
+#include <OpenHome/Net/Core/CpDeviceUpnp.h>
+#include <OpenHome/Net/Core/FunctorCpDevice.h>
+
+#endif // HEADER_OHNET_CONTROLPOINT_CPP
@@ -0,0 +1,18 @@
+#ifndef HEADER_OHNET_DEVICE_CPP
+#define HEADER_OHNET_DEVICE_CPP
+
+#include <OpenHome/OsTypes.h>
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/OhNetDefines.h>
+#include <OpenHome/MimeTypes.h>
+#include <OpenHome/Functor.h>
+#include <OpenHome/Exception.h>
+#include <OpenHome/FunctorMsg.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Net/Core/OhNet.h>
+#include <OpenHome/Net/Core/DvProvider.h>
+#include <OpenHome/Net/Core/DvResourceWriter.h>
+#include <OpenHome/Net/Core/DvServerUpnp.h>
+#include <OpenHome/Net/Core/DvDevice.h>
+
+#endif // HEADER_OHNET_DEVICE_CPP
@@ -0,0 +1,50 @@
+/**
+ * UPnP library internal APIs
+ *
+ * NOT intended for use by clients of the library
+ */
+
+#ifndef HEADER_CPI_STACK
+#define HEADER_CPI_STACK
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Net/Private/Stack.h>
+#include <OpenHome/Net/Private/CpiService.h>
+#include <OpenHome/Net/Private/XmlFetcher.h>
+#include <OpenHome/Net/Private/CpiSubscription.h>
+#include <OpenHome/Net/Private/CpiDevice.h>
+
+#include <vector>
+
+namespace OpenHome {
+namespace Net {
+
+class InvocationReactorUpnp;
+
+class CpiStack : public IStack
+{
+public:
+    CpiStack();
+    static OpenHome::Net::InvocationManager& InvocationManager();
+    /**
+     * Returns NULL if invocations should each be run on an Invoker thread instead
+     */
+    static InvocationReactorUpnp* InvocationReactor();
+    static OpenHome::Net::XmlFetchManager& XmlFetchManager();
+    static CpiSubscriptionManager& SubscriptionManager();
+    static CpiDeviceListUpdater& DeviceListUpdater();
+private:
+    ~CpiStack();
+    static CpiStack* Self();
+private:
+    OpenHome::Net::InvocationManager* iInvocationManager;
+    InvocationReactorUpnp* iInvocationReactor;
+    OpenHome::Net::XmlFetchManager* iXmlFetchManager;
+    CpiSubscriptionManager* iSubscriptionManager;
+    CpiDeviceListUpdater* iDeviceListUpdater;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+#endif // HEADER_CPI_STACK
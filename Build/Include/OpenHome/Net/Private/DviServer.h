@@ -0,0 +1,50 @@
+#ifndef HEADER_DVI_SERVER
+#define HEADER_DVI_SERVER
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Private/Network.h>
+#include <OpenHome/Net/Core/OhNet.h>
+#include <OpenHome/Private/Thread.h>
+
+#include <vector>
+
+namespace OpenHome {
+namespace Net {
+
+class DviServer
+{
+public:
+    ~DviServer();
+    TUint Port(TIpAddress aInterface);
+protected:
+    DviServer();
+    void Initialise();
+    virtual SocketTcpServer* CreateServer(const NetworkAdapter& aNif) = 0;
+private:
+    void AddServer(NetworkAdapter& aNif);
+    void SubnetListChanged();
+    TInt FindInterface(TIpAddress aInterface, const std::vector<NetworkAdapter*>& aNifList);
+    TInt FindServer(TIpAddress aSubnet);
+private:
+    class Server : private INonCopyable
+    {
+    public:
+        Server(SocketTcpServer* aTcpServer, NetworkAdapter& aNif);
+        ~Server();
+        TIpAddress Interface() const { return iNif.Address(); }
+        TIpAddress Subnet() const { return iNif.Subnet(); }
+        TUint Port() const { return iServer->Port(); }
+    private:
+        SocketTcpServer* iServer;
+        NetworkAdapter& iNif;
+    };
+private:
+    Mutex iLock;
+    std::vector<DviServer::Server*> iServers;
+    TInt iSubnetListChangeListenerId;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+#endif // HEADER_DVI_SERVER
@@ -0,0 +1,418 @@
+#ifndef HEADER_DVI_SERVER_UPNP
+#define HEADER_DVI_SERVER_UPNP
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Private/Network.h>
+#include <OpenHome/Private/Http.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Net/Private/DviDevice.h>
+#include <OpenHome/Private/Stream.h>
+#include <OpenHome/Net/Private/DviService.h>
+#include <OpenHome/Net/Private/Subscription.h>
+#include <OpenHome/Net/Private/Service.h>
+#include <OpenHome/Net/Private/DviServer.h>
+#include <OpenHome/Net/Private/DviSubscription.h>
+#include <OpenHome/Net/Private/XmlParser.h>
+#include <OpenHome/Net/Private/ReactorHttp.h>
+
+#include <vector>
+#include <map>
+#include <list>
+
+namespace OpenHome {
+namespace Net {
+
+class IRedirector
+{
+public:
+    virtual TBool RedirectUri(const Brx& aUri, Brn& aRedirectTo) = 0;
+};
+    
+class HeaderSoapAction : public HttpHeader
+{
+public:
+    const Brx& Domain() const;
+    const Brx& Type() const;
+    TUint Version() const;
+    const Brx& Action() const;
+private:
+    TBool Recognise(const Brx& aHeader);
+    void Process(const Brx& aValue);
+private:
+    Bwh iDomain;
+    Brh iType;
+    TUint iVersion;
+    Brh iAction;
+};
+
+class HeaderCallback : public HttpHeader
+{
+public:
+    const OpenHome::Endpoint& Endpoint() const;
+    const Brx& Uri() const;
+    void Log();
+private:
+    TBool Recognise(const Brx& aHeader);
+    void Process(const Brx& aValue);
+private:
+    OpenHome::Endpoint iEndpoint;
+    Bwh iUri;
+};
+
+class HeaderAcceptLanguage : public HttpHeader
+{
+public:
+    ~HeaderAcceptLanguage();
+    const Brx& LanguageString() const;
+    std::vector<char*>& LanguageList();
+private:
+    TBool Recognise(const Brx& aHeader);
+    void Process(const Brx& aValue);
+private:
+    struct PrioritisedLanguage
+    {
+        char* iLanguage;
+        TUint iPriority;
+    };
+private:
+    void ClearLanguageList();
+    TUint ParseQualityValue(const Brx& aBuf);
+    void AddPrioritisedLanguage(std::vector<PrioritisedLanguage>& aList, PrioritisedLanguage& aLanguage);
+private:
+    static const TUint kMaxQuality = 1000;
+    static const TUint kMinQuality = 0;
+    static const TUint kMaxQualityChars = 5; // HTTP spec says quality scores have max 3 dec places
+    Brh iLanguages;
+    std::vector<char*> iLanguageList;
+};
+
+class SubscriptionDataUpnp : public IDviSubscriptionUserData
+{
+public:
+    SubscriptionDataUpnp(const Endpoint& aSubscriber, const Brx& aSubscriberPath);
+    const Endpoint& Subscriber() const;
+    const Brx& SubscriberPath() const;
+    virtual const void* Data() const;
+    virtual void Release();
+private:
+    ~SubscriptionDataUpnp() {}
+private:
+    Endpoint iSubscriber;
+    Brh iSubscriberPath;
+};
+
+/**
+ * Socket to a subscriber's event server.
+ *
+ * Kept open between NOTIFYs if the subscriber supports http keep-alive.
+ */
+class EventConnectionUpnp : private INonCopyable
+{
+    friend class PropertyWriterUpnp;
+    friend class PropertyWriterPoolUpnp;
+    friend class EventDispatcherUpnp;
+public:
+    static const TUint kMaxResponseBytes = 128;
+private:
+    EventConnectionUpnp(const Endpoint& aSubscriber);
+    ~EventConnectionUpnp();
+private:
+    Endpoint iSubscriber;
+    SocketTcpClient iSocket;
+    SocketTcpReader iReader;
+    Srs<kMaxResponseBytes> iReadBuffer;
+    TUint iIdleSinceMs;
+};
+
+/**
+ * Idle connections to subscribers plus buffers for event bodies, shared by all
+ * PropertyWriterUpnp instances so that NOTIFYs don't each connect and allocate afresh.
+ *
+ * Connections which have been idle for kIdleTimeoutMs are closed rather than reused.
+ */
+class PropertyWriterPoolUpnp : private INonCopyable
+{
+public:
+    PropertyWriterPoolUpnp();
+    ~PropertyWriterPoolUpnp();
+    /**
+     * Returns an idle connection to aSubscriber if one is available, otherwise connects a new one.
+     * aReused is set to indicate which.  Ownership passes to the caller until ReleaseConnection() is called.
+     */
+    EventConnectionUpnp* ClaimConnection(const Endpoint& aSubscriber, TBool& aReused);
+    /**
+     * Returns an idle connection to aSubscriber if one is available, otherwise a new
+     * unconnected one.  Never blocks.  aReused is set to indicate which.
+     */
+    EventConnectionUpnp* ClaimConnectionNoConnect(const Endpoint& aSubscriber, TBool& aReused);
+    /**
+     * Return a connection claimed earlier.  aReusable indicates whether a complete response
+     * was read and the subscriber agreed to keep the connection open.
+     */
+    void ReleaseConnection(EventConnectionUpnp* aConnection, TBool aReusable);
+    WriterBwh* ClaimBuffer();
+    void ReleaseBuffer(WriterBwh* aBuffer);
+private:
+    void RemoveExpiredLocked(TUint aTimeNowMs);
+private:
+    static const TUint kMaxIdleConnections = 256;
+    static const TUint kIdleTimeoutMs = 3 * 1000; // shorter than control points are likely to keep an idle connection
+    static const TUint kMaxIdleBuffers = 16;
+    static const TUint kBufferGranularity = 4 * 1024;
+    static const TUint kMaxPooledBufferBytes = 64 * 1024;
+    Mutex iLock;
+    std::vector<EventConnectionUpnp*> iConnections;
+    std::vector<WriterBwh*> iBuffers;
+};
+
+class PropertyWriterFactory;
+
+/**
+ * Delivers NOTIFYs without tying up a publisher thread for each.
+ *
+ * Events are exchanged by a ReactorHttpClient so a slow or unreachable subscriber only
+ * delays its own events.  Events for a subscription
+ * are sent in order, one at a time.  At most kMaxOutstandingEvents can be reserved or queued
+ * per subscription; once that limit is reached further changes stay pending in the
+ * DviSubscription and are published together when the subscriber catches up.
+ * Construction throws NetworkError on platforms with no reactor support.
+ */
+class EventDispatcherUpnp : private ReactorHttpClient
+{
+public:
+    static const TUint kMaxOutstandingEvents = 2;
+public:
+    EventDispatcherUpnp(PropertyWriterPoolUpnp& aPool);
+    ~EventDispatcherUpnp();
+    /**
+     * Claim space for one event to aSid.  Returns false if kMaxOutstandingEvents are already
+     * outstanding; aFactory will then be asked to Republish() aSid once space is available.
+     * Each successful call must be matched by a call to either Queue() or Unreserve().
+     */
+    TBool Reserve(PropertyWriterFactory& aFactory, const Brx& aSid, const Endpoint& aSubscriber);
+    void Unreserve(const Brx& aSid);
+    /**
+     * Send aRequest (a complete NOTIFY) using space claimed by an earlier Reserve().
+     * Ownership of aRequest passes to this class.
+     */
+    void Queue(const Brx& aSid, WriterBwh* aRequest);
+    /**
+     * Number of events reserved, queued or being sent to aSid.  Intended for diagnostics.
+     */
+    TUint Outstanding(const Brx& aSid);
+private:
+    class Channel;
+    void Start(Channel& aChannel);
+    void Fail(Channel& aChannel, TBool aUnreachable, const TChar* aLogStr);
+    void Finish(Channel& aChannel, TBool aReusable);
+    void ReleaseLocked(Channel& aChannel, TUint aCount, Brh& aRepublishSid, PropertyWriterFactory*& aFactory);
+    void Republish(Brh& aSid, PropertyWriterFactory* aFactory);
+    Channel* FindLocked(const Brx& aSid);
+private: // ReactorHttpClient
+    void ProcessQueued();
+    TUint TimeoutMs() const;
+    void ResponseReceived(ReactorHttpExchange& aExchange, TBool aClosed);
+    void ExchangeFailed(ReactorHttpExchange& aExchange, EFailure aFailure);
+private:
+    static const TUint kMaxResponseBytes = 4 * 1024;
+    static const TUint kResponseTimeoutMs = 5 * 1000;
+    PropertyWriterPoolUpnp& iPool;
+    Mutex iLock;
+    typedef std::map<Brn,Channel*,BufferCmp> ChannelMap;
+    ChannelMap iChannels;            // protected by iLock
+    std::vector<Channel*> iReady;    // protected by iLock
+};
+
+class PropertyWriterUpnp : public PropertyWriter
+{
+public:
+    PropertyWriterUpnp(PropertyWriterPoolUpnp& aPool, const Endpoint& aPublisher, const Endpoint& aSubscriber,
+                       const Brx& aSubscriberPath, const Brx& aSid, TUint aSequenceNumber);
+    /**
+     * Constructor for use with an EventDispatcherUpnp.  The caller must already have
+     * Reserve()d space for this event.
+     */
+    PropertyWriterUpnp(PropertyWriterPoolUpnp& aPool, EventDispatcherUpnp& aDispatcher, const Endpoint& aPublisher,
+                       const Endpoint& aSubscriber, const Brx& aSubscriberPath, const Brx& aSid, TUint aSequenceNumber);
+private: // IPropertyWriter
+    ~PropertyWriterUpnp();
+    void PropertyWriteEnd();
+private:
+    void WriteRequest();
+    void ReadResponse();
+private:
+    static const TUint kReadTimeoutMs = 5 * 1000;
+    PropertyWriterPoolUpnp& iPool;
+    EventDispatcherUpnp* iDispatcher;
+    TBool iQueued;
+    Endpoint iPublisher;
+    Endpoint iSubscriber;
+    Brn iSubscriberPath;
+    Brn iSid;
+    TUint iSequenceNumber;
+    EventConnectionUpnp* iConnection;
+    TBool iReused;
+    TBool iReusable;
+    WriterBwh* iBody;
+    WriterBwh* iRequest;
+};
+
+class PropertyWriterFactory : public IPropertyWriterFactory
+{
+    friend class EventDispatcherUpnp;
+public:
+    PropertyWriterFactory(TIpAddress aAdapter, TUint aPort);
+    void SubscriptionAdded(DviSubscription& aSubscription);
+    void Disable();
+private: // called by EventDispatcherUpnp
+    void Republish(const Brx& aSid);
+    void SubscriberUnreachable(const Brx& aSid);
+    DviSubscription* TryClaimSubscription(const Brx& aSid);
+private: // IPropertyWriterFactory
+    IPropertyWriter* CreateWriter(const IDviSubscriptionUserData* aUserData, const Brx& aSid, TUint aSequenceNumber);
+    void NotifySubscriptionDeleted(const Brx& aSid);
+    void NotifySubscriptionExpired(const Brx& aSid);
+private:
+    ~PropertyWriterFactory();
+    void AddRef();
+    void RemoveRef();
+private:
+    AtomicInt iRefCount;
+    TBool iEnabled; // protected by iSubscriptionMapLock
+    TIpAddress iAdapter;
+    TUint iPort;
+    typedef std::map<Brn,DviSubscription*,BufferCmp> SubscriptionMap;
+    SubscriptionMap iSubscriptionMap;
+    Mutex iSubscriptionMapLock;
+};
+
+
+class DviSessionUpnp : public SocketTcpSession, private IResourceWriter, private IDviInvocation
+{
+public:
+    DviSessionUpnp(TIpAddress aInterface, TUint aPort, IRedirector& aRedirector);
+    ~DviSessionUpnp();
+private:
+    void Run();
+    void Error(const HttpStatus& aStatus);
+    void Get();
+    void Post();
+    void Subscribe();
+    void Unsubscribe();
+    void Renew();
+    void ParseRequestUri(const Brx& aUrlTail, DviDevice** aDevice, DviService** aService);
+    void WriteServerHeader(IWriterHttpHeader& aWriter);
+    void WriteHeaderConnection();
+    void InvocationReportErrorNoThrow(TUint aCode, const Brx& aDescription);
+    void WriteNotModified();
+    void WriteValidators();
+    TUint ResourceRangeClip(TUint aBytes, TUint& aSkip);
+private: // IResourceWriter
+    TBool WriteResourceContentEncoding(const TChar* aContentEncoding);
+    TBool WriteResourceEntityTag(const TChar* aEntityTag);
+    TBool WriteResourceLastModified(TUint64 aLastModified);
+    void WriteResourceBegin(TUint aTotalBytes, const TChar* aMimeType);
+    void WriteResource(const TByte* aData, TUint aBytes);
+    void WriteResourceRegion(const TByte* aData, TUint aBytes);
+    TBool WriteResourceFile(TInt aFile, TUint64 aOffset, TUint aBytes);
+    void WriteResourceEnd();
+private: // IDviInvocation
+    void Invoke();
+    TUint Version() const;
+    TIpAddress Adapter() const;
+    const char* ResourceUriPrefix() const;
+    void InvocationReadStart();
+    TBool InvocationReadBool(const TChar* aName);
+    void InvocationReadString(const TChar* aName, Brhz& aString);
+    TInt InvocationReadInt(const TChar* aName);
+    TUint InvocationReadUint(const TChar* aName);
+    void InvocationReadBinary(const TChar* aName, Brh& aData);
+    void InvocationReadEnd();
+    void InvocationReportError(TUint aCode, const Brx& aDescription);
+    void InvocationWriteStart();
+    void InvocationWriteBool(const TChar* aName, TBool aValue);
+    void InvocationWriteInt(const TChar* aName, TInt aValue);
+    void InvocationWriteUint(const TChar* aName, TUint aValue);
+    void InvocationWriteBinaryStart(const TChar* aName);
+    void InvocationWriteBinary(TByte aValue);
+    void InvocationWriteBinary(const Brx& aValue);
+    void InvocationWriteBinaryEnd(const TChar* aName);
+    void InvocationWriteStringStart(const TChar* aName);
+    void InvocationWriteString(TByte aValue);
+    void InvocationWriteString(const Brx& aValue);
+    void InvocationWriteStringEnd(const TChar* aName);
+    void InvocationWriteEnd();
+private:
+    static const TUint kMaxRequestBytes = 64*1024;
+    static const TUint kMaxResponseBytes = 4*1024;
+    static const TUint kReadTimeoutMs = 5 * 1000;
+    static const TUint kMaxEntityTagBytes = 128;
+    static const TUint kMaxContentEncodingBytes = 32;
+private:
+    TIpAddress iInterface;
+    TUint iPort;
+    IRedirector& iRedirector;
+    Srs<kMaxRequestBytes>* iReadBuffer;
+    ReaderHttpRequest* iReaderRequest;
+    WriterHttpChunked* iWriterChunked;
+    Sws<kMaxResponseBytes>* iWriterBuffer;
+    WriterHttpResponse* iWriterResponse;
+    HttpHeaderHost iHeaderHost;
+    HttpHeaderContentLength iHeaderContentLength;
+    HttpHeaderConnection iHeaderConnection;
+    HttpHeaderExpect iHeaderExpect;
+    HeaderSoapAction iHeaderSoapAction;
+    HeaderSid iHeaderSid;
+    HeaderTimeout iHeaderTimeout;
+    HeaderNt iHeaderNt;
+    HeaderCallback iHeaderCallback;
+    HeaderAcceptLanguage iHeaderAcceptLanguage;
+    HttpHeaderAcceptEncoding iHeaderAcceptEncoding;
+    HttpHeaderIfNoneMatch iHeaderIfNoneMatch;
+    HttpHeaderIfModifiedSince iHeaderIfModifiedSince;
+    HttpHeaderIfRange iHeaderIfRange;
+    HttpHeaderRange iHeaderRange;
+    const HttpStatus* iErrorStatus;
+    TBool iResponseStarted;
+    TBool iResponseEnded;
+    TBool iPersistConnection;   // leave the connection open for another request once this response ends
+    Brn iSoapRequest;
+    XmlParserChildIndex iSoapArgs;
+    DviDevice* iInvocationDevice;
+    DviService* iInvocationService;
+    mutable Bws<128> iResourceUriPrefix;
+    TBool iResourceWriterHeadersOnly;
+    TBool iResourceWriterChunked;
+    Bws<kMaxEntityTagBytes> iEntityTag;
+    Bws<kMaxContentEncodingBytes> iContentEncoding;
+    TBool iContentEncodingOffered;  // response depends on Accept-Encoding so needs a Vary header
+    TUint64 iLastModified;      // 0 if not reported by the resource manager
+    TBool iResourceRange;       // only bytes [iRangeFirst, iRangeEnd) of the resource are sent
+    TUint iRangeFirst;
+    TUint iRangeEnd;
+    TUint iResourceOffset;      // bytes of the resource passed to us so far
+    PropertyWriterFactory* iPropertyWriterFactory;
+    Semaphore iShutdownSem;
+};
+
+class DviServerUpnp : public DviServer, private IRedirector
+{
+public:
+    DviServerUpnp(TUint aPort = 0);
+    void Redirect(const Brx& aUriRequested, const Brx& aUriRedirectedTo);
+protected:
+    virtual SocketTcpServer* CreateServer(const NetworkAdapter& aNif);
+private:
+    TBool RedirectUri(const Brx& aUri, Brn& aRedirectTo);
+private:
+    static const TUint kParkTimeoutMs = 5 * 1000;
+private:
+    TUint iPort;
+    Brh iRedirectUriRequested;
+    Brh iRedirectUriRedirectedTo;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+#endif // HEADER_DVI_SERVER_UPNP
@@ -0,0 +1,58 @@
+/**
+ * UPnP library internal APIs
+ *
+ * NOT intended for use by clients of the library
+ */
+
+#ifndef HEADER_DVI_STACK
+#define HEADER_DVI_STACK
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Net/Private/Stack.h>
+#include <OpenHome/Net/Private/DviServerUpnp.h>
+#include <OpenHome/Net/Private/DviDevice.h>
+#include <OpenHome/Net/Private/DviSubscription.h>
+#include <OpenHome/Net/Private/DviServerWebSocket.h>
+#include <OpenHome/Net/Private/DviService.h>
+#include <OpenHome/Net/Private/Bonjour.h>
+#include <OpenHome/Net/Private/DviPropertyUpdateCollection.h>
+
+#include <vector>
+
+namespace OpenHome {
+namespace Net {
+
+class DviStack : private IStack
+{
+public:
+    DviStack();
+    static TUint BootId();
+    static TUint NextBootId();
+    static void UpdateBootId();
+    static DviServerUpnp& ServerUpnp();
+    static DviDeviceMap& DeviceMap();
+    static DviSubscriptionManager& SubscriptionManager();
+    static PropertyWriterPoolUpnp& PropertyWriterPool();
+    static EventDispatcherUpnp* EventDispatcher(); // NULL if events are sent from publisher threads
+    static IMdnsProvider* MdnsProvider();
+    static DviPropertyUpdateCollection& PropertyUpdateCollection();
+private:
+    ~DviStack();
+    static DviStack* Self();
+private:
+    TUint iBootId;
+    TUint iNextBootId;
+    DviServerUpnp* iDviServerUpnp;
+    DviDeviceMap* iDviDeviceMap;
+    DviSubscriptionManager* iSubscriptionManager;
+    PropertyWriterPoolUpnp* iPropertyWriterPool;
+    EventDispatcherUpnp* iEventDispatcher;
+    DviServerWebSocket* iDviServerWebSocket;
+    IMdnsProvider* iMdns;
+    DviPropertyUpdateCollection* iPropertyUpdateCollection;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+#endif // HEADER_DVI_STACK
@@ -0,0 +1,171 @@
+#ifndef HEADER_DVISUBSCRIPTION
+#define HEADER_DVISUBSCRIPTION
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Exception.h>
+#include <OpenHome/Private/Network.h>
+#include <OpenHome/Net/Private/Service.h>
+#include <OpenHome/Private/Timer.h>
+#include <OpenHome/Private/Thread.h>
+#include <OpenHome/Private/Fifo.h>
+
+#include <vector>
+#include <map>
+#include <list>
+
+EXCEPTION(DvSubscriptionError);
+
+namespace OpenHome {
+namespace Net {
+
+class IDviSubscriptionUserData
+{
+public:
+    virtual const void* Data() const = 0;
+    virtual void Release() = 0;
+};
+    
+class IPropertyWriterFactory
+{
+public:
+    virtual IPropertyWriter* CreateWriter(const IDviSubscriptionUserData* aUserData, 
+                                          const Brx& aSid, TUint aSequenceNumber) = 0;
+    virtual void NotifySubscriptionDeleted(const Brx& aSid) = 0;
+    virtual void NotifySubscriptionExpired(const Brx& aSid) = 0;
+};
+
+class DviDevice;
+class DviService;
+class DviSubscription
+{
+    friend class DviSubscriptionManager;
+public:
+    DviSubscription(DviDevice& aDevice, IPropertyWriterFactory& aWriterFactory,
+                    IDviSubscriptionUserData* aUserData, Brh& aSid, TUint& aDurationSecs);
+    void Start(DviService& aService);
+    void Stop(); // should only be called by DviService
+    void AddRef();
+    TBool TryAddRef();
+    void RemoveRef();
+    void Remove();
+    void Renew(TUint& aSeconds);
+    void WriteChanges();
+    const Brx& Sid() const;
+    TBool PropertiesInitialised() const;
+private:
+    ~DviSubscription();
+    IPropertyWriter* CreateWriter();
+    void Expired();
+    void DoRenew(TUint& aSeconds);
+private:
+    mutable Mutex iLock;
+    AtomicInt iRefCount;
+    DviDevice& iDevice;
+    IPropertyWriterFactory& iWriterFactory;
+    IDviSubscriptionUserData* iUserData;
+    Brh iSid;
+    DviService* iService;
+    std::vector<TUint> iPropertySequenceNumbers;
+    TUint iSequenceNumber;
+    Timer* iTimer;
+    TBool iPublishPending; // guarded by DviSubscriptionManager's lock
+};
+
+class PropertyWriter : public IPropertyWriter
+{
+public:
+    static void WriteVariable(IWriter& aWriter, const Brx& aName, const Brx& aValue);
+protected:
+    PropertyWriter();
+    void SetWriter(IWriter& aWriter);
+private: // IPropertyWriter
+    void PropertyWriteString(const Brx& aName, const Brx& aValue);
+    void PropertyWriteInt(const Brx& aName, TInt aValue);
+    void PropertyWriteUint(const Brx& aName, TUint aValue);
+    void PropertyWriteBool(const Brx& aName, TBool aValue);
+    void PropertyWriteBinary(const Brx& aName, const Brx& aValue);
+    TBool SupportsEncodedProperties() const;
+    void PropertyWriteEncoded(const Brx& aProperties);
+private:
+    void WriteVariable(const Brx& aName, const Brx& aValue);
+private:
+    IWriter* iWriter;
+};
+
+/**
+ * Immutable, reference counted set of <e:property> elements describing every property of a
+ * service whose sequence number differs from a given snapshot.
+ *
+ * Created (and cached) by DviService so that subscribers with identical pending changes can
+ * share a single encoding.  Only the SID/SEQ headers then need to be written per subscriber.
+ */
+class EncodedPropertySet : private INonCopyable
+{
+    friend class DviService;
+public:
+    void AddRef();
+    void RemoveRef();
+    const Brx& Properties() const;
+private:
+    EncodedPropertySet(const std::vector<Property*>& aProperties, const std::vector<TUint>& aSequenceNumbers);
+    ~EncodedPropertySet();
+    TBool Matches(const std::vector<TUint>& aSequenceNumbers) const;
+    TBool IsCurrent(const std::vector<Property*>& aProperties) const;
+private:
+    static const TUint kWriteBufGranularity = 1024;
+    AtomicInt iRefCount;
+    std::vector<TUint> iFrom;
+    std::vector<TUint> iTo;
+    Brh iProperties;
+};
+
+class Publisher : public Thread
+{
+public:
+    Publisher(const TChar* aName, Fifo<Publisher*>& aFree);
+    ~Publisher();
+    void Publish(DviSubscription* aSubscription);
+private:
+    void Error(const TChar* aErr);
+    void Run();
+private:
+    Fifo<Publisher*>& iFree;
+    DviSubscription* iSubscription;
+};
+
+class DviSubscriptionManager : public Thread
+{
+public:
+    DviSubscriptionManager();
+    ~DviSubscriptionManager();
+    static void AddSubscription(DviSubscription& aSubscription);
+    static void RemoveSubscription(DviSubscription& aSubscription);
+    static DviSubscription* Find(const Brx& aSid);
+    static void QueueUpdate(DviSubscription& aSubscription);
+private:
+    class PendingUpdate
+    {
+    public:
+        PendingUpdate(DviSubscription& aSubscription, TUint aDueTime)
+            : iSubscription(&aSubscription), iDueTime(aDueTime) {}
+        DviSubscription* iSubscription;
+        TUint iDueTime;
+    };
+private:
+    static DviSubscriptionManager& Self();
+    void Run();
+private:
+    Mutex iLock;
+    std::list<PendingUpdate> iList;
+    TUint iCoalesceMs;
+    Fifo<Publisher*> iFree;
+    Publisher** iPublishers;
+    typedef std::map<Brn,DviSubscription*,BufferCmp> Map;
+    Map iMap;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+#endif // HEADER_DVISUBSCRIPTION
@@ -0,0 +1,183 @@
+#ifndef HEADER_REACTOR_HTTP
+#define HEADER_REACTOR_HTTP
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Private/Network.h>
+#include <OpenHome/Private/Thread.h>
+
+#include <vector>
+
+namespace OpenHome {
+namespace Net {
+
+/**
+ * A single http request and its response, exchanged by a ReactorHttpClient.
+ *
+ * Derived classes supply the connection, typically from a pool of keep-alive connections.
+ * Intended for internal use only
+ */
+class ReactorHttpExchange : private INonCopyable
+{
+    friend class ReactorHttpClient;
+public:
+    virtual ~ReactorHttpExchange();
+    const Brx& Response() const;
+    TUint HeaderBytes() const; // 0 if the end of the response headers wasn't found
+    TBool Chunked() const;
+protected:
+    ReactorHttpExchange();
+private:
+    /**
+     * Returns the socket for a connection to aEndpoint, owned by the derived class until
+     * ReleaseConnection() is called.  aReused is set if it is an already connected
+     * keep-alive connection; a new one must be opened but not yet connected.
+     */
+    virtual SocketTcpClient& ClaimConnection(const Endpoint& aEndpoint, TBool& aReused) = 0;
+    /**
+     * aReusable indicates whether a complete response was read and the peer agreed to
+     * keep the connection open.
+     */
+    virtual void ReleaseConnection(TBool aReusable) = 0;
+    /**
+     * Called once a new connection is established.  Does nothing by default.
+     */
+    virtual void Connected();
+    /**
+     * Whether the request may be resent once a reused connection turns out to have been
+     * closed while idle.  Returns true by default.
+     */
+    virtual TBool Retryable() const;
+private:
+    enum EState
+    {
+        eIdle
+       ,eConnecting
+       ,eSending
+       ,eReceiving
+    };
+private:
+    Endpoint iEndpoint;
+    Brn iRequest;
+    SocketTcpClient* iSocket;
+    EState iState;
+    TBool iRegistered;
+    TBool iReused;
+    TUint iSent; // bytes of iRequest written so far
+    Bwh iResponse;
+    TUint iHeaderBytes;
+    TBool iChunked;
+    TUint iChunkOffset;     // offset in iResponse of the next chunk size (or trailer) line not yet known to be complete
+    TBool iLastChunkRead;   // the zero length chunk has been seen; only trailers remain
+    TBool iContentLengthReceived;
+    TUint iContentLength;
+    TUint iDeadlineMs;
+};
+
+/**
+ * Runs http exchanges without dedicating a thread to each.
+ *
+ * A single thread uses a NetworkReactor to connect, send requests and collect responses
+ * for every active exchange so the number in flight is bounded by sockets rather than
+ * threads.  Derived classes queue work from other threads, Wake() the reactor thread then
+ * Begin() exchanges from ProcessQueued().  Every exchange which is begun is eventually
+ * passed to either ResponseReceived() or ExchangeFailed(); these must then End() it.
+ * Construction throws NetworkError on platforms with no reactor support.
+ * Intended for internal use only
+ */
+class ReactorHttpClient : private INonCopyable
+{
+public:
+    enum EUnsizedResponse
+    {
+        eReadUntilClosed // response without a length or chunked encoding ends when the peer closes
+       ,eEndAtHeaders    // ...or is assumed to have no body
+    };
+    enum EFailure
+    {
+        eFailConnect
+       ,eFailConnectTimeout
+       ,eFailWrite
+       ,eFailNetwork
+       ,eFailTimeout // request not sent or response not read within TimeoutMs()
+       ,eFailResponseTooLong
+    };
+public:
+    virtual ~ReactorHttpClient();
+protected:
+    /**
+     * aMaxResponseBytes of 0 means responses of any length are accepted
+     */
+    ReactorHttpClient(const TChar* aThreadName, TUint aMaxResponseBytes, EUnsizedResponse aUnsizedResponse);
+    /**
+     * Start the reactor thread.  Call at the end of the derived class' constructor.
+     */
+    void Start();
+    /**
+     * Stop the reactor thread.  Call at the start of the derived class' destructor;
+     * any exchanges still active can then be End()ed from the calling thread.
+     */
+    void Stop();
+    /**
+     * Have the reactor thread call ProcessQueued() promptly.  May be called from any thread.
+     */
+    void Wake();
+    /**
+     * The remaining functions may only be called from the reactor thread (or after Stop()).
+     * aRequest must remain valid until aExchange is End()ed.
+     */
+    void Begin(ReactorHttpExchange& aExchange, const Endpoint& aEndpoint, const Brx& aRequest);
+    /**
+     * Wait for more of a response passed to ResponseReceived() which turned out to be incomplete
+     */
+    void ContinueReceiving(ReactorHttpExchange& aExchange);
+    /**
+     * Stop tracking aExchange, releasing its connection (if any)
+     */
+    void End(ReactorHttpExchange& aExchange, TBool aReusable);
+    TUint ActiveCount() const;
+    ReactorHttpExchange& Active(TUint aIndex) const;
+private:
+    /**
+     * Called by the reactor thread on each pass, after Wake() and whenever a socket is ready
+     */
+    virtual void ProcessQueued() = 0;
+    /**
+     * Time allowed to send a request, then again to read its response
+     */
+    virtual TUint TimeoutMs() const = 0;
+    /**
+     * A complete response is available from aExchange.Response().  aClosed indicates whether
+     * the peer closed the connection while it was read.
+     */
+    virtual void ResponseReceived(ReactorHttpExchange& aExchange, TBool aClosed) = 0;
+    virtual void ExchangeFailed(ReactorHttpExchange& aExchange, EFailure aFailure) = 0;
+private:
+    void Run();
+    void Connect(ReactorHttpExchange& aExchange);
+    void Send(ReactorHttpExchange& aExchange);
+    void SendContinue(ReactorHttpExchange& aExchange);
+    void Receive(ReactorHttpExchange& aExchange);
+    TBool ResponseComplete(ReactorHttpExchange& aExchange, TBool aClosed) const;
+    static TBool ChunkedBodyComplete(ReactorHttpExchange& aExchange);
+    void Retry(ReactorHttpExchange& aExchange);
+    void Arm(ReactorHttpExchange& aExchange, TUint aReadiness);
+    TUint WaitTimeoutMs(TUint aTimeNowMs) const;
+private:
+    static const TUint kMaxEvents = 64;
+    static const TUint kMaxReadBytes = 4096;
+    const TChar* iThreadName;
+    const TUint iMaxResponseBytes;
+    const EUnsizedResponse iUnsizedResponse;
+    NetworkReactor iReactor;
+    ThreadFunctor* iThread;
+    Mutex iLock;
+    TBool iQuit;                                // protected by iLock
+    std::vector<ReactorHttpExchange*> iActive;  // only accessed by iThread
+    Bws<kMaxReadBytes> iReadBuffer;             // only accessed by iThread
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+#endif // HEADER_REACTOR_HTTP
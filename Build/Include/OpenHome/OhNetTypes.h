@@ -0,0 +1,31 @@
+#ifndef HEADER_TYPES
+#define HEADER_TYPES
+
+#include <OpenHome/OsTypes.h>
+#include <OpenHome/OhNetDefines.h>
+
+namespace OpenHome {
+
+typedef char TChar;
+typedef bool TBool;
+typedef void TAny;
+
+typedef int8_t TInt8;
+typedef int16_t TInt16;
+typedef int32_t TInt32;
+typedef int64_t TInt64;
+
+typedef uint8_t TByte;
+typedef uint8_t TUint8;
+typedef uint16_t TUint16;
+typedef uint32_t TUint32;
+typedef uint64_t TUint64;
+
+typedef uint32_t TKey;
+typedef uint32_t TUint;
+typedef int32_t TInt;
+typedef int32_t TStatus;
+
+} // namespace OpenHome
+
+#endif //HEADER_TYPES
@@ -0,0 +1,39 @@
+#ifndef HEADER_ATOMIC
+#define HEADER_ATOMIC
+
+#include <OpenHome/OhNetTypes.h>
+
+#ifdef _MSC_VER
+# include <intrin.h>
+# pragma intrinsic(_InterlockedExchangeAdd, _InterlockedCompareExchange, _ReadWriteBarrier)
+#endif
+
+namespace OpenHome {
+
+// Atomic operations on a single word of memory.
+//
+// Every operation is a full memory barrier.  Load() and Store() are intended for values
+// which are also updated by Add() or CompareAndSwap() from other threads.
+
+class Atomic
+{
+public:
+#ifdef _MSC_VER
+    inline static TUint Add(volatile TUint& aValue, TInt aAdd)
+        { return (TUint)_InterlockedExchangeAdd((volatile long*)&aValue, (long)aAdd) + aAdd; }
+    inline static TBool CompareAndSwap(volatile TUint& aValue, TUint aExpected, TUint aNew)
+        { return ((TUint)_InterlockedCompareExchange((volatile long*)&aValue, (long)aNew, (long)aExpected) == aExpected); }
+    inline static void Barrier() { long dummy = 0; _InterlockedExchangeAdd(&dummy, 0); _ReadWriteBarrier(); }
+#else
+    inline static TUint Add(volatile TUint& aValue, TInt aAdd) { return __sync_add_and_fetch(&aValue, (TUint)aAdd); }
+    inline static TBool CompareAndSwap(volatile TUint& aValue, TUint aExpected, TUint aNew)
+        { return __sync_bool_compare_and_swap(&aValue, aExpected, aNew); }
+    inline static void Barrier() { __sync_synchronize(); }
+#endif
+    inline static TUint Load(const volatile TUint& aValue) { TUint value = aValue; Barrier(); return value; }
+    inline static void Store(volatile TUint& aValue, TUint aNew) { Barrier(); aValue = aNew; Barrier(); }
+};
+
+} // namespace OpenHome
+
+#endif // HEADER_ATOMIC
@@ -0,0 +1,230 @@
+#ifndef HEADER_FIFO
+#define HEADER_FIFO
+
+#include <OpenHome/Private/Standard.h>
+#include <OpenHome/Private/Thread.h>
+#include <OpenHome/Exception.h>
+
+EXCEPTION(FifoReadError);
+
+namespace OpenHome {
+
+// Fifo provides fully thread-aware first in first out buffering
+//
+// Writer threads are blocked while the fifo is full
+// Reader threads are blocked while the fifo is empty
+//
+// Entries are held in a lock-free ring (after Dmitry Vyukov's bounded MPMC queue); each
+// cell carries a sequence number which tells writers and readers whether it is free to
+// claim.  Semaphores are only used to block threads while the fifo is full or empty and
+// are only signalled when another thread is known to be waiting on them.
+
+class FifoBase : public INonCopyable
+{
+public:
+    TUint Slots() const;
+    TUint SlotsFree() const;
+    TUint SlotsUsed() const;
+    void ReadInterrupt(TBool aInterrupt=true);
+protected:
+    FifoBase(TUint aSlots);
+    ~FifoBase();
+    TUint Capacity() const;             // size of buffer needed by derived classes
+    TUint WriteOpen(TUint aTimeoutMs);  // return index of entry to write
+    void WriteClose(TUint aIndex);      // complete the write
+    TUint ReadOpen(TUint aTimeoutMs);   // return index of entry to read
+    void ReadClose(TUint aIndex);       // complete the read
+    TUint DoPeek();                     // return index of entry without removing it
+    // Span variants claim between 1 and aMaxEntries consecutive entries, blocking only while
+    // none are available.  They return the number claimed; entries run from aIndex and wrap
+    // to index 0 after Capacity()-1.
+    TUint WriteSpanOpen(TUint aMaxEntries, TUint& aIndex, TUint aTimeoutMs);
+    void WriteSpanClose(TUint aIndex, TUint aCount);
+    TUint ReadSpanOpen(TUint aMaxEntries, TUint& aIndex, TUint aTimeoutMs);
+    void ReadSpanClose(TUint aIndex, TUint aCount);
+private:
+    TUint TryWriteOpen(TUint aMaxEntries, TUint& aIndex);
+    TUint TryReadOpen(TUint aMaxEntries, TUint& aIndex);
+    void CheckReadInterrupted();
+    static void Wake(volatile TUint& aWaiting, Semaphore& aSem, TUint aMax);
+    static void Unregister(volatile TUint& aWaiting);
+    static TUint Remaining(TUint aTimeoutMs, TUint aStartMs);
+protected:
+    TUint iSlots;
+    TUint iCapacity;    // iSlots rounded up to a power of two
+    TUint iMask;
+    volatile TUint* iSequence;
+    volatile TUint iWritePos;
+    volatile TUint iReadPos;
+    volatile TUint iWritersWaiting;
+    volatile TUint iReadersWaiting;
+    volatile TUint iInterrupted;
+    Semaphore iSemaRead;
+    Semaphore iSemaWrite;
+};
+
+template <class T> class Fifo : public FifoBase
+{
+public:
+    inline Fifo(TUint aSlots) : FifoBase(aSlots) { iBuf = new T[Capacity()]; }
+    inline ~Fifo() { delete [] iBuf; }
+    void Write(T aEntry);
+    void Write(T aEntry, TUint aTimeoutMs);
+    T Read();
+    T Read(TUint aTimeoutMs);
+    T Peek();
+protected:
+    T* iBuf;
+};
+
+template <class T> void Fifo<T>::Write(T aEntry)
+{
+    Write(aEntry, 0);
+}
+
+template <class T> void Fifo<T>::Write(T aEntry, TUint aTimeoutMs)
+{
+    TUint index = WriteOpen(aTimeoutMs);
+    iBuf[index] = aEntry;
+    WriteClose(index);
+}
+
+template <class T> T Fifo<T>::Read()
+{
+    return Read(0);
+}
+
+template <class T> T Fifo<T>::Read(TUint aTimeoutMs)
+{
+    TUint index = ReadOpen(aTimeoutMs);
+    T value = iBuf[index];
+    ReadClose(index);
+    return (value);
+}
+
+template <class T> T Fifo<T>::Peek()
+{
+    T value = iBuf[DoPeek()];
+    return (value);
+}
+
+// FifoByte provides a specific TByte Fifo instantiation
+// with additional buffer write and read functions
+//
+// Buffers are copied in as few contiguous spans as possible rather than a byte at a time.
+
+class FifoByte : public Fifo<TByte>
+{
+public:
+    FifoByte(TUint aSlots);
+    void Write(const Brx& aBuffer);
+    void Read(Bwx& aBuffer);
+    void Read(Bwx& aBuffer, TUint aBytes);
+};
+
+// FifoThreshold adds low and high threshold monitoring to a standard Fifo object
+//
+// Thresholds are initially set to 0 (Low) and aSlots (High).
+
+class FifoThresholdBase;
+class FifoThresholdObserver
+{
+public:
+    virtual void NotifyThresholdLow(FifoThresholdBase& aFifo) = 0;
+    virtual void NotifyThresholdHigh(FifoThresholdBase& aFifo) = 0;
+};
+
+class FifoThresholdBase : public FifoBase
+{
+public:
+    void SetThresholdLow(TUint aSlot);
+    void SetThresholdHigh(TUint aSlot);
+protected:
+    FifoThresholdBase(TUint aSlots, FifoThresholdObserver& aObserver);
+    void CheckThresholdLow();
+    void CheckThresholdHigh();
+private:
+    FifoThresholdObserver& iObserver;
+    TUint iThresholdLow;
+    TUint iThresholdHigh;
+    TBool iThresholdLowActive;
+    TBool iThresholdHighActive;
+};
+
+template <class T> class FifoThreshold : public FifoThresholdBase
+{
+public:
+    inline FifoThreshold(TUint aSlots, FifoThresholdObserver& aObserver): FifoThresholdBase(aSlots, aObserver) { iBuf = new T[Capacity()]; }
+    inline ~FifoThreshold() { delete [] iBuf; }
+    void Write(T aEntry);
+    T Read();
+private:
+    T* iBuf;
+};
+
+template <class T> void FifoThreshold<T>::Write(T aEntry)
+{
+    TUint index = WriteOpen(0);
+    iBuf[index] = aEntry;
+    WriteClose(index);
+    CheckThresholdLow();
+}
+
+template <class T> T FifoThreshold<T>::Read()
+{
+    TUint index = ReadOpen(0);
+    T value = iBuf[index];
+    ReadClose(index);
+    CheckThresholdHigh();
+    return (value);
+}
+
+// FifoLite provides lightweight thread unaware first in first out buffering
+//
+// Writes assert if the fifo is full (use SlotsFree() to check before writing)
+// Reads from an empty fifo assert (use SlotsUsed() to check before reading)
+ 
+class FifoLiteBase : public INonCopyable
+{
+public:
+    TUint Slots() const;
+    TUint SlotsFree() const;
+    TUint SlotsUsed() const;
+protected:
+    FifoLiteBase(TUint aSlots);
+    TUint Write();          // return index of entry to write
+    TUint WriteBack();      // return index of entry to write at rhs of fifo
+    TUint Read();           // return index of entry to read
+private:
+    TUint iSlots;
+    TUint iSlotsUsed;
+    TUint iReadIndex; 
+    TUint iWriteIndex;
+};
+
+template <class T, TUint S> class FifoLite : public FifoLiteBase 
+{
+public:
+    inline FifoLite() : FifoLiteBase(S) {}
+    inline void Write(T aEntry) { iBuf[FifoLiteBase::Write()] = aEntry; }
+    inline void WriteBack(T aEntry) { iBuf[FifoLiteBase::WriteBack()] = aEntry; }
+    inline T Read() { return (iBuf[FifoLiteBase::Read()]); }
+private:
+    T iBuf[S];
+};
+
+template <class T> class FifoLiteDynamic : public FifoLiteBase
+{
+public:
+    inline FifoLiteDynamic(TUint aSlots) : FifoLiteBase(aSlots) { iBuf = new T[aSlots]; }
+    inline ~FifoLiteDynamic() { delete [] iBuf; }
+    inline void Write(T aEntry) { iBuf[FifoLiteBase::Write()] = aEntry; }
+    inline void WriteBack(T aEntry) { iBuf[FifoLiteBase::WriteBack()] = aEntry; }
+    inline T Read() { return (iBuf[FifoLiteBase::Read()]); }
+private:
+    T* iBuf;
+};
+
+} // namespace OpenHome
+
+#endif //HEADER_FIFO
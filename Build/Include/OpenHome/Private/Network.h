@@ -0,0 +1,419 @@
+#ifndef HEADER_NETWORK
+#define HEADER_NETWORK
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Private/Thread.h>
+#include <OpenHome/Private/Stream.h>
+#include <OpenHome/OsTypes.h>
+#include <OpenHome/Os.h>
+#include <OpenHome/Private/Fifo.h>
+
+#include <vector>
+
+EXCEPTION(NetworkError);
+EXCEPTION(NetworkAddressInUse);
+EXCEPTION(NetworkTimeout);
+
+namespace OpenHome {
+
+enum ESocketType
+{
+    eSocketTypeStream = 1,              /// Tcp stream
+    eSocketTypeDatagram = 2,            /// Udp
+};
+
+// Addressing
+
+// The Endpoint class has been designed with a restricted interface in order to facilitate
+// the move to different addressing schemes in the future (IPv6)
+
+class Endpoint
+{
+public:
+    static const TUint kMaxAddressBytes = 16;
+    static const TUint kMaxEndpointBytes = 22;
+    typedef Bws<kMaxAddressBytes> AddressBuf;
+    typedef Bws<kMaxEndpointBytes> EndpointBuf;
+public:
+    Endpoint();
+    Endpoint(TUint aPort, const Brx& aAddress);          // specify port, specify ip address from string e.g. "192.168.0.1"
+    Endpoint(TUint aPort, TIpAddress aAddress);          // specify port, specify ip address from uint
+    void SetPort(TUint aPort);                           // set port
+    void SetPort(const Endpoint& aEndpoint);             // set port from other endpoint
+    void SetAddress(const Brx& aAddress);                // set address from string e.g. "192.168.0.1"
+    void SetAddress(TIpAddress aAddress);
+    void SetAddress(const Endpoint& aEndpoint);          // set address from other endpoint
+    void Replace(const Endpoint& aEndpoint);             // set endpoint from other endpoint
+    TBool Equals(const Endpoint& aEndpoint) const;       // test if this endpoint is equal to the specified endpoint
+    TIpAddress Address() const;
+    TUint16 Port() const;                                // return port as a network order uint16
+    void AppendAddress(Bwx& aAddress) const;
+    void AppendEndpoint(Bwx& aEndpoint) const;
+    void GetAddressOctets(TByte (&aOctets)[4]) const;
+    static void AppendAddress(Bwx& aAddressBuffer, TIpAddress aAddress);
+private:
+    TIpAddress iAddress;
+    TUint16 iPort;
+};
+
+class Socket
+{
+    friend class NetworkReactor;
+public:
+    void Close();
+    void Interrupt(TBool aInterrupt);
+    void SetSendBufBytes(TUint aBytes);
+    void SetRecvBufBytes(TUint aBytes);
+    void SetRecvTimeout(TUint aMs);
+    void LogVerbose(TBool aLog, TBool aHex = false);
+protected:
+    Socket();
+    virtual ~Socket() {}
+    TBool TryClose();
+    void Send(const Brx& aBuffer);
+    TUint SendNonBlocking(const Brx& aBuffer); // returns bytes sent; fewer than aBuffer.Bytes() if the send buffer filled
+    void SendFile(TInt aFile, TUint64 aOffset, TUint aBytes);
+    void SendTo(const Brx& aBuffer, const Endpoint& aEndpoint);
+    void Receive(Bwx& aBuffer);
+    void Receive(Bwx& aBuffer, TUint aBytes);
+    void ReceiveFrom(Bwx& aBuffer, Endpoint& aEndpoint);
+    void Bind(const Endpoint& aEndpoint);
+    void GetPort(TUint& aPort);
+    void Listen(TUint aSlots);
+    THandle Accept();
+    THandle AcceptNonBlocking(); // returns kHandleNull if no connection is pending
+private:
+    void Log(const char* aPrefix, const Brx& aBuffer);
+protected:
+    THandle iHandle;
+private:
+    static const uint32_t kLogNone      = 0;
+    static const uint32_t kLogPlainText = 1;
+    static const uint32_t kLogHex       = 2;
+    uint32_t iLog;
+};
+
+/**
+ * Utility class.
+ *
+ * Create an AutoSocket on the stack using a reference to an opened Socket.
+ * It will automatically be closed on stack cleanup (ie on return or when
+ * an exception passes up).
+ */
+class AutoSocket : public INonCopyable
+{
+public:
+    AutoSocket(Socket& aSocket);
+    ~AutoSocket();
+private:
+    Socket& iSocket;
+};
+
+/**
+ * Readiness multiplexer, allowing a single thread to wait on many sockets.
+ *
+ * Sockets are registered one-shot; once reported by Wait() they must be Rearm()ed
+ * before they'll be reported again.
+ * Construction throws NetworkError on platforms with no reactor support.
+ */
+class NetworkReactor : public INonCopyable
+{
+public:
+    static const TUint kReadable = eOsNetworkReadable;
+    static const TUint kWritable = eOsNetworkWritable;
+    static const TUint kHangup   = eOsNetworkHangup;
+    typedef OsNetworkReactorEvent Event;
+public:
+    NetworkReactor();
+    ~NetworkReactor();
+    void Add(Socket& aSocket, TUint aReadiness, void* aArg);
+    void Rearm(Socket& aSocket, TUint aReadiness, void* aArg);
+    void Remove(Socket& aSocket);
+    TUint Wait(Event* aEvents, TUint aMaxEvents, TUint aTimeoutMs = 0); // returns number of ready sockets.  0 => timeout or Interrupt()
+    void Interrupt();
+private:
+    THandle iHandle;
+};
+
+/// Shared Tcp client / Tcp session base class
+class SocketTcp : public Socket, public IWriter, public IReaderSource
+{
+public:
+    /**
+     * Block until aBytes bytes are received, replace buffer
+     * Throw NetworkError on network error
+     * Throw NetworkError on remote socket close - returns with aBuffer.Bytes() < aBytes
+     */
+    void Receive(Bwx& aBuffer, TUint aBytes);
+
+    // IWriter
+    /**
+     * Send the buffer, block until all bytes are sent
+     * Throw NetworkError on network error
+     */
+    void Write(TByte aValue);
+    void Write(const Brx& aBuffer);
+    void WriteFlush();
+    /**
+     * Send as much of the buffer as the socket will accept without blocking
+     * Returns the number of bytes sent, which is less than aBuffer.Bytes() if the send buffer filled
+     * Throw WriterError on network error
+     */
+    TUint WriteNonBlocking(const Brx& aBuffer);
+
+    // IReaderSource
+    /**
+     * Receive between [0, aBuffer.MaxBytes()] bytes, replace buffer
+     * Throw NetworkError on network error
+     * On return, aBuffer.Bytes() == 0 means remote socket closed
+     */
+    void Read(Bwx& aBuffer);
+    void Read(Bwx& aBuffer, TUint aBytes);
+    void ReadFlush();
+    void ReadInterrupt();
+protected:
+    SocketTcp();
+};
+
+/// Tcp client
+
+class SocketTcpClient : public SocketTcp
+{
+public:
+    void Open();                                                /// Open
+    void Connect(const Endpoint& aEndpoint, TUint aTimeout);    /// Connect to a given IP address and port number (timeout in milliseconds)
+    /**
+     * Begin connecting without blocking.  Returns true if already connected; false if the
+     * attempt is in progress, in which case a NetworkReactor will report the socket writable
+     * once it completes and ConnectComplete() must then be called.
+     * Throw NetworkError on failure
+     */
+    TBool ConnectStart(const Endpoint& aEndpoint);
+    void ConnectComplete();                                     /// Throw NetworkError if a connection begun by ConnectStart() failed
+};
+
+/**
+ * Reader source for a SocketTcp which notes why reading stopped.
+ *
+ * Lets users of keep-alive connections tell a connection the peer closed while it was
+ * idle (so a request can safely be sent again) from a slow or partial response.
+ * ReaderHttpResponse::Read() calls ReadFlush() before each response, resetting this state.
+ */
+class SocketTcpReader : public IReaderSource, private INonCopyable
+{
+public:
+    SocketTcpReader(SocketTcp& aSocket);
+    /**
+     * Whether the peer closed or reset the connection before sending anything since the last
+     * ReadFlush().  False if reading was stopped by ReadInterrupt() (e.g. on a timeout).
+     */
+    TBool ClosedBeforeData() const;
+    // IReaderSource
+    void Read(Bwx& aBuffer);
+    void ReadFlush();
+    void ReadInterrupt();
+private:
+    SocketTcp& iSocket;
+    TBool iReceived;
+    TBool iClosed;
+    TBool iInterrupted;
+};
+
+/// Tcp Session
+
+class SocketTcpServer;
+
+class SocketTcpSession : public SocketTcp /// Derive from this class to instantiate tcp server behaviour
+{
+    friend class SocketTcpServer;
+public:
+    // IReaderSource
+    /**
+     * As SocketTcp but returns any bytes the server read while this connection
+     * was parked before reading from the socket again
+     */
+    void Read(Bwx& aBuffer);
+    void Read(Bwx& aBuffer, TUint aBytes);
+protected:
+    SocketTcpSession();
+    virtual void Run() = 0;
+    virtual ~SocketTcpSession();
+    /**
+     * Returns true if the server can hold this session's connection open between requests
+     * (only possible once the server parks connections)
+     */
+    TBool KeepAliveSupported() const;
+    /**
+     * Ask for the connection to be parked rather than closed when Run() returns.
+     *
+     * aUnread holds any bytes the session has buffered but not yet processed (e.g. a
+     * pipelined request); these are returned by the first Read()s of the next Run().
+     * Ignored, so the connection is closed as normal, if keep-alive isn't supported or
+     * there are more than SocketTcpServer::kMaxPrefetchBytes unread bytes.
+     */
+    void KeepAlive(const Brx& aUnread);
+private:
+    void Add(SocketTcpServer& aServer, const TChar* aName, TUint aPriority, TUint aStackBytes);
+    void Start();
+    void Open(THandle aHandle);
+    void Close();
+    TBool Park();
+    TUint ReadPrefetched(Bwx& aBuffer, TUint aBytes);
+private:
+    Mutex iMutex;
+    TBool iOpen;
+    TBool iKeepAlive;
+    SocketTcpServer* iServer;
+    ThreadFunctor* iThread;
+    Bwh iPrefetch;
+    TUint iPrefetchOffset;
+};
+
+// Tcp Server
+
+class SocketTcpParked;
+
+class SocketTcpServer : public Socket
+{
+    friend class SocketTcpSession;
+public:
+    static const TUint kMaxPrefetchBytes = 8 * 1024;
+public:
+    SocketTcpServer(const TChar* aName, TUint aPort, TIpAddress aInterface, TUint aSessionPriority = kPriorityHigh,
+                    TUint aSessionStackBytes = Thread::kDefaultStackBytes, TUint aSlots = 10);
+    /**
+     * Park idle connections on a NetworkReactor rather than tying up a session per connection.
+     *
+     * A single thread accepts up to aMaxConnections connections and reads from each until
+     * aRequestTerminator (e.g. "\r\n\r\n" for http) or kMaxPrefetchBytes has arrived.  Only
+     * then is the connection passed to a session, whose Read()s return the prefetched bytes first.
+     * Connections which don't deliver a request within aTimeoutMs are closed.
+     *
+     * Must be called before any sessions are Add()ed.  Returns false, leaving the server
+     * dedicating a session to each connection, on platforms with no reactor support.
+     */
+    TBool ParkConnections(TUint aMaxConnections, const Brx& aRequestTerminator, TUint aTimeoutMs);
+    // Add is not thread safe, but why would you want that?
+    void Add(const TChar* aName, SocketTcpSession* aSession, TInt aPriorityOffset = 0);
+    TUint Port() const { return iPort; }
+    TIpAddress Interface() const { return iInterface; }
+    ~SocketTcpServer(); // Closes the server
+private:
+    TBool Terminating();            // indicates server is in process of being destroyed
+    THandle Accept(Bwx& aPrefetch); // accept a connection and return the session handle plus any bytes already read from it
+    THandle AcceptParked(Bwx& aPrefetch);
+    TBool Park(THandle aHandle, const Brx& aPending); // return a kept-alive connection to the reactor
+    SocketTcpParked* ClaimConnectionLocked();
+    void ReactorRun();
+    void ReactorAccept();
+    void ReactorRead(SocketTcpParked* aConnection);
+    void ReactorReady(SocketTcpParked* aConnection);
+    void ReactorResume();
+    void ReactorSweep();
+    void ReactorRelease(SocketTcpParked* aConnection);
+    void ReactorFree(SocketTcpParked* aConnection);
+private:
+    static const TUint kMaxReactorEvents = 16;
+    static const TUint kReactorSweepMs = 1000;
+    Mutex iMutex;                   // allows one thread to accept at a time; guards connection lists when parking
+    TUint iSessionPriority;         // priority given to all session threads
+    TUint iSessionStackBytes;       // stack bytes given to all session threads
+    TBool iTerminating;
+    typedef std::vector<SocketTcpSession*> Vector;
+    Vector iVector;
+    TUint iPort;
+    TIpAddress iInterface;
+    // only used once ParkConnections() has been called
+    NetworkReactor* iReactor;
+    ThreadFunctor* iReactorThread;
+    Bwh iRequestTerminator;
+    TUint iParkTimeoutMs;
+    TUint iMaxConnections;
+    TBool iListening;               // listening socket is armed in iReactor
+    TBool iAcceptFailed;            // accept failed (e.g. no free file descriptors); wait for the next sweep before retrying
+    std::vector<SocketTcpParked*> iConnections;     // all connections ever allocated, owned by the server
+    std::vector<SocketTcpParked*> iConnectionsFree;
+    std::vector<SocketTcpParked*> iConnectionsReturned;  // kept alive by sessions, waiting to be added to iReactor
+    std::vector<SocketTcpParked*> iConnectionsPending;   // only used by the reactor thread
+    FifoLiteDynamic<SocketTcpParked*>* iConnectionsReady;
+    Semaphore iSemReady;
+};
+
+// general udp socket;
+
+class SocketUdpBase : public Socket
+{
+public:
+    void SetTtl(TUint aTtl);
+    void Send(const Brx& aBuffer, const Endpoint& aEndpoint);
+    Endpoint Receive(Bwx& aBuffer);
+    TUint Port() const;
+    ~SocketUdpBase();
+protected:
+    SocketUdpBase();
+protected:
+    TUint iPort;
+};
+
+class SocketUdp : public SocketUdpBase
+{
+public:
+    SocketUdp(); // lets the os select a port
+    SocketUdp(TUint aPort); // stipulate a port
+    SocketUdp(TUint aPort, TIpAddress aInterface); // stipulate a port and an interface
+private:
+    void Bind(TUint aPort, TIpAddress aInterface);
+};
+
+// multicast receiver
+class SocketUdpMulticast : public SocketUdpBase
+{
+public:
+    SocketUdpMulticast(TIpAddress aInterface, const Endpoint& aEndpoint);
+    ~SocketUdpMulticast();
+private:
+    TIpAddress iInterface;
+    TIpAddress iAddress;
+};
+
+/**
+ * Utility class which enforces the Read() - ReadFlush() useage pattern
+ * This class may be useful to subclasses of SocketUdpClient or
+ * SocketUdpMulticast but its use is entirely optional
+ */
+class UdpReader : public IReaderSource, public INonCopyable
+{
+public:
+    UdpReader(SocketUdpBase& aSocket);
+    Endpoint Sender() const; // sender of last completed Read()
+    virtual void Read(Bwx& aBuffer);
+    virtual void ReadFlush();
+    virtual void ReadInterrupt();
+protected:
+    SocketUdpBase& iSocket;
+private:
+    Endpoint iSender;
+    TBool iOpen;
+};
+
+/**
+ * Utility class which enforces the Write() - WriteFlush() useage pattern
+ * This class may be useful to subclasses of SocketUdp or SocketUdpMulticast
+ */
+class UdpWriter : public IWriter, public INonCopyable
+{
+public:
+    UdpWriter(SocketUdpBase& aSocket, const Endpoint& aEndpoint);
+    virtual void Write(TByte aValue);
+    virtual void Write(const Brx& aBuffer);
+    virtual void WriteFlush();
+private:
+    SocketUdpBase& iSocket;
+    Endpoint iEndpoint;
+    TBool iOpen;
+};
+
+} // namespace OpenHome
+
+#endif // HEADER_NETWORK
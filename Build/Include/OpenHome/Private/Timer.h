@@ -0,0 +1,110 @@
+#ifndef HEADER_TIMER
+#define HEADER_TIMER
+
+#include <OpenHome/Private/Standard.h>
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Private/Thread.h>
+#include <OpenHome/Functor.h>
+
+#include <vector>
+#include <deque>
+
+namespace OpenHome {
+
+class Time
+{
+public:
+    static TUint Now();
+    static TBool IsBeforeOrAt(TUint aQuestionableTime, TUint aTime);
+    static TBool IsAfter(TUint aQuestionableTime, TUint aTime);
+    static TBool IsInPastOrNow(TUint aTime);
+    static TBool IsInFuture(TUint aTime);
+    static TInt TimeToWaitFor(TUint aTime);
+};
+
+class Timer : private INonCopyable
+{
+    friend class TimerManager;
+public:
+    Timer(Functor aFunctor);
+    void FireIn(TUint aTime); // Relative (milliseconds from now)
+    void FireAt(TUint aTime); // Absolute (at specified millisecond)
+    /**
+     * Stop a pending timer.
+     * If the timer's callback is running on another thread, blocks until it completes.
+     * (So a callback must not Cancel() a timer whose callback may be Cancel()ing it.)
+     */
+    void Cancel();
+    ~Timer();
+    static TBool IsInManagerThread(); // true if the caller is running a timer callback
+private:
+    Functor iFunctor;
+    TUint iTime;  // Absolute (milliseconds from startup)
+    TUint iIndex; // position in TimerManager's heap or TimerManager::kNotQueued
+    TBool iDispatched; // expired and waiting for a callback thread
+};
+
+/**
+ * Owns all pending Timers and runs their callbacks.
+ *
+ * Pending timers are held in a 4-ary min-heap ordered on expiry time so adding,
+ * moving or cancelling a timer costs O(log n) rather than the O(n) list insertion
+ * of a sorted queue.  Timers record their heap index so can be removed in place.
+ *
+ * By default, callbacks run on the manager's own thread.  If aNumCallbackThreads
+ * is non-zero, expired timers are instead handed to a pool of that many threads so
+ * that one slow callback doesn't delay all other timers.  A timer's callback never
+ * runs concurrently with itself.
+ */
+class TimerManager
+{
+    friend class Timer;
+public:
+    TimerManager(TUint aNumCallbackThreads = 0);
+    void Stop();
+    ~TimerManager();
+private:
+    class CallbackThread
+    {
+    public:
+        CallbackThread(OpenHome::Thread* aThread);
+    public:
+        OpenHome::Thread* iThread;
+        Timer* iTimer;  // timer whose callback is running, NULL if idle or if the timer was cancelled by its own callback
+        TBool iRefire;  // iTimer expired again while its callback was running
+    };
+private:
+    void Add(Timer& aTimer, TUint aTime);
+    void Remove(Timer& aTimer);
+    void Run();
+    void RunCallbacks();
+    void Fire();
+    TBool IsCallbackThread(OpenHome::Thread* aThread) const;
+    void DispatchLocked(Timer& aTimer);
+    void RunCallbackLocked(CallbackThread& aCallbackThread, Timer& aTimer);
+    void RemoveLocked(Timer& aTimer);
+    Timer* RemoveHeadLocked(TUint aNow);
+    void Place(Timer& aTimer, TUint aIndex);
+    void SiftUp(TUint aIndex);
+    void SiftDown(TUint aIndex);
+    TBool IsEarlier(TUint aIndex1, TUint aIndex2) const;
+private:
+    static const TUint kNotQueued = 0xffffffff;
+    static const TUint kArity = 4;
+    std::vector<Timer*> iTimers; // heap, guarded by iMutex
+    std::deque<Timer*> iDispatched; // expired timers waiting for a callback thread, guarded by iMutex
+    ThreadFunctor* iThread;
+    std::vector<ThreadFunctor*> iPool;
+    std::vector<CallbackThread> iCallbackThreads; // iThread when iPool is empty, iPool otherwise
+    Semaphore iSemaphore;
+    Semaphore iDispatchSem;
+    Semaphore iCallbackComplete;
+    TUint iCancelWaiters;
+    Mutex iMutex;
+    TBool iStop;
+    Semaphore iStopped;
+};
+
+} // namespace OpenHome
+
+#endif // HEADER_TIMER
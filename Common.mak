@@ -25,6 +25,7 @@ objects_core = \
 	$(objdir)Discovery.$(objext) \
 	$(objdir)Debug.$(objext) \
 	$(objdir)Converter.$(objext) \
+	$(objdir)Deflate.$(objext) \
 	$(objdir)CpDeviceCore.$(objext) \
 	$(objdir)CpDeviceC.$(objext) \
 	$(objdir)CpDeviceStd.$(objext) \
@@ -83,6 +84,7 @@ objects_core = \
 	$(objdir)Printer.$(objext) \
 	$(objdir)ProtocolUpnp.$(objext) \
 	$(objdir)Queue.$(objext) \
+	$(objdir)ReactorHttp.$(objext) \
 	$(objdir)RefCounter.$(objext) \
 	$(objdir)Service.$(objext) \
 	$(objdir)ServiceC.$(objext) \
@@ -124,8 +126,10 @@ headers = \
 	$(inc_build)/OpenHome/OsWrapper.inl \
 	$(inc_build)/OpenHome/Private/Arch.h \
 	$(inc_build)/OpenHome/Private/Ascii.h \
+	$(inc_build)/OpenHome/Private/Atomic.h \
 	$(inc_build)/OpenHome/Private/Converter.h \
 	$(inc_build)/OpenHome/Private/Debug.h \
+	$(inc_build)/OpenHome/Private/Deflate.h \
 	$(inc_build)/OpenHome/Private/Fifo.h \
 	$(inc_build)/OpenHome/Private/Http.h \
 	$(inc_build)/OpenHome/Private/Maths.h \
@@ -163,6 +167,7 @@ headers = \
 	$(inc_build)/OpenHome/Net/Private/FunctorCpiDevice.h \
 	$(inc_build)/OpenHome/Net/Private/FunctorDviInvocation.h \
 	$(inc_build)/OpenHome/Net/Private/ProtocolUpnp.h \
+	$(inc_build)/OpenHome/Net/Private/ReactorHttp.h \
 	$(inc_build)/OpenHome/Net/Private/Service.h \
 	$(inc_build)/OpenHome/Net/Private/Ssdp.h \
 	$(inc_build)/OpenHome/Net/Private/Stack.h \
@@ -220,6 +225,8 @@ $(objdir)Buffer.$(objext) : OpenHome/Buffer.cpp $(headers)
 	$(compiler)Buffer.$(objext) -c $(cflags) $(includes) OpenHome/Buffer.cpp
 $(objdir)Converter.$(objext) : OpenHome/Converter.cpp $(headers)
 	$(compiler)Converter.$(objext) -c $(cflags) $(includes) OpenHome/Converter.cpp
+$(objdir)Deflate.$(objext) : OpenHome/Deflate.cpp $(headers)
+	$(compiler)Deflate.$(objext) -c $(cflags) $(includes) OpenHome/Deflate.cpp
 $(objdir)Discovery.$(objext) : OpenHome/Net/Discovery.cpp $(headers)
 	$(compiler)Discovery.$(objext) -c $(cflags) $(includes) OpenHome/Net/Discovery.cpp
 $(objdir)Debug.$(objext) : OpenHome/Debug.cpp $(headers)
@@ -338,6 +345,8 @@ $(objdir)ProtocolUpnp.$(objext) : OpenHome/Net/ControlPoint/Upnp/ProtocolUpnp.cp
 	$(compiler)ProtocolUpnp.$(objext) -c $(cflags) $(includes) OpenHome/Net/ControlPoint/Upnp/ProtocolUpnp.cpp
 $(objdir)Queue.$(objext) : OpenHome/Queue.cpp $(headers)
 	$(compiler)Queue.$(objext) -c $(cflags) $(includes) OpenHome/Queue.cpp
+$(objdir)ReactorHttp.$(objext) : OpenHome/Net/ReactorHttp.cpp $(headers)
+	$(compiler)ReactorHttp.$(objext) -c $(cflags) $(includes) OpenHome/Net/ReactorHttp.cpp
 $(objdir)RefCounter.$(objext) : OpenHome/RefCounter.cpp $(headers)
 	$(compiler)RefCounter.$(objext) -c $(cflags) $(includes) OpenHome/RefCounter.cpp
 $(objdir)Service.$(objext) : OpenHome/Net/Service.cpp $(headers)
@@ -448,6 +457,14 @@ $(objdir)TestTextUtils.$(objext) : OpenHome/Tests/TestTextUtils.cpp $(headers)
 $(objdir)TestTextUtilsMain.$(objext) : OpenHome/Tests/TestTextUtilsMain.cpp $(headers)
 	$(compiler)TestTextUtilsMain.$(objext) -c $(cflags) $(includes) OpenHome/Tests/TestTextUtilsMain.cpp
 
+TestDeflate: $(objdir)TestDeflate.$(exeext) 
+$(objdir)TestDeflate.$(exeext) :  ohNetCore $(objdir)TestDeflate.$(objext) $(objdir)TestDeflateMain.$(objext) $(libprefix)TestFramework.$(libext)
+	$(link) $(linkoutput)$(objdir)TestDeflate.$(exeext) $(objdir)TestDeflateMain.$(objext) $(objdir)TestDeflate.$(objext) $(objdir)$(libprefix)TestFramework.$(libext) $(objdir)$(libprefix)ohNetCore.$(libext)
+$(objdir)TestDeflate.$(objext) : OpenHome/Tests/TestDeflate.cpp $(headers)
+	$(compiler)TestDeflate.$(objext) -c $(cflags) $(includes) OpenHome/Tests/TestDeflate.cpp
+$(objdir)TestDeflateMain.$(objext) : OpenHome/Tests/TestDeflateMain.cpp $(headers)
+	$(compiler)TestDeflateMain.$(objext) -c $(cflags) $(includes) OpenHome/Tests/TestDeflateMain.cpp
+
 TestEcho: $(objdir)TestEcho.$(exeext) 
 $(objdir)TestEcho.$(exeext) :  ohNetCore $(objdir)TestEcho.$(objext) $(libprefix)TestFramework.$(libext)
 	$(link) $(linkoutput)$(objdir)TestEcho.$(exeext) $(objdir)TestEcho.$(objext) $(objdir)$(libprefix)TestFramework.$(libext) $(objdir)$(libprefix)ohNetCore.$(libext)
@@ -689,6 +706,7 @@ tests_core = \
 	$(objdir)TestFifo.$(objext) \
 	$(objdir)TestQueue.$(objext) \
 	$(objdir)TestTextUtils.$(objext) \
+	$(objdir)TestDeflate.$(objext) \
 	$(objdir)TestNetwork.$(objext) \
 	$(objdir)TestTimer.$(objext) \
 	$(objdir)TestSsdpMListen.$(objext) \
@@ -709,7 +727,7 @@ tests_core = \
 TestsCore: $(tests_core)
 	$(ar)ohNetTestsCore.$(libext) $(tests_core)
 
-TestsNative: TestBuffer TestThread TestFifo TestQueue TestTextUtils TestMulticast TestNetwork TestEcho TestTimer TestSsdpMListen TestSsdpUListen TestDeviceList TestDeviceListStd TestDeviceListC TestInvocation TestInvocationStd TestSubscription TestProxyC TestDviDiscovery TestDviDeviceList TestDvInvocation TestDvSubscription TestDvLights TestDvTestBasic TestAdapterChange TestDeviceFinder TestDvDeviceStd TestDvDeviceC TestCpDeviceDv TestCpDeviceDvStd TestCpDeviceDvC TestShell
+TestsNative: TestBuffer TestThread TestFifo TestQueue TestTextUtils TestDeflate TestMulticast TestNetwork TestEcho TestTimer TestSsdpMListen TestSsdpUListen TestDeviceList TestDeviceListStd TestDeviceListC TestInvocation TestInvocationStd TestSubscription TestProxyC TestDviDiscovery TestDviDeviceList TestDvInvocation TestDvSubscription TestDvLights TestDvTestBasic TestAdapterChange TestDeviceFinder TestDvDeviceStd TestDvDeviceC TestCpDeviceDv TestCpDeviceDvStd TestCpDeviceDvC TestShell
 
 TestsCs: TestProxyCs TestDvDeviceCs TestDvLightsCs TestCpDeviceDvCs TestPerformanceDv TestPerformanceCp TestPerformanceDvCs TestPerformanceCpCs
 
@@ -3,8 +3,84 @@
 #include <OpenHome/Buffer.h>
 #include <OpenHome/Private/Stream.h>
 
+#include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define CONVERTER_SSE2
+# include <emmintrin.h>
+#endif
+
 using namespace OpenHome;
 
+// Scanning for the next byte which (un)escaping has to look at.
+// Runs of other bytes can then be copied in bulk.
+// Lead bytes of multi-byte utf-8 chars are always reported as the (malformed) bytes
+// following them are passed through unaltered.
+
+static inline TBool IsUtf8Lead(TByte aChar)
+{
+    return ((aChar & 0xC0) == 0xC0);
+}
+
+static inline TBool IsXmlReserved(TByte aChar)
+{
+    return (aChar == '<' || aChar == '>' || aChar == '&' || aChar == '\'' || aChar == '\"' || IsUtf8Lead(aChar));
+}
+
+static inline TBool IsXmlEntityStart(TByte aChar)
+{
+    return (aChar == '&' || IsUtf8Lead(aChar));
+}
+
+// returns the number of bytes at the start of aPtr which can be written without escaping
+static TUint XmlUnreservedBytes(const TByte* aPtr, TUint aBytes)
+{
+    TUint i = 0;
+#ifdef CONVERTER_SSE2
+    const __m128i lt = _mm_set1_epi8('<');
+    const __m128i gt = _mm_set1_epi8('>');
+    const __m128i amp = _mm_set1_epi8('&');
+    const __m128i apos = _mm_set1_epi8('\'');
+    const __m128i quot = _mm_set1_epi8('\"');
+    const __m128i lead = _mm_set1_epi8((char)0xC0);
+    for (; i+16 <= aBytes; i+=16) {
+        const __m128i block = _mm_loadu_si128((const __m128i*)(aPtr + i));
+        __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(block, lt), _mm_cmpeq_epi8(block, gt));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, amp));
+        hits = _mm_or_si128(hits, _mm_or_si128(_mm_cmpeq_epi8(block, apos), _mm_cmpeq_epi8(block, quot)));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(_mm_max_epu8(block, lead), block)); // >= 0xC0
+        if (_mm_movemask_epi8(hits) != 0) {
+            break;
+        }
+    }
+#endif
+    while (i < aBytes && !IsXmlReserved(aPtr[i])) {
+        i++;
+    }
+    return i;
+}
+
+// returns the number of bytes at the start of aPtr which can't be part of an escape sequence
+static TUint XmlUnescapedBytes(const TByte* aPtr, TUint aBytes)
+{
+    TUint i = 0;
+#ifdef CONVERTER_SSE2
+    const __m128i amp = _mm_set1_epi8('&');
+    const __m128i lead = _mm_set1_epi8((char)0xC0);
+    for (; i+16 <= aBytes; i+=16) {
+        const __m128i block = _mm_loadu_si128((const __m128i*)(aPtr + i));
+        const __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(block, amp),
+                                          _mm_cmpeq_epi8(_mm_max_epu8(block, lead), block)); // >= 0xC0
+        if (_mm_movemask_epi8(hits) != 0) {
+            break;
+        }
+    }
+#endif
+    while (i < aBytes && !IsXmlEntityStart(aPtr[i])) {
+        i++;
+    }
+    return i;
+}
+
 void Converter::ToXmlEscaped(IWriter& aWriter, TByte aValue)
 {
     switch (aValue) {
@@ -50,7 +126,19 @@ TBool Converter::IsMultiByteChar(TByte aChar, TUint& aBytes)
 void Converter::ToXmlEscaped(IWriter& aWriter, const Brx& aValue)
 {
     TUint utf8CharBytesRemaining = 0;
-    for(TUint i = 0; i < aValue.Bytes(); ++i) {
+    const TByte* ptr = aValue.Ptr();
+    const TUint bytes = aValue.Bytes();
+    for(TUint i = 0; i < bytes; ++i) {
+        if (utf8CharBytesRemaining == 0) {
+            const TUint unreserved = XmlUnreservedBytes(ptr + i, bytes - i);
+            if (unreserved > 0) {
+                aWriter.Write(Brn(ptr + i, unreserved));
+                i += unreserved;
+                if (i == bytes) {
+                    break;
+                }
+            }
+        }
         TByte ch = aValue[i];
         if (utf8CharBytesRemaining == 0) {
             TUint bytes;
@@ -179,8 +267,25 @@ void Converter::FromXmlEscaped(Bwx& aValue)
     TUint j = 0;
     TUint bytes = aValue.Bytes();
     TUint utf8CharBytesRemaining = 0;
+    if (bytes == 0) {
+        return;
+    }
+    TByte* ptr = &aValue[0];
 
     for (TUint i = 0; i < bytes; i++) {
+        if (utf8CharBytesRemaining == 0) {
+            const TUint unescaped = XmlUnescapedBytes(ptr + i, bytes - i);
+            if (unescaped > 0) {
+                if (j != i) {
+                    (void)memmove(ptr + j, ptr + i, unescaped);
+                }
+                i += unescaped;
+                j += unescaped;
+                if (i == bytes) {
+                    break;
+                }
+            }
+        }
         TByte ch = aValue[i];
         if (utf8CharBytesRemaining == 0) {
             TUint bytes;
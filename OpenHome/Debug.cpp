@@ -28,16 +28,6 @@ void Debug::RemoveLevel(TUint aLevel)
     iLevel &= ~aLevel;
 }
 
-TBool Debug::TestLevel(TUint aLevel)
-{
-    if ((iLevel & aLevel) != 0) 
-    {
-        return true;
-    }
-    
-    return false;   
-}
-
 TBool Debug::BreakBeforeThrow()
 {
     return iBreak;
@@ -52,12 +42,12 @@ AutoLog::AutoLog(TUint aLevel, const TChar* aString)
     : iLevel(aLevel)
     , iString(aString)
 {
-    if( OpenHome::Debug::TestLevel(iLevel) )
-        OpenHome::Log::Print(">%s\n", iString);
+    if( LOG_ENABLED(iLevel) )
+        OpenHome::Log::Trace(">%s\n", iString);
 }
 
 AutoLog::~AutoLog()
 {
-    if( OpenHome::Debug::TestLevel(iLevel) )
-        OpenHome::Log::Print("<%s\n", iString);
+    if( LOG_ENABLED(iLevel) )
+        OpenHome::Log::Trace("<%s\n", iString);
 }
@@ -19,64 +19,74 @@ private:
     const OpenHome::TChar* iString;
 };
 
+// Levels which can be enabled at run time.  Logging for any other level is compiled out.
+// Override by defining DEFINE_TRACE_LEVELS, e.g. -DDEFINE_TRACE_LEVELS="kError|kDvInvocation"
+#ifndef DEFINE_TRACE_LEVELS
+# define DEFINE_TRACE_LEVELS kAll|kVerbose
+#endif
+
 #ifdef DEFINE_TRACE
+    #define LOG_ENABLED(aLevel) \
+        ((OpenHome::Debug::kCompiledLevels & (aLevel)) != 0 && OpenHome::Debug::TestLevel(aLevel))
     #define LOG(x,...) \
-        {if(OpenHome::Debug::TestLevel(OpenHome::Debug::x)) \
+        {if(LOG_ENABLED(OpenHome::Debug::x)) \
          { \
-            OpenHome::Log::Print(__VA_ARGS__); \
+            OpenHome::Log::Trace(__VA_ARGS__); \
          } \
         }
     #define LOG2(x,y,...) \
-        {if(OpenHome::Debug::TestLevel(OpenHome::Debug::x|OpenHome::Debug::y)) \
+        {if(LOG_ENABLED(OpenHome::Debug::x|OpenHome::Debug::y)) \
          { \
-            OpenHome::Log::Print(__VA_ARGS__); \
+            OpenHome::Log::Trace(__VA_ARGS__); \
          } \
         }
     #define LOG3(x,y,z,...) \
-        {if(OpenHome::Debug::TestLevel(OpenHome::Debug::x|OpenHome::Debug::y|OpenHome::Debug::z)) \
+        {if(LOG_ENABLED(OpenHome::Debug::x|OpenHome::Debug::y|OpenHome::Debug::z)) \
          { \
-            OpenHome::Log::Print(__VA_ARGS__); \
+            OpenHome::Log::Trace(__VA_ARGS__); \
          } \
         }
     #define LOG2F(x,y,...) \
-        {if(OpenHome::Debug::TestLevel(OpenHome::Debug::x|OpenHome::Debug::y)) \
+        {if(LOG_ENABLED(OpenHome::Debug::x|OpenHome::Debug::y)) \
          { \
-            OpenHome::Log::Print("%s:%d: ",__FILE__,__LINE__); \
-            OpenHome::Log::Print(__VA_ARGS__); \
+            OpenHome::Log::Trace("%s:%d: ",__FILE__,__LINE__); \
+            OpenHome::Log::Trace(__VA_ARGS__); \
          } \
         }
     #define LOGF(x,...) \
-        {if(OpenHome::Debug::TestLevel(OpenHome::Debug::x)) \
+        {if(LOG_ENABLED(OpenHome::Debug::x)) \
          { \
-            OpenHome::Log::Print("%s:%d: ",__FILE__,__LINE__); \
-            OpenHome::Log::Print(__VA_ARGS__); \
+            OpenHome::Log::Trace("%s:%d: ",__FILE__,__LINE__); \
+            OpenHome::Log::Trace(__VA_ARGS__); \
          } \
         }
     #define LOGT(x,...) \
-        {if(OpenHome::Debug::TestLevel(OpenHome::Debug::x)) \
+        {if(LOG_ENABLED(OpenHome::Debug::x)) \
          { \
             const Brx& name = OpenHome::Thread::CurrentThreadName(); \
-            OpenHome::Log::Print("T:%c%c%c%c:",name[0],name[1],name[2],name[3]); \
-            OpenHome::Log::Print(__VA_ARGS__); \
+            OpenHome::Log::Trace("T:%c%c%c%c:",name[0],name[1],name[2],name[3]); \
+            OpenHome::Log::Trace(__VA_ARGS__); \
          } \
         }
     #define LOG_HEX(x,aBrx) \
-        {if(OpenHome::Debug::TestLevel(OpenHome::Debug::x)) \
+        {if(LOG_ENABLED(OpenHome::Debug::x)) \
          { \
             OpenHome::Log::PrintHex(aBrx); \
          } \
         }
     #define LOGF_HEX(x,aBrx) \
-        {if(OpenHome::Debug::TestLevel(OpenHome::Debug::x)) \
+        {if(LOG_ENABLED(OpenHome::Debug::x)) \
          { \
-            OpenHome::Log::Print("%s:%d: ",__FILE__,__LINE__); \
+            OpenHome::Log::Trace("%s:%d: ",__FILE__,__LINE__); \
             OpenHome::Log::PrintHex(aBrx); \
          } \
         }
     #define LOGFUNC(x) \
         AutoLog localAutolog(OpenHome::Debug::x , __PRETTY_FUNCTION__)
 #else //DEFINE_TRACE
+    #define LOG_ENABLED(aLevel) false
     #define LOG(x,...)
+    #define LOG3(x,y,z,...)
     #define LOGF(x,...)
     #define LOGT(x,...)
     #define LOG2(x,y,...)
@@ -117,7 +127,9 @@ public:
     static const TUint kAll            = 0x7FFFFFFF;
     static const TUint kVerbose        = 0x80000000;
 
-    static TBool TestLevel(TUint aLevel);
+    static const TUint kCompiledLevels = (DEFINE_TRACE_LEVELS);
+
+    inline static TBool TestLevel(TUint aLevel) { return ((iLevel & aLevel) != 0); }
     static TUint Level();
     static void SetLevel(TUint aLevel);
     static void AddLevel(TUint aLevel);
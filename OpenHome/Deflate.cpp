@@ -0,0 +1,273 @@
+#include <OpenHome/Private/Deflate.h>
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Private/Stream.h>
+
+using namespace OpenHome;
+
+// Single fixed-Huffman block (rfc1951, 3.2.6) fed by greedy LZ77 matching over hash chains.
+
+static const TUint kWindowBytes = 32 * 1024;
+static const TUint kHashBits = 12;
+static const TUint kHashSize = 1 << kHashBits;
+static const TUint kMinMatch = 3;
+static const TUint kMaxMatch = 258;
+static const TUint kMaxChain = 32;          // candidates checked per position
+static const TUint kNoPosition = 0xffffffff;
+
+static const TUint16 kLengthBase[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                       35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const TByte kLengthExtra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                      3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const TUint16 kDistanceBase[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                         257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                         8193, 12289, 16385, 24577 };
+static const TByte kDistanceExtra[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+namespace OpenHome {
+
+class DeflateBitWriter : private INonCopyable
+{
+public:
+    DeflateBitWriter(IWriter& aWriter);
+    void WriteBits(TUint aValue, TUint aBits);      // least significant bit first
+    void WriteHuffman(TUint aCode, TUint aBits);    // most significant bit first
+    void WriteLiteral(TUint aValue);                // 0..287 from the fixed literal/length alphabet
+    void WriteByte(TByte aValue);                   // only valid on a byte boundary
+    void AlignToByte();
+    void Flush();
+private:
+    IWriter& iWriter;
+    Bws<256> iBuf;
+    TUint32 iBits;
+    TUint iBitCount;
+};
+
+} // namespace OpenHome
+
+DeflateBitWriter::DeflateBitWriter(IWriter& aWriter)
+    : iWriter(aWriter)
+    , iBits(0)
+    , iBitCount(0)
+{
+}
+
+void DeflateBitWriter::WriteBits(TUint aValue, TUint aBits)
+{
+    iBits |= (aValue << iBitCount);
+    iBitCount += aBits;
+    while (iBitCount >= 8) {
+        if (iBuf.Bytes() == iBuf.MaxBytes()) {
+            iWriter.Write(iBuf);
+            iBuf.SetBytes(0);
+        }
+        iBuf.Append((TByte)(iBits & 0xff));
+        iBits >>= 8;
+        iBitCount -= 8;
+    }
+}
+
+void DeflateBitWriter::WriteHuffman(TUint aCode, TUint aBits)
+{
+    TUint reversed = 0;
+    for (TUint i=0; i<aBits; i++) {
+        reversed = (reversed << 1) | ((aCode >> i) & 1);
+    }
+    WriteBits(reversed, aBits);
+}
+
+void DeflateBitWriter::WriteLiteral(TUint aValue)
+{
+    if (aValue < 144) {
+        WriteHuffman(0x30 + aValue, 8);
+    }
+    else if (aValue < 256) {
+        WriteHuffman(0x190 + aValue - 144, 9);
+    }
+    else if (aValue < 280) {
+        WriteHuffman(aValue - 256, 7);
+    }
+    else {
+        WriteHuffman(0xc0 + aValue - 280, 8);
+    }
+}
+
+void DeflateBitWriter::WriteByte(TByte aValue)
+{
+    WriteBits(aValue, 8);
+}
+
+void DeflateBitWriter::AlignToByte()
+{
+    if (iBitCount > 0) {
+        WriteBits(0, 8 - iBitCount);
+    }
+}
+
+void DeflateBitWriter::Flush()
+{
+    AlignToByte();
+    if (iBuf.Bytes() > 0) {
+        iWriter.Write(iBuf);
+        iBuf.SetBytes(0);
+    }
+}
+
+
+// Deflate
+
+static inline TUint Hash(const TByte* aPtr)
+{
+    const TUint32 v = (aPtr[0] << 16) | (aPtr[1] << 8) | aPtr[2];
+    return ((v * 2654435761u) >> (32 - kHashBits)) & (kHashSize - 1);
+}
+
+static void WriteMatch(DeflateBitWriter& aBits, TUint aLength, TUint aDistance)
+{
+    TUint code = 0;
+    while (code < 28 && kLengthBase[code + 1] <= aLength) {
+        code++;
+    }
+    aBits.WriteLiteral(257 + code);
+    if (kLengthExtra[code] > 0) {
+        aBits.WriteBits(aLength - kLengthBase[code], kLengthExtra[code]);
+    }
+    code = 0;
+    while (code < 29 && kDistanceBase[code + 1] <= aDistance) {
+        code++;
+    }
+    aBits.WriteHuffman(code, 5);
+    if (kDistanceExtra[code] > 0) {
+        aBits.WriteBits(aDistance - kDistanceBase[code], kDistanceExtra[code]);
+    }
+}
+
+static void WriteUint32Le(DeflateBitWriter& aBits, TUint32 aValue)
+{
+    for (TUint i=0; i<4; i++) {
+        aBits.WriteByte((TByte)(aValue >> (8 * i)));
+    }
+}
+
+void Deflate::Compress(IWriter& aWriter, const Brx& aData, EFormat aFormat)
+{
+    DeflateBitWriter bits(aWriter);
+    if (aFormat == eZlib) {
+        bits.WriteByte(0x78); // deflate, 32k window
+        bits.WriteByte(0x01); // fastest compression; FCHECK makes the header a multiple of 31
+    }
+    else if (aFormat == eGzip) {
+        static const TByte kGzipHeader[] = { 0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, 0, 0xff };
+        for (TUint i=0; i<sizeof(kGzipHeader); i++) {
+            bits.WriteByte(kGzipHeader[i]);
+        }
+    }
+
+    bits.WriteBits(1, 1); // BFINAL
+    bits.WriteBits(1, 2); // BTYPE: fixed Huffman codes
+    const TByte* data = aData.Ptr();
+    const TUint bytes = aData.Bytes();
+    TUint* head = new TUint[kHashSize];
+    TUint* prev = new TUint[kWindowBytes];
+    for (TUint i=0; i<kHashSize; i++) {
+        head[i] = kNoPosition;
+    }
+    TUint pos = 0;
+    while (pos < bytes) {
+        TUint bestLength = 0;
+        TUint bestDistance = 0;
+        if (pos + kMinMatch <= bytes) {
+            const TUint maxLength = (bytes - pos < kMaxMatch? bytes - pos : kMaxMatch);
+            const TUint hash = Hash(&data[pos]);
+            TUint candidate = head[hash];
+            for (TUint chain=0; chain<kMaxChain && candidate != kNoPosition && pos - candidate <= kWindowBytes; chain++) {
+                if (data[candidate + bestLength] == data[pos + bestLength]) {
+                    TUint length = 0;
+                    while (length < maxLength && data[candidate + length] == data[pos + length]) {
+                        length++;
+                    }
+                    if (length > bestLength) {
+                        bestLength = length;
+                        bestDistance = pos - candidate;
+                        if (length == maxLength) {
+                            break;
+                        }
+                    }
+                }
+                const TUint next = prev[candidate % kWindowBytes];
+                if (next == kNoPosition || next >= candidate) {
+                    break;
+                }
+                candidate = next;
+            }
+        }
+        TUint advance = 1;
+        if (bestLength >= kMinMatch) {
+            WriteMatch(bits, bestLength, bestDistance);
+            advance = bestLength;
+        }
+        else {
+            bits.WriteLiteral(data[pos]);
+        }
+        const TUint end = pos + advance;
+        for (; pos<end; pos++) {
+            if (pos + kMinMatch <= bytes) {
+                const TUint hash = Hash(&data[pos]);
+                prev[pos % kWindowBytes] = head[hash];
+                head[hash] = pos;
+            }
+        }
+    }
+    delete[] prev;
+    delete[] head;
+    bits.WriteLiteral(256); // end of block
+    bits.AlignToByte();
+
+    if (aFormat == eZlib) {
+        const TUint32 adler = Adler32(aData);
+        bits.WriteByte((TByte)(adler >> 24));
+        bits.WriteByte((TByte)(adler >> 16));
+        bits.WriteByte((TByte)(adler >> 8));
+        bits.WriteByte((TByte)adler);
+    }
+    else if (aFormat == eGzip) {
+        WriteUint32Le(bits, Crc32(aData));
+        WriteUint32Le(bits, bytes);
+    }
+    bits.Flush();
+}
+
+TUint32 Deflate::Adler32(const Brx& aData)
+{
+    static const TUint32 kModulus = 65521;
+    TUint32 a = 1;
+    TUint32 b = 0;
+    const TByte* ptr = aData.Ptr();
+    TUint remaining = aData.Bytes();
+    while (remaining > 0) {
+        const TUint block = (remaining < 5552? remaining : 5552); // largest n for which b can't overflow
+        for (TUint i=0; i<block; i++) {
+            a += *ptr++;
+            b += a;
+        }
+        a %= kModulus;
+        b %= kModulus;
+        remaining -= block;
+    }
+    return (b << 16) | a;
+}
+
+TUint32 Deflate::Crc32(const Brx& aData)
+{
+    TUint32 crc = 0xffffffff;
+    const TByte* ptr = aData.Ptr();
+    const TUint bytes = aData.Bytes();
+    for (TUint i=0; i<bytes; i++) {
+        crc ^= ptr[i];
+        for (TUint j=0; j<8; j++) {
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,34 @@
+#ifndef HEADER_DEFLATE
+#define HEADER_DEFLATE
+
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Private/Stream.h>
+
+namespace OpenHome {
+
+/**
+ * Compressor for rfc1951 (deflate) data, optionally wrapped in a zlib (rfc1950) or gzip (rfc1952) container
+ *
+ * Intended for compressing small documents once so they can be served to many clients.
+ * Uses the fixed Huffman codes only, trading some compression ratio for a small,
+ * allocation-light implementation.
+ */
+class Deflate
+{
+public:
+    enum EFormat
+    {
+        eRaw
+       ,eZlib // HTTP's "deflate" content-coding
+       ,eGzip
+    };
+public:
+    static void Compress(IWriter& aWriter, const Brx& aData, EFormat aFormat);
+    static TUint32 Adler32(const Brx& aData);
+    static TUint32 Crc32(const Brx& aData);
+};
+
+} // namespace OpenHome
+
+#endif // HEADER_DEFLATE
@@ -1,4 +1,8 @@
 #include <OpenHome/Private/Fifo.h>
+#include <OpenHome/Private/Atomic.h>
+#include <OpenHome/OsWrapper.h>
+
+#include <string.h>
 
 using namespace OpenHome;
 
@@ -6,16 +10,32 @@ using namespace OpenHome;
 
 FifoBase::FifoBase(TUint aSlots)
     : iSlots(aSlots)
-    , iSlotsUsed(0)
-    , iMutexWrite("FIMW")
-    , iMutexRead("FIMR")
+    , iCapacity(1)
+    , iMask(0)
+    , iSequence(NULL)
+    , iWritePos(0)
+    , iReadPos(0)
+    , iWritersWaiting(0)
+    , iReadersWaiting(0)
+    , iInterrupted(0)
     , iSemaRead("FISR", 0)
-    , iSemaWrite("FISW", aSlots)
-    , iReadIndex(0)
-    , iWriteIndex(0)
-    , iInterrupted(false)
+    , iSemaWrite("FISW", 0)
+{
+    ASSERT(iSlots > 0 && iSlots <= 0x40000000);
+    while (iCapacity < iSlots) {
+        iCapacity <<= 1;
+    }
+    iMask = iCapacity - 1;
+    TUint* sequence = new TUint[iCapacity];
+    for (TUint i=0; i<iCapacity; i++) {
+        sequence[i] = i;
+    }
+    iSequence = sequence;
+}
+
+FifoBase::~FifoBase()
 {
-    ASSERT(iSlots > 0);
+    delete[] const_cast<TUint*>(iSequence);
 }
 
 TUint FifoBase::Slots() const
@@ -25,65 +45,251 @@ TUint FifoBase::Slots() const
 
 TUint FifoBase::SlotsFree() const
 {
-    return iSlots - iSlotsUsed;
+    return iSlots - SlotsUsed();
 }
 
 TUint FifoBase::SlotsUsed() const
 {
-    return iSlotsUsed;
+    // read position first so that a concurrent read can't make the count appear negative
+    const TUint readPos = Atomic::Load(iReadPos);
+    const TUint used = Atomic::Load(iWritePos) - readPos;
+    return (used > iSlots? iSlots : used);
 }
 
 void FifoBase::ReadInterrupt(TBool aInterrupt)
 {
-    iInterrupted = aInterrupt;
+    Atomic::Store(iInterrupted, (aInterrupt? 1 : 0));
     if (aInterrupt) {
         iSemaRead.Signal();
     }
 }
 
+TUint FifoBase::Capacity() const
+{
+    return iCapacity;
+}
+
 TUint FifoBase::WriteOpen(TUint aTimeoutMs)
 {
-    iSemaWrite.Wait(aTimeoutMs);
-    iMutexWrite.Wait();
-    TUint index = iWriteIndex++;
-    if(iWriteIndex == Slots()) {
-        iWriteIndex = 0;
-    }
-    return (index);
+    TUint index;
+    (void)WriteSpanOpen(1, index, aTimeoutMs);
+    return index;
 }
 
-void FifoBase::WriteClose()
+void FifoBase::WriteClose(TUint aIndex)
 {
-    iSlotsUsed++;
-    iMutexWrite.Signal();
-    iSemaRead.Signal();
+    WriteSpanClose(aIndex, 1);
 }
 
 TUint FifoBase::ReadOpen(TUint aTimeoutMs)
 {
-    iSemaRead.Wait(aTimeoutMs);
-    if (iInterrupted) {
-    	iInterrupted = false;
-        THROW(FifoReadError);
+    TUint index;
+    (void)ReadSpanOpen(1, index, aTimeoutMs);
+    return index;
+}
+
+void FifoBase::ReadClose(TUint aIndex)
+{
+    ReadSpanClose(aIndex, 1);
+}
+
+TUint FifoBase::WriteSpanOpen(TUint aMaxEntries, TUint& aIndex, TUint aTimeoutMs)
+{
+    ASSERT(aMaxEntries > 0);
+    TUint count = TryWriteOpen(aMaxEntries, aIndex);
+    if (count > 0) {
+        return count;
     }
-    iMutexRead.Wait();
-    TUint index = iReadIndex++;
-    if(iReadIndex == Slots()) {
-        iReadIndex = 0;
+    const TUint start = Os::TimeInMs();
+    for (;;) {
+        // register as a waiter before re-checking so that a reader can't free a slot unnoticed
+        Atomic::Add(iWritersWaiting, 1);
+        count = TryWriteOpen(aMaxEntries, aIndex);
+        if (count > 0) {
+            Unregister(iWritersWaiting);
+            return count;
+        }
+        try {
+            iSemaWrite.Wait(Remaining(aTimeoutMs, start));
+        }
+        catch (Timeout&) {
+            Unregister(iWritersWaiting);
+            throw;
+        }
+        count = TryWriteOpen(aMaxEntries, aIndex);
+        if (count > 0) {
+            return count;
+        }
     }
-    iMutexRead.Signal();
-    return (index);
 }
 
-void FifoBase::ReadClose()
+void FifoBase::WriteSpanClose(TUint aIndex, TUint aCount)
 {
-    iSlotsUsed--; // not threadsafe but then again, no use of iSlotsUsed is particularly safe (or important)
-    iSemaWrite.Signal();
+    // a single barrier publishes all entries; only this thread can update these cells
+    Atomic::Barrier();
+    for (TUint i=0; i<aCount; i++) {
+        volatile TUint& seq = iSequence[(aIndex + i) & iMask];
+        seq = seq + 1;
+    }
+    Atomic::Barrier();
+    Wake(iReadersWaiting, iSemaRead, aCount);
+}
+
+TUint FifoBase::ReadSpanOpen(TUint aMaxEntries, TUint& aIndex, TUint aTimeoutMs)
+{
+    ASSERT(aMaxEntries > 0);
+    CheckReadInterrupted();
+    TUint count = TryReadOpen(aMaxEntries, aIndex);
+    if (count > 0) {
+        return count;
+    }
+    const TUint start = Os::TimeInMs();
+    for (;;) {
+        // register as a waiter before re-checking so that a writer can't add an entry unnoticed
+        Atomic::Add(iReadersWaiting, 1);
+        count = TryReadOpen(aMaxEntries, aIndex);
+        if (count > 0) {
+            Unregister(iReadersWaiting);
+            return count;
+        }
+        try {
+            iSemaRead.Wait(Remaining(aTimeoutMs, start));
+        }
+        catch (Timeout&) {
+            Unregister(iReadersWaiting);
+            throw;
+        }
+        CheckReadInterrupted();
+        count = TryReadOpen(aMaxEntries, aIndex);
+        if (count > 0) {
+            return count;
+        }
+    }
+}
+
+void FifoBase::ReadSpanClose(TUint aIndex, TUint aCount)
+{
+    // mark the cells free for the writers which will use them on the next lap of the ring
+    Atomic::Barrier();
+    for (TUint i=0; i<aCount; i++) {
+        volatile TUint& seq = iSequence[(aIndex + i) & iMask];
+        seq = seq + iCapacity - 1;
+    }
+    Atomic::Barrier();
+    Wake(iWritersWaiting, iSemaWrite, aCount);
 }
 
 TUint FifoBase::DoPeek()
 {
-    return iReadIndex;
+    return (iReadPos & iMask);
+}
+
+TUint FifoBase::TryWriteOpen(TUint aMaxEntries, TUint& aIndex)
+{
+    TUint pos = Atomic::Load(iWritePos);
+    for (;;) {
+        const TInt used = (TInt)(pos - Atomic::Load(iReadPos));
+        if (used >= (TInt)iSlots) {
+            const TUint latest = Atomic::Load(iWritePos);
+            if (latest == pos) {
+                return 0;
+            }
+            pos = latest;
+            continue;
+        }
+        const TInt diff = (TInt)(Atomic::Load(iSequence[pos & iMask]) - pos);
+        if (diff < 0) {
+            // the cell is still being read from on the previous lap
+            return 0;
+        }
+        if (diff == 0) {
+            TUint count = 1;
+            TUint max = (used < 0? 1 : iSlots - (TUint)used);
+            if (max > aMaxEntries) {
+                max = aMaxEntries;
+            }
+            while (count < max && iSequence[(pos + count) & iMask] == pos + count) {
+                count++;
+            }
+            if (Atomic::CompareAndSwap(iWritePos, pos, pos + count)) {
+                aIndex = pos & iMask;
+                return count;
+            }
+        }
+        pos = Atomic::Load(iWritePos);
+    }
+}
+
+TUint FifoBase::TryReadOpen(TUint aMaxEntries, TUint& aIndex)
+{
+    TUint pos = Atomic::Load(iReadPos);
+    for (;;) {
+        const TInt diff = (TInt)(Atomic::Load(iSequence[pos & iMask]) - (pos + 1));
+        if (diff < 0) {
+            // empty (or the next entry is still being written)
+            return 0;
+        }
+        if (diff == 0) {
+            TUint count = 1;
+            while (count < aMaxEntries && count < iCapacity &&
+                   iSequence[(pos + count) & iMask] == pos + count + 1) {
+                count++;
+            }
+            if (Atomic::CompareAndSwap(iReadPos, pos, pos + count)) {
+                aIndex = pos & iMask;
+                return count;
+            }
+        }
+        pos = Atomic::Load(iReadPos);
+    }
+}
+
+/* Waiters register in a count before sleeping; whoever wakes one removes it from the count.
+   A waiter which finds an entry (or times out) without being woken removes itself if it
+   can, otherwise the signal meant for it is left for the next waiter, which will treat it
+   as a spurious wake and sleep again. */
+
+void FifoBase::Wake(volatile TUint& aWaiting, Semaphore& aSem, TUint aMax)
+{
+    while (aMax > 0) {
+        const TUint waiting = Atomic::Load(aWaiting);
+        if (waiting == 0) {
+            return;
+        }
+        if (Atomic::CompareAndSwap(aWaiting, waiting, waiting - 1)) {
+            aSem.Signal();
+            aMax--;
+        }
+    }
+}
+
+void FifoBase::Unregister(volatile TUint& aWaiting)
+{
+    for (;;) {
+        const TUint waiting = Atomic::Load(aWaiting);
+        if (waiting == 0 || Atomic::CompareAndSwap(aWaiting, waiting, waiting - 1)) {
+            return;
+        }
+    }
+}
+
+void FifoBase::CheckReadInterrupted()
+{
+    if (iInterrupted != 0 && Atomic::CompareAndSwap(iInterrupted, 1, 0)) {
+        THROW(FifoReadError);
+    }
+}
+
+TUint FifoBase::Remaining(TUint aTimeoutMs, TUint aStartMs)
+{
+    if (aTimeoutMs == 0) {
+        return 0; // wait forever
+    }
+    const TUint elapsed = Os::TimeInMs() - aStartMs;
+    if (elapsed >= aTimeoutMs) {
+        THROW(Timeout);
+    }
+    return aTimeoutMs - elapsed;
 }
 
 // FifoByte
@@ -94,8 +300,20 @@ FifoByte::FifoByte(TUint aSlots) : Fifo<TByte>(aSlots)
 
 void FifoByte::Write(const Brx& aBuffer)
 {
-    for (TUint i = 0; i < aBuffer.Bytes(); i++) {
-        Fifo<TByte>::Write(aBuffer.At(i));
+    const TByte* ptr = aBuffer.Ptr();
+    TUint remaining = aBuffer.Bytes();
+    while (remaining > 0) {
+        TUint index;
+        const TUint count = WriteSpanOpen(remaining, index, 0);
+        TUint first = Capacity() - index;
+        if (first > count) {
+            first = count;
+        }
+        (void)memcpy(iBuf + index, ptr, first);
+        (void)memcpy(iBuf, ptr + first, count - first);
+        WriteSpanClose(index, count);
+        ptr += count;
+        remaining -= count;
     }
 }
 
@@ -106,9 +324,18 @@ void FifoByte::Read(Bwx& aBuffer)
 
 void FifoByte::Read(Bwx& aBuffer, TUint aBytes)
 {
+    ASSERT(aBytes <= aBuffer.MaxBytes());
     aBuffer.SetBytes(0);
-    for (TUint i = 0; i < aBytes; i++) {
-        aBuffer.Append(Fifo<TByte>::Read());
+    while (aBuffer.Bytes() < aBytes) {
+        TUint index;
+        const TUint count = ReadSpanOpen(aBytes - aBuffer.Bytes(), index, 0);
+        TUint first = Capacity() - index;
+        if (first > count) {
+            first = count;
+        }
+        aBuffer.Append(iBuf + index, first);
+        aBuffer.Append(iBuf, count - first);
+        ReadSpanClose(index, count);
     }
 }
 
@@ -13,6 +13,11 @@ namespace OpenHome {
 //
 // Writer threads are blocked while the fifo is full
 // Reader threads are blocked while the fifo is empty
+//
+// Entries are held in a lock-free ring (after Dmitry Vyukov's bounded MPMC queue); each
+// cell carries a sequence number which tells writers and readers whether it is free to
+// claim.  Semaphores are only used to block threads while the fifo is full or empty and
+// are only signalled when another thread is known to be waiting on them.
 
 class FifoBase : public INonCopyable
 {
@@ -23,34 +28,52 @@ public:
     void ReadInterrupt(TBool aInterrupt=true);
 protected:
     FifoBase(TUint aSlots);
-    TUint WriteOpen(TUint aTimeoutMs);// return index of entry to write
-    void WriteClose();                // complete the write
-    TUint ReadOpen(TUint aTimeoutMs); // return index of entry to read
-    void ReadClose();                 // complete the read
-    TUint DoPeek();                   // return index of entry without removing it
+    ~FifoBase();
+    TUint Capacity() const;             // size of buffer needed by derived classes
+    TUint WriteOpen(TUint aTimeoutMs);  // return index of entry to write
+    void WriteClose(TUint aIndex);      // complete the write
+    TUint ReadOpen(TUint aTimeoutMs);   // return index of entry to read
+    void ReadClose(TUint aIndex);       // complete the read
+    TUint DoPeek();                     // return index of entry without removing it
+    // Span variants claim between 1 and aMaxEntries consecutive entries, blocking only while
+    // none are available.  They return the number claimed; entries run from aIndex and wrap
+    // to index 0 after Capacity()-1.
+    TUint WriteSpanOpen(TUint aMaxEntries, TUint& aIndex, TUint aTimeoutMs);
+    void WriteSpanClose(TUint aIndex, TUint aCount);
+    TUint ReadSpanOpen(TUint aMaxEntries, TUint& aIndex, TUint aTimeoutMs);
+    void ReadSpanClose(TUint aIndex, TUint aCount);
+private:
+    TUint TryWriteOpen(TUint aMaxEntries, TUint& aIndex);
+    TUint TryReadOpen(TUint aMaxEntries, TUint& aIndex);
+    void CheckReadInterrupted();
+    static void Wake(volatile TUint& aWaiting, Semaphore& aSem, TUint aMax);
+    static void Unregister(volatile TUint& aWaiting);
+    static TUint Remaining(TUint aTimeoutMs, TUint aStartMs);
 protected:
     TUint iSlots;
-    TUint iSlotsUsed;
-    Mutex iMutexWrite;
-    Mutex iMutexRead;
+    TUint iCapacity;    // iSlots rounded up to a power of two
+    TUint iMask;
+    volatile TUint* iSequence;
+    volatile TUint iWritePos;
+    volatile TUint iReadPos;
+    volatile TUint iWritersWaiting;
+    volatile TUint iReadersWaiting;
+    volatile TUint iInterrupted;
     Semaphore iSemaRead;
     Semaphore iSemaWrite;
-    TUint iReadIndex;
-    TUint iWriteIndex;
-    TBool iInterrupted;
 };
 
 template <class T> class Fifo : public FifoBase
 {
 public:
-    inline Fifo(TUint aSlots) : FifoBase(aSlots) { iBuf = new T[aSlots]; }
+    inline Fifo(TUint aSlots) : FifoBase(aSlots) { iBuf = new T[Capacity()]; }
     inline ~Fifo() { delete [] iBuf; }
     void Write(T aEntry);
     void Write(T aEntry, TUint aTimeoutMs);
     T Read();
     T Read(TUint aTimeoutMs);
     T Peek();
-private:
+protected:
     T* iBuf;
 };
 
@@ -61,8 +84,9 @@ template <class T> void Fifo<T>::Write(T aEntry)
 
 template <class T> void Fifo<T>::Write(T aEntry, TUint aTimeoutMs)
 {
-    iBuf[WriteOpen(aTimeoutMs)] = aEntry;
-    WriteClose();
+    TUint index = WriteOpen(aTimeoutMs);
+    iBuf[index] = aEntry;
+    WriteClose(index);
 }
 
 template <class T> T Fifo<T>::Read()
@@ -72,8 +96,9 @@ template <class T> T Fifo<T>::Read()
 
 template <class T> T Fifo<T>::Read(TUint aTimeoutMs)
 {
-    T value = iBuf[ReadOpen(aTimeoutMs)];
-    ReadClose();
+    TUint index = ReadOpen(aTimeoutMs);
+    T value = iBuf[index];
+    ReadClose(index);
     return (value);
 }
 
@@ -85,6 +110,8 @@ template <class T> T Fifo<T>::Peek()
 
 // FifoByte provides a specific TByte Fifo instantiation
 // with additional buffer write and read functions
+//
+// Buffers are copied in as few contiguous spans as possible rather than a byte at a time.
 
 class FifoByte : public Fifo<TByte>
 {
@@ -127,7 +154,7 @@ private:
 template <class T> class FifoThreshold : public FifoThresholdBase
 {
 public:
-    inline FifoThreshold(TUint aSlots, FifoThresholdObserver& aObserver): FifoThresholdBase(aSlots, aObserver) { iBuf = new T[aSlots]; }
+    inline FifoThreshold(TUint aSlots, FifoThresholdObserver& aObserver): FifoThresholdBase(aSlots, aObserver) { iBuf = new T[Capacity()]; }
     inline ~FifoThreshold() { delete [] iBuf; }
     void Write(T aEntry);
     T Read();
@@ -137,15 +164,17 @@ private:
 
 template <class T> void FifoThreshold<T>::Write(T aEntry)
 {
-    iBuf[WriteOpen()] = aEntry;
-    WriteClose();
+    TUint index = WriteOpen(0);
+    iBuf[index] = aEntry;
+    WriteClose(index);
     CheckThresholdLow();
 }
 
 template <class T> T FifoThreshold<T>::Read()
 {
-    T value = iBuf[ReadOpen(0)];
-    ReadClose();
+    TUint index = ReadOpen(0);
+    T value = iBuf[index];
+    ReadClose(index);
     CheckThresholdHigh();
     return (value);
 }
@@ -80,12 +80,15 @@ const Brn Http::kHeaderTerminator("\r\n");
 const Brn Http::kChunkedCountSeparator("\r\n");
 const Brn Http::kConnectionClose("close");
 const Brn Http::kConnectionUpgrade("upgrade");
+const Brn Http::kConnectionKeepAlive("keep-alive");
 const Brn Http::kContentLanguageEnglish("en");
 const Brn Http::kRangeBytes("bytes=");
 const Brn Http::kRangeSeparator("-");
 const Brn Http::kExpect100Continue("100-continue");
 const Brn Http::kTransferEncodingChunked("chunked");
 const Brn Http::kTransferEncodingIdentity("identity");
+const Brn Http::kContentEncodingGzip("gzip");
+const Brn Http::kContentEncodingDeflate("deflate");
 
 // Http::EVersion
 
@@ -149,6 +152,98 @@ void Http::WriteHeaderRange(WriterHttpHeader& aWriter, TUint64 aFirst, TUint64 a
     aWriter.WriteHeader(Http::kHeaderRange, buf);
 }
 
+static const TChar* kDayNames[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+static const TChar* kMonthNames[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                      "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+static void AppendPadded(Bwx& aBuffer, TUint aValue, TUint aDigits)
+{
+    Bws<Ascii::kMaxUintStringBytes> digits;
+    (void)Ascii::AppendDec(digits, aValue);
+    for (TUint i=digits.Bytes(); i<aDigits; i++) {
+        aBuffer.Append('0');
+    }
+    aBuffer.Append(digits);
+}
+
+static TUint64 DaysFromCivil(TUint aYear, TUint aMonth, TUint aDay)
+{
+    // days since 1970-01-01 in the proleptic Gregorian calendar; aYear must be >= 1970
+    const TUint y = aYear - (aMonth <= 2? 1 : 0);
+    const TUint era = y / 400;
+    const TUint yoe = y - era * 400;
+    const TUint doy = (153 * (aMonth > 2? aMonth - 3 : aMonth + 9) + 2) / 5 + aDay - 1;
+    const TUint doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return (TUint64)era * 146097 + doe - 719468;
+}
+
+void Http::AppendDate(Bwx& aBuffer, TUint64 aSecondsSinceEpoch)
+{
+    const TUint64 days = aSecondsSinceEpoch / 86400;
+    const TUint secs = (TUint)(aSecondsSinceEpoch % 86400);
+    const TUint64 z = days + 719468;
+    const TUint64 era = z / 146097;
+    const TUint doe = (TUint)(z - era * 146097);
+    const TUint yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const TUint doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const TUint mp = (5 * doy + 2) / 153;
+    const TUint day = doy - (153 * mp + 2) / 5 + 1;
+    const TUint month = (mp < 10? mp + 3 : mp - 9);
+    const TUint year = (TUint)(yoe + era * 400) + (month <= 2? 1 : 0);
+
+    aBuffer.Append(kDayNames[(days + 4) % 7]); // 1970-01-01 was a Thursday
+    aBuffer.Append(", ");
+    AppendPadded(aBuffer, day, 2);
+    aBuffer.Append(' ');
+    aBuffer.Append(kMonthNames[month - 1]);
+    aBuffer.Append(' ');
+    AppendPadded(aBuffer, year, 4);
+    aBuffer.Append(' ');
+    AppendPadded(aBuffer, secs / 3600, 2);
+    aBuffer.Append(':');
+    AppendPadded(aBuffer, (secs / 60) % 60, 2);
+    aBuffer.Append(':');
+    AppendPadded(aBuffer, secs % 60, 2);
+    aBuffer.Append(" GMT");
+}
+
+TBool Http::ParseDate(const Brx& aDate, TUint64& aSecondsSinceEpoch)
+{
+    Parser parser(aDate);
+    (void)parser.Next(','); // day name
+    Brn dayBuf = parser.Next(' ');
+    Brn monthBuf = parser.Next(' ');
+    Brn yearBuf = parser.Next(' ');
+    Brn hoursBuf = parser.Next(':');
+    Brn minutesBuf = parser.Next(':');
+    Brn secondsBuf = parser.Next(' ');
+    if (parser.Next(' ') != Brn("GMT")) {
+        return false;
+    }
+    TUint month = 0;
+    while (month < 12 && monthBuf != Brn(kMonthNames[month])) {
+        month++;
+    }
+    if (month == 12) {
+        return false;
+    }
+    try {
+        const TUint day = Ascii::Uint(dayBuf);
+        const TUint year = Ascii::Uint(yearBuf);
+        const TUint hours = Ascii::Uint(hoursBuf);
+        const TUint minutes = Ascii::Uint(minutesBuf);
+        const TUint seconds = Ascii::Uint(secondsBuf);
+        if (year < 1970 || day < 1 || day > 31 || hours > 23 || minutes > 59 || seconds > 60) {
+            return false;
+        }
+        aSecondsSinceEpoch = DaysFromCivil(year, month + 1, day) * 86400 + hours * 3600 + minutes * 60 + seconds;
+    }
+    catch (AsciiError&) {
+        return false;
+    }
+    return true;
+}
+
 void Http::WriteHeaderHost(WriterHttpHeader& aWriter, const Uri& aUri)
 {
     aWriter.WriteHeader(Http::kHeaderHost, aUri.Host());
@@ -849,6 +944,11 @@ TBool HttpHeaderConnection::Upgrade() const
     return (Received()? iUpgrade : false);
 }
 
+TBool HttpHeaderConnection::KeepAlive() const
+{
+    return (Received()? iKeepAlive : false);
+}
+
 TBool HttpHeaderConnection::Recognise(const Brx& aHeader)
 {
     return Ascii::CaseInsensitiveEquals(aHeader, Http::kHeaderConnection);
@@ -858,6 +958,7 @@ void HttpHeaderConnection::Process(const Brx& aValue)
 {
     iClose = false;
     iUpgrade = false;
+    iKeepAlive = false;
     if (aValue == Http::kConnectionClose) {
         iClose = true;
         SetReceived();
@@ -866,6 +967,10 @@ void HttpHeaderConnection::Process(const Brx& aValue)
         iUpgrade = true;
         SetReceived();
     }
+    else if (Ascii::CaseInsensitiveEquals(aValue, Http::kConnectionKeepAlive)) {
+        iKeepAlive = true;
+        SetReceived();
+    }
 }
 
 // HttpHeaderExpect
@@ -887,6 +992,225 @@ void HttpHeaderExpect::Process(const Brx& aValue)
 }
 
 
+// HttpHeaderIfNoneMatch
+
+TBool HttpHeaderIfNoneMatch::Matches(const Brx& aEntityTag) const
+{
+    if (!Received()) {
+        return false;
+    }
+    const Brn tag = OpaqueTag(aEntityTag);
+    Parser parser(iTags);
+    while (parser.Remaining().Bytes() > 0) {
+        Brn candidate = parser.Next(',');
+        if (candidate == Brn("*") || OpaqueTag(candidate) == tag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TBool HttpHeaderIfNoneMatch::Recognise(const Brx& aHeader)
+{
+    return (Ascii::CaseInsensitiveEquals(aHeader, Http::kHeaderIfNoneMatch));
+}
+
+void HttpHeaderIfNoneMatch::Process(const Brx& aValue)
+{
+    SetReceived();
+    iTags.Set(aValue);
+}
+
+Brn HttpHeaderIfNoneMatch::OpaqueTag(const Brx& aEntityTag)
+{
+    // weak comparison ignores any W/ prefix
+    Brn tag(Ascii::Trim(aEntityTag));
+    if (tag.Bytes() >= 2 && tag[0] == 'W' && tag[1] == '/') {
+        tag.Set(tag.Split(2));
+    }
+    return tag;
+}
+
+
+// HttpHeaderAcceptEncoding
+
+TBool HttpHeaderAcceptEncoding::Accepts(const Brx& aContentCoding) const
+{
+    if (!Received()) {
+        return false;
+    }
+    TBool wildcard = false;
+    Parser parser(iCodings);
+    while (parser.Remaining().Bytes() > 0) {
+        Parser element(parser.Next(','));
+        Brn coding = Ascii::Trim(element.Next(';'));
+        const TBool acceptable = !QualityIsZero(element.Remaining());
+        if (Ascii::CaseInsensitiveEquals(coding, aContentCoding)) {
+            return acceptable; // an explicit entry overrides any '*'
+        }
+        if (coding == Brn("*")) {
+            wildcard = acceptable;
+        }
+    }
+    return wildcard;
+}
+
+TBool HttpHeaderAcceptEncoding::Recognise(const Brx& aHeader)
+{
+    return (Ascii::CaseInsensitiveEquals(aHeader, Http::kHeaderAcceptEncoding));
+}
+
+void HttpHeaderAcceptEncoding::Process(const Brx& aValue)
+{
+    SetReceived();
+    iCodings.Set(aValue);
+}
+
+TBool HttpHeaderAcceptEncoding::QualityIsZero(const Brx& aParams)
+{
+    Parser parser(aParams);
+    Brn name = Ascii::Trim(parser.Next('='));
+    if (!Ascii::CaseInsensitiveEquals(name, Brn("q"))) {
+        return false;
+    }
+    Brn value = Ascii::Trim(parser.Remaining());
+    if (value.Bytes() == 0 || value[0] != '0') {
+        return false;
+    }
+    for (TUint i=1; i<value.Bytes(); i++) {
+        if (value[i] != '.' && value[i] != '0') {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// HttpHeaderIfModifiedSince
+
+TBool HttpHeaderIfModifiedSince::Modified(TUint64 aLastModified) const
+{
+    if (!Received() || !iValid) {
+        return true;
+    }
+    return (aLastModified > iSince);
+}
+
+TBool HttpHeaderIfModifiedSince::Recognise(const Brx& aHeader)
+{
+    return (Ascii::CaseInsensitiveEquals(aHeader, Http::kHeaderIfModifiedSince));
+}
+
+void HttpHeaderIfModifiedSince::Process(const Brx& aValue)
+{
+    SetReceived();
+    iValid = Http::ParseDate(aValue, iSince);
+}
+
+
+// HttpHeaderIfRange
+
+TBool HttpHeaderIfRange::Matches(const Brx& aEntityTag, TUint64 aLastModified) const
+{
+    if (!Received()) {
+        return true;
+    }
+    if (iValue.Bytes() > 0 && (iValue[0] == '"' || iValue[0] == 'W')) {
+        // entity tag; strong comparison so weak tags never match
+        return (aEntityTag.Bytes() > 0 && iValue == aEntityTag);
+    }
+    TUint64 date;
+    return (aLastModified != 0 && Http::ParseDate(iValue, date) && date == aLastModified);
+}
+
+TBool HttpHeaderIfRange::Recognise(const Brx& aHeader)
+{
+    return (Ascii::CaseInsensitiveEquals(aHeader, Http::kHeaderIfRange));
+}
+
+void HttpHeaderIfRange::Process(const Brx& aValue)
+{
+    SetReceived();
+    iValue.Set(Ascii::Trim(aValue));
+}
+
+
+// HttpHeaderRange
+
+TBool HttpHeaderRange::Valid() const
+{
+    return (Received() && iValid);
+}
+
+TBool HttpHeaderRange::Resolve(TUint aTotalBytes, TUint& aFirst, TUint& aBytes) const
+{
+    ASSERT(Valid());
+    if (iSuffix) {
+        if (iLast == 0 || aTotalBytes == 0) {
+            return false;
+        }
+        aBytes = (iLast < aTotalBytes? (TUint)iLast : aTotalBytes);
+        aFirst = aTotalBytes - aBytes;
+        return true;
+    }
+    if (iFirst >= aTotalBytes) {
+        return false;
+    }
+    aFirst = (TUint)iFirst;
+    const TUint64 last = ((iOpenEnded || iLast >= aTotalBytes)? aTotalBytes - 1 : iLast);
+    aBytes = (TUint)(last - iFirst + 1);
+    return true;
+}
+
+TBool HttpHeaderRange::Recognise(const Brx& aHeader)
+{
+    return (Ascii::CaseInsensitiveEquals(aHeader, Http::kHeaderRange));
+}
+
+void HttpHeaderRange::Process(const Brx& aValue)
+{
+    SetReceived();
+    iValid = false;
+    Brn value(Ascii::Trim(aValue));
+    if (value.Bytes() <= Http::kRangeBytes.Bytes() || value.Split(0, Http::kRangeBytes.Bytes()) != Http::kRangeBytes) {
+        return;
+    }
+    Brn spec(value.Split(Http::kRangeBytes.Bytes()));
+    TUint i = 0;
+    for (; i<spec.Bytes() && spec[i] != '-'; i++) {
+        if (spec[i] == ',') {
+            return; // multiple ranges
+        }
+    }
+    if (i == spec.Bytes()) {
+        return;
+    }
+    Brn first(Ascii::Trim(spec.Split(0, i)));
+    Brn last(Ascii::Trim(spec.Split(i + 1)));
+    for (TUint j=0; j<last.Bytes(); j++) {
+        if (last[j] == ',') {
+            return; // multiple ranges
+        }
+    }
+    try {
+        iSuffix = (first.Bytes() == 0);
+        iOpenEnded = (last.Bytes() == 0);
+        if (iSuffix && iOpenEnded) {
+            return;
+        }
+        iFirst = (iSuffix? 0 : Ascii::Uint64(first));
+        iLast = (iOpenEnded? 0 : Ascii::Uint64(last));
+        if (!iSuffix && !iOpenEnded && iLast < iFirst) {
+            return;
+        }
+    }
+    catch (AsciiError&) {
+        return;
+    }
+    iValid = true;
+}
+
+
 // HttpHeaderAccessControlRequestMethod
 
 const Brx& HttpHeaderAccessControlRequestMethod::Method() const
@@ -1004,3 +1328,8 @@ void WriterHttpChunked::WriteFlush()
     }
     iBuffer.WriteFlush();
 }
+
+void WriterHttpChunked::WriteDrain()
+{
+    iBuffer.WriteDrain();
+}
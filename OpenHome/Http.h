@@ -88,6 +88,7 @@ public:
     static const Brn kHeaderTerminator;
     static const Brn kConnectionClose;
     static const Brn kConnectionUpgrade;
+    static const Brn kConnectionKeepAlive;
     static const Brn kContentLanguageEnglish;
     static const Brn kRangeBytes;
     static const Brn kRangeSeparator;
@@ -95,6 +96,8 @@ public:
     static const Brn kChunkedCountSeparator;
     static const Brn kTransferEncodingChunked;
     static const Brn kTransferEncodingIdentity;
+    static const Brn kContentEncodingGzip;
+    static const Brn kContentEncodingDeflate;
 public:
     enum EVersion
     {
@@ -113,6 +116,9 @@ public:
     static void WriteHeaderContentLength(WriterHttpHeader& aWriter, TUint aLength);
     static void WriteHeaderContentType(WriterHttpHeader& aWriter, const Brx& aType);
     static void WriteHeaderConnectionClose(WriterHttpHeader& aWriter);
+    static void AppendDate(Bwx& aBuffer, TUint64 aSecondsSinceEpoch); // RFC 1123 date, e.g. "Sun, 06 Nov 1994 08:49:37 GMT"
+    static TBool ParseDate(const Brx& aDate, TUint64& aSecondsSinceEpoch); // returns false if aDate isn't an RFC 1123 date
+    static const TUint kMaxDateBytes = 29;
 };
 
 class HttpStatus
@@ -380,12 +386,14 @@ class HttpHeaderConnection : public HttpHeader
 public:
     TBool Close() const;
     TBool Upgrade() const;
+    TBool KeepAlive() const;
 private:
     virtual TBool Recognise(const Brx& aHeader);
     virtual void Process(const Brx& aValue);
 private:
     TBool iClose;
     TBool iUpgrade;
+    TBool iKeepAlive;
 };
 
 class HttpHeaderLocation : public HttpHeader
@@ -427,6 +435,92 @@ private:
     TBool iContinue;
 };
 
+class HttpHeaderIfNoneMatch : public HttpHeader
+{
+public:
+    /**
+     * Returns true if aEntityTag is one of the tags listed by the client (or the client sent '*').
+     * Uses the weak comparison function, as required for If-None-Match.
+     */
+    TBool Matches(const Brx& aEntityTag) const;
+private:
+    TBool Recognise(const Brx& aHeader);
+    void Process(const Brx& aValue);
+    static Brn OpaqueTag(const Brx& aEntityTag);
+private:
+    Brh iTags;
+};
+
+class HttpHeaderAcceptEncoding : public HttpHeader
+{
+public:
+    /**
+     * Returns true if the client will accept a response using aContentCoding (e.g. "gzip").
+     * Codings listed with q=0, or not listed when no '*' is present, are not acceptable.
+     */
+    TBool Accepts(const Brx& aContentCoding) const;
+private:
+    TBool Recognise(const Brx& aHeader);
+    void Process(const Brx& aValue);
+    static TBool QualityIsZero(const Brx& aParams);
+private:
+    Brh iCodings;
+};
+
+class HttpHeaderIfModifiedSince : public HttpHeader
+{
+public:
+    /**
+     * Returns true if a resource last modified at aLastModified (seconds since 1970, UTC)
+     * has changed since the client's copy.  Also true if no valid date was received.
+     */
+    TBool Modified(TUint64 aLastModified) const;
+private:
+    TBool Recognise(const Brx& aHeader);
+    void Process(const Brx& aValue);
+private:
+    TBool iValid;
+    TUint64 iSince;
+};
+
+class HttpHeaderIfRange : public HttpHeader
+{
+public:
+    /**
+     * Returns true if a Range request should be honoured for the version of the resource
+     * identified by aEntityTag (may be empty) and aLastModified (0 if unknown).
+     */
+    TBool Matches(const Brx& aEntityTag, TUint64 aLastModified) const;
+private:
+    TBool Recognise(const Brx& aHeader);
+    void Process(const Brx& aValue);
+private:
+    Brh iValue;
+};
+
+/**
+ * A single byte range.  Requests for multiple ranges are treated as though no Range was sent.
+ */
+class HttpHeaderRange : public HttpHeader
+{
+public:
+    TBool Valid() const;
+    /**
+     * Find the bytes to serve from a resource of aTotalBytes.
+     * Returns false if the range is not satisfiable.
+     */
+    TBool Resolve(TUint aTotalBytes, TUint& aFirst, TUint& aBytes) const;
+private:
+    TBool Recognise(const Brx& aHeader);
+    void Process(const Brx& aValue);
+private:
+    TBool iValid;
+    TBool iSuffix;      // last iLast bytes
+    TBool iOpenEnded;   // iFirst to the end
+    TUint64 iFirst;
+    TUint64 iLast;
+};
+
 class HttpHeaderAccessControlRequestMethod : public HttpHeader
 {
 public:
@@ -467,6 +561,7 @@ public:
     virtual void Write(TByte aValue);
     virtual void Write(const Brx& aBuffer);
     virtual void WriteFlush();
+    void WriteDrain(); // pass any buffered data on without ending the current chunked response
 private:
     Sws<kMaxBufferBytes> iBuffer;
     TBool iChunked;
@@ -59,6 +59,7 @@ LOCAL_SRC_FILES := $(ohroot)OpenHome/Ascii.cpp \
                    $(ohroot)OpenHome/Net/ControlPoint/Upnp/EventUpnp.cpp \
                    $(ohroot)OpenHome/Exception.cpp \
                    $(ohroot)OpenHome/Fifo.cpp \
+                   $(ohroot)OpenHome/Deflate.cpp \
                    $(ohroot)OpenHome/Http.cpp \
                    $(ohroot)OpenHome/Net/Device/Bonjour/mDNSCore/DNSCommon.c \
                    $(ohroot)OpenHome/Net/Device/Bonjour/mDNSCore/DNSDigest.c \
@@ -74,6 +75,7 @@ LOCAL_SRC_FILES := $(ohroot)OpenHome/Ascii.cpp \
                    $(ohroot)OpenHome/Printer.cpp \
                    $(ohroot)OpenHome/Net/ControlPoint/Upnp/ProtocolUpnp.cpp \
                    $(ohroot)OpenHome/Queue.cpp \
+                   $(ohroot)OpenHome/Net/ReactorHttp.cpp \
                    $(ohroot)OpenHome/RefCounter.cpp \
                    $(ohroot)OpenHome/Net/Service.cpp \
                    $(ohroot)OpenHome/Net/Bindings/C/ServiceC.cpp \
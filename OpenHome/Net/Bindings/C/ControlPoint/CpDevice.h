@@ -74,6 +74,17 @@ DllExport void STDCALL CpDeviceCRemoveRef(CpDeviceC aDevice);
  */
 DllExport int32_t STDCALL CpDeviceCGetAttribute(CpDeviceC aDevice, const char* aKey, char** aValue);
 
+/**
+ * Read the number of invocations on the device which are waiting to start and the
+ * number which are in progress.  Intended for diagnostics.
+ *
+ * @param[in]  aDevice       Device originally returned to a 'added' version of DeviceListChanged
+ * @param[out] aQueued       Invocations waiting for the device's limit (see
+ *                           OhNetInitParamsSetMaxInvocationsPerDevice) to allow them
+ * @param[out] aInFlight     Invocations in progress
+ */
+DllExport void STDCALL CpDeviceCGetInvocationCounts(CpDeviceC aDevice, uint32_t* aQueued, uint32_t* aInFlight);
+
 /**
  * Callback which will be run when devices are added to or removed from a protocol-specific list
  *
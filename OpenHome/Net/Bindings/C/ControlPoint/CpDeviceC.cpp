@@ -1,5 +1,6 @@
 #include <OpenHome/Net/C/CpDevice.h>
 #include <OpenHome/Net/Private/CpiDevice.h>
+#include <OpenHome/Net/Private/CpiService.h>
 
 #include <stdlib.h>
 #include <string.h>
@@ -58,6 +59,16 @@ int32_t STDCALL CpDeviceCGetAttribute(CpDeviceC aDevice, const char* aKey, char*
     return 0;
 }
 
+void STDCALL CpDeviceCGetInvocationCounts(CpDeviceC aDevice, uint32_t* aQueued, uint32_t* aInFlight)
+{
+    CpiDevice* device = reinterpret_cast<CpiDevice*>(aDevice);
+    ASSERT(device != NULL);
+    TUint queued, inFlight;
+    InvocationManager::DeviceCounters(*device, queued, inFlight);
+    *aQueued = queued;
+    *aInFlight = inFlight;
+}
+
 void STDCALL CpDeviceListDestroy(HandleCpDeviceList aListHandle)
 {
     CpiDeviceList* list = reinterpret_cast<CpiDeviceList*>(aListHandle);
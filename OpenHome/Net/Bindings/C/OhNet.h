@@ -279,7 +279,8 @@ DllExport void STDCALL OhNetInitParamsSetNumEventSessionThreads(OhNetHandleInitP
  * Set the number of threads which should be dedicated to fetching device/service XML.
  *
  * A higher number of threads will allow faster population of device lists but
- * will also require more system resources.
+ * will also require more system resources.  At most two fetches run concurrently
+ * against any one host.
  *
  * @param[in] aParams          Initialisation params
  * @param[in] aNumThreads      Number of threads.  Must be greater than zero.
@@ -297,6 +298,18 @@ DllExport void STDCALL OhNetInitParamsSetNumXmlFetcherThreads(OhNetHandleInitPar
  */
 DllExport void STDCALL OhNetInitParamsSetNumActionInvokerThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
 
+/**
+ * Set the maximum number of invocations which may be in progress on any one device.
+ *
+ * Further invocations for that device wait in a per-device queue; devices with
+ * queued invocations are served in turn so that one slow device cannot occupy
+ * every invoker thread.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aMaxInvocations  Maximum in progress per device.  Defaults to 0, meaning no limit.
+ */
+DllExport void STDCALL OhNetInitParamsSetMaxInvocationsPerDevice(OhNetHandleInitParams aParams, uint32_t aMaxInvocations);
+
 /**
  * Set the number of invocations (actions) which should be pre-allocated.
  *
@@ -310,6 +323,14 @@ DllExport void STDCALL OhNetInitParamsSetNumActionInvokerThreads(OhNetHandleInit
  */
 DllExport void STDCALL OhNetInitParamsSetNumInvocations(OhNetHandleInitParams aParams, uint32_t aNumInvocations);
 
+/**
+ * Set how long a control point waits for a device to respond to an invocation.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aTimeoutMs       Timeout in milliseconds.  Defaults to 60000.  Must be greater than zero
+ */
+DllExport void STDCALL OhNetInitParamsSetInvocationTimeout(OhNetHandleInitParams aParams, uint32_t aTimeoutMs);
+
 /**
  * Set the number of threads which should be dedicated to (un)subscribing
  * to state variables on a service + device.
@@ -322,6 +343,18 @@ DllExport void STDCALL OhNetInitParamsSetNumInvocations(OhNetHandleInitParams aP
  */
 DllExport void STDCALL OhNetInitParamsSetNumSubscriberThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
 
+/**
+ * Set the number of threads which should be dedicated to running timer callbacks.
+ *
+ * Zero (the default) runs all callbacks on a single timer thread so a slow callback
+ * delays all later timers.  A higher number bounds timer latency under load but
+ * allows callbacks for different timers to run concurrently.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aNumThreads      Number of threads.  Must be less than 100.
+ */
+DllExport void STDCALL OhNetInitParamsSetNumTimerThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
+
 /**
  * Set the duration control point subscriptions will request.
  *
@@ -369,6 +402,19 @@ DllExport void STDCALL OhNetInitParamsSetDvMaxUpdateTime(OhNetHandleInitParams a
  */
 DllExport void STDCALL OhNetInitParamsSetDvNumServerThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
 
+/**
+ * Set the maximum number of connections each tcp server will hold open while
+ * waiting for a complete request.
+ *
+ * Server threads are only assigned to connections once a full request header has
+ * arrived so this can be much higher than the number of server/event session threads.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aMaxConnections  Maximum connections per server.  0 dedicates a server
+ *                             thread to each connection for its whole lifetime.
+ */
+DllExport void STDCALL OhNetInitParamsSetMaxParkedConnections(OhNetHandleInitParams aParams, uint32_t aMaxConnections);
+
 /**
  * Set the number of threads which should be dedicated to publishing changes
  * to state variables on a service + device.
@@ -381,6 +427,30 @@ DllExport void STDCALL OhNetInitParamsSetDvNumServerThreads(OhNetHandleInitParam
  */
 DllExport void STDCALL OhNetInitParamsSetDvNumPublisherThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads);
 
+/**
+ * Set the time to wait after a state variable changes before publishing it.
+ *
+ * Further changes made to a service during this window are sent to each subscriber in
+ * the same update.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aMs              Delay in milliseconds.  0 publishes each change as soon as
+ *                             a publisher thread is free.
+ */
+DllExport void STDCALL OhNetInitParamsSetDvPublisherCoalesceMs(OhNetHandleInitParams aParams, uint32_t aMs);
+
+/**
+ * Set whether the device stack should deliver UPnP events from a single reactor
+ * thread, which can have events to many subscribers in flight at once.
+ *
+ * Publisher threads then only prepare events and never wait on the network.
+ * Ignored on platforms with no reactor support.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aEnable          1 (the default value) to enable; 0 to disable
+ */
+DllExport void STDCALL OhNetInitParamsSetDvEnableEventReactor(OhNetHandleInitParams aParams, uint32_t aEnable);
+
 /**
  * Set the number of threads which will be dedicated to published changes to state
  * variables via WebSockets.
@@ -405,6 +475,18 @@ DllExport void STDCALL OhNetInitParamsSetDvNumWebSocketThreads(OhNetHandleInitPa
  */ 
 DllExport void STDCALL OhNetInitParamsSetCpUpnpEventServerPort(OhNetHandleInitParams aParams, uint32_t aPort);
 
+/**
+ * Set whether the control point stack should run UPnP invocations on a single reactor
+ * thread, which can hold many in flight at once.
+ *
+ * Action invoker threads then only run invocation completed callbacks.
+ * Ignored on platforms with no reactor support.
+ *
+ * @param[in] aParams          Initialisation params
+ * @param[in] aEnable          1 (the default value) to enable; 0 to disable
+ */
+DllExport void STDCALL OhNetInitParamsSetCpEnableInvocationReactor(OhNetHandleInitParams aParams, uint32_t aEnable);
+
 /**
  * Set the tcp port number the device stack's UPnP web server will run on.
  *
@@ -491,6 +573,15 @@ DllExport uint32_t STDCALL OhNetInitParamsNumXmlFetcherThreads(OhNetHandleInitPa
  */
 DllExport uint32_t STDCALL OhNetInitParamsNumActionInvokerThreads(OhNetHandleInitParams aParams);
 
+/**
+ * Query the maximum number of invocations which may be in progress on any one device
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  maximum invocations per device (zero for no limit)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsMaxInvocationsPerDevice(OhNetHandleInitParams aParams);
+
 /**
  * Query the number of pre-allocated invocations
  *
@@ -500,6 +591,15 @@ DllExport uint32_t STDCALL OhNetInitParamsNumActionInvokerThreads(OhNetHandleIni
  */
 DllExport uint32_t STDCALL OhNetInitParamsNumInvocations(OhNetHandleInitParams aParams);
 
+/**
+ * Query how long a control point waits for a device to respond to an invocation
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  timeout (in milliseconds)
+ */
+DllExport uint32_t STDCALL OhNetInitParamsInvocationTimeoutMs(OhNetHandleInitParams aParams);
+
 /**
  * Query the number of subscriber threads
  *
@@ -509,6 +609,15 @@ DllExport uint32_t STDCALL OhNetInitParamsNumInvocations(OhNetHandleInitParams a
  */
 DllExport uint32_t STDCALL OhNetInitParamsNumSubscriberThreads(OhNetHandleInitParams aParams);
 
+/**
+ * Query the number of threads dedicated to running timer callbacks
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  number of threads.  Zero means callbacks run on the single timer thread
+ */
+DllExport uint32_t STDCALL OhNetInitParamsNumTimerThreads(OhNetHandleInitParams aParams);
+
 /**
  * Query the duration control points will request for subscriptions.
  *
@@ -546,6 +655,16 @@ DllExport uint32_t STDCALL OhNetInitParamsDvMaxUpdateTimeSecs(OhNetHandleInitPar
  */
 DllExport uint32_t STDCALL OhNetInitParamsDvNumServerThreads(OhNetHandleInitParams aParams);
 
+/**
+ * Query the maximum number of connections each tcp server will hold open while
+ * waiting for a complete request
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  maximum number of connections
+ */
+DllExport uint32_t STDCALL OhNetInitParamsMaxParkedConnections(OhNetHandleInitParams aParams);
+
 /**
  * Query the number of device stack publisher threads
  *
@@ -555,6 +674,24 @@ DllExport uint32_t STDCALL OhNetInitParamsDvNumServerThreads(OhNetHandleInitPara
  */
 DllExport uint32_t STDCALL OhNetInitParamsDvNumPublisherThreads(OhNetHandleInitParams aParams);
 
+/**
+ * Query the delay between a state variable changing and it being published
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  delay in milliseconds
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvPublisherCoalesceMs(OhNetHandleInitParams aParams);
+
+/**
+ * Query whether the device stack will deliver UPnP events from a reactor thread
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  1 if enabled; 0 otherwise
+ */
+DllExport uint32_t STDCALL OhNetInitParamsDvIsEventReactorEnabled(OhNetHandleInitParams aParams);
+
 /**
  * Query the number of device stack WebSocket threads
  *
@@ -573,6 +710,15 @@ DllExport uint32_t STDCALL OhNetInitParamsDvNumWebSocketThreads(OhNetHandleInitP
  */
 DllExport uint32_t STDCALL OhNetInitParamsCpUpnpEventServerPort(OhNetHandleInitParams aParams);
 
+/**
+ * Query whether the control point stack will run UPnP invocations on a reactor thread
+ *
+ * @param[in] aParams          Initialisation params
+ *
+ * @return  1 if enabled; 0 otherwise
+ */
+DllExport uint32_t STDCALL OhNetInitParamsCpIsInvocationReactorEnabled(OhNetHandleInitParams aParams);
+
 /**
  * Query the port the device stack's UPnP web server will run on.
  *
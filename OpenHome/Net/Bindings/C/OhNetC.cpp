@@ -160,18 +160,36 @@ void STDCALL OhNetInitParamsSetNumActionInvokerThreads(OhNetHandleInitParams aPa
     ip->SetNumActionInvokerThreads(aNumThreads);
 }
 
+void STDCALL OhNetInitParamsSetMaxInvocationsPerDevice(OhNetHandleInitParams aParams, uint32_t aMaxInvocations)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    ip->SetMaxInvocationsPerDevice(aMaxInvocations);
+}
+
 void STDCALL OhNetInitParamsSetNumInvocations(OhNetHandleInitParams aParams, uint32_t aNumInvocations)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
     ip->SetNumInvocations(aNumInvocations);
 }
 
+void STDCALL OhNetInitParamsSetInvocationTimeout(OhNetHandleInitParams aParams, uint32_t aTimeoutMs)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    ip->SetInvocationTimeout(aTimeoutMs);
+}
+
 void STDCALL OhNetInitParamsSetNumSubscriberThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
     ip->SetNumSubscriberThreads(aNumThreads);
 }
 
+void STDCALL OhNetInitParamsSetNumTimerThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    ip->SetNumTimerThreads(aNumThreads);
+}
+
 void STDCALL OhNetInitParamsSetSubscriptionDuration(OhNetHandleInitParams aParams, uint32_t aDurationSecs)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
@@ -208,12 +226,30 @@ void STDCALL OhNetInitParamsSetDvNumServerThreads(OhNetHandleInitParams aParams,
     ip->SetDvNumServerThreads(aNumThreads);
 }
 
+void STDCALL OhNetInitParamsSetMaxParkedConnections(OhNetHandleInitParams aParams, uint32_t aMaxConnections)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    ip->SetMaxParkedConnections(aMaxConnections);
+}
+
 void STDCALL OhNetInitParamsSetDvNumPublisherThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
     ip->SetDvNumPublisherThreads(aNumThreads);
 }
 
+void STDCALL OhNetInitParamsSetDvPublisherCoalesceMs(OhNetHandleInitParams aParams, uint32_t aMs)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    ip->SetDvPublisherCoalesceMs(aMs);
+}
+
+void STDCALL OhNetInitParamsSetDvEnableEventReactor(OhNetHandleInitParams aParams, uint32_t aEnable)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    ip->SetDvEnableEventReactor(aEnable != 0);
+}
+
 void STDCALL OhNetInitParamsSetDvNumWebSocketThreads(OhNetHandleInitParams aParams, uint32_t aNumThreads)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
@@ -226,6 +262,12 @@ void STDCALL OhNetInitParamsSetCpUpnpEventServerPort(OhNetHandleInitParams aPara
     ip->SetCpUpnpEventServerPort(aPort);
 }
 
+void STDCALL OhNetInitParamsSetCpEnableInvocationReactor(OhNetHandleInitParams aParams, uint32_t aEnable)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    ip->SetCpEnableInvocationReactor(aEnable != 0);
+}
+
 void STDCALL OhNetInitParamsSetDvUpnpServerPort(OhNetHandleInitParams aParams, TUint aPort)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
@@ -280,18 +322,36 @@ uint32_t STDCALL OhNetInitParamsNumActionInvokerThreads(OhNetHandleInitParams aP
     return ip->NumActionInvokerThreads();
 }
 
+uint32_t STDCALL OhNetInitParamsMaxInvocationsPerDevice(OhNetHandleInitParams aParams)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    return ip->MaxInvocationsPerDevice();
+}
+
 uint32_t STDCALL OhNetInitParamsNumInvocations(OhNetHandleInitParams aParams)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
     return ip->NumInvocations();
 }
 
+uint32_t STDCALL OhNetInitParamsInvocationTimeoutMs(OhNetHandleInitParams aParams)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    return ip->InvocationTimeoutMs();
+}
+
 uint32_t STDCALL OhNetInitParamsNumSubscriberThreads(OhNetHandleInitParams aParams)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
     return ip->NumSubscriberThreads();
 }
 
+uint32_t STDCALL OhNetInitParamsNumTimerThreads(OhNetHandleInitParams aParams)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    return ip->NumTimerThreads();
+}
+
 uint32_t STDCALL OhNetInitParamsSubscriptionDurationSecs(OhNetHandleInitParams aParams)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
@@ -316,12 +376,30 @@ uint32_t STDCALL OhNetInitParamsDvNumServerThreads(OhNetHandleInitParams aParams
     return ip->DvNumServerThreads();
 }
 
+uint32_t STDCALL OhNetInitParamsMaxParkedConnections(OhNetHandleInitParams aParams)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    return ip->MaxParkedConnections();
+}
+
 uint32_t STDCALL OhNetInitParamsDvNumPublisherThreads(OhNetHandleInitParams aParams)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
     return ip->DvNumPublisherThreads();
 }
 
+uint32_t STDCALL OhNetInitParamsDvPublisherCoalesceMs(OhNetHandleInitParams aParams)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    return ip->DvPublisherCoalesceMs();
+}
+
+uint32_t STDCALL OhNetInitParamsDvIsEventReactorEnabled(OhNetHandleInitParams aParams)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    return (ip->DvIsEventReactorEnabled()? 1 : 0);
+}
+
 uint32_t STDCALL OhNetInitParamsDvNumWebSocketThreads(OhNetHandleInitParams aParams)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
@@ -334,6 +412,12 @@ uint32_t STDCALL OhNetInitParamsCpUpnpEventServerPort(OhNetHandleInitParams aPar
     return ip->CpUpnpEventServerPort();
 }
 
+uint32_t STDCALL OhNetInitParamsCpIsInvocationReactorEnabled(OhNetHandleInitParams aParams)
+{
+    InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
+    return (ip->CpIsInvocationReactorEnabled()? 1 : 0);
+}
+
 uint32_t STDCALL OhNetInitParamsDvUpnpServerPort(OhNetHandleInitParams aParams)
 {
     InitialisationParams* ip = reinterpret_cast<InitialisationParams*>(aParams);
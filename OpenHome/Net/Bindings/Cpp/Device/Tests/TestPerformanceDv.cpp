@@ -3,6 +3,12 @@
 #include <OpenHome/OhNetTypes.h>
 #include <OpenHome/Net/Cpp/DvDevice.h>
 #include <OpenHome/Net/Core/OhNet.h>
+#include <OpenHome/Private/Network.h>
+#include <OpenHome/Private/Http.h>
+#include <OpenHome/Private/Stream.h>
+#include <OpenHome/OsWrapper.h>
+#include <OpenHome/Net/Private/DviStack.h>
+#include <OpenHome/Net/Private/DviServerUpnp.h>
 #include "TestBasicDv.h"
 
 #include <stdlib.h>
@@ -13,12 +19,101 @@ using namespace OpenHome;
 using namespace OpenHome::Net;
 using namespace OpenHome::TestFramework;
 
+// Invokes TestBasic::GetUint on a local device as fast as possible using raw http so that
+// the cost of opening a connection per request can be compared with reusing one connection
+class InvocationBenchmark
+{
+public:
+    InvocationBenchmark(const Endpoint& aEndpoint, const Brx& aUdn);
+    TUint Run(TUint aDurationMs, TBool aKeepAlive);
+private:
+    TBool Invoke(TBool aKeepAlive); // returns true if the device left the connection open
+private:
+    static const TUint kConnectTimeoutMs = 1000;
+    static const TUint kResponseTimeoutMs = 5000;
+    Endpoint iEndpoint;
+    Bws<Endpoint::kMaxEndpointBytes> iHost;
+    Bwh iControlPath;
+    Brn iBody;
+    SocketTcpClient iSocket;
+    Srs<4096> iReadBuffer;
+};
+
+static const Brn kSoapAction("\"urn:openhome-org:service:TestBasic:1#GetUint\"");
+
+InvocationBenchmark::InvocationBenchmark(const Endpoint& aEndpoint, const Brx& aUdn)
+    : iEndpoint(aEndpoint)
+    , iBody("<?xml version=\"1.0\"?><s:Envelope xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\" "
+            "s:encodingStyle=\"http://schemas.xmlsoap.org/soap/encoding/\"><s:Body>"
+            "<u:GetUint xmlns:u=\"urn:openhome-org:service:TestBasic:1\"></u:GetUint></s:Body></s:Envelope>")
+    , iReadBuffer(iSocket)
+{
+    iEndpoint.AppendEndpoint(iHost);
+    Brn serviceTail("/openhome.org-TestBasic-1/control");
+    iControlPath.Grow(1 + aUdn.Bytes() + serviceTail.Bytes());
+    iControlPath.Append('/');
+    iControlPath.Append(aUdn);
+    iControlPath.Append(serviceTail);
+}
+
+TUint InvocationBenchmark::Run(TUint aDurationMs, TBool aKeepAlive)
+{
+    TUint count = 0;
+    TBool connected = false;
+    const TUint endTime = Os::TimeInMs() + aDurationMs;
+    while (Os::TimeInMs() < endTime) {
+        if (!connected) {
+            iSocket.Open();
+            iSocket.Connect(iEndpoint, kConnectTimeoutMs);
+            connected = true;
+        }
+        if (!Invoke(aKeepAlive)) {
+            iSocket.Close();
+            connected = false;
+        }
+        count++;
+    }
+    if (connected) {
+        iSocket.Close();
+    }
+    return count;
+}
+
+TBool InvocationBenchmark::Invoke(TBool aKeepAlive)
+{
+    Sws<1024> writeBuffer(iSocket);
+    WriterHttpRequest writerRequest(writeBuffer);
+    writerRequest.WriteMethod(Http::kMethodPost, iControlPath, Http::eHttp11);
+    writerRequest.WriteHeader(Http::kHeaderHost, iHost);
+    Http::WriteHeaderContentLength(writerRequest, iBody.Bytes());
+    Http::WriteHeaderContentType(writerRequest, Brn("text/xml; charset=\"utf-8\""));
+    writerRequest.WriteHeader(Brn("SOAPACTION"), kSoapAction);
+    if (!aKeepAlive) {
+        Http::WriteHeaderConnectionClose(writerRequest);
+    }
+    writerRequest.WriteFlush();
+    writeBuffer.Write(iBody);
+    writeBuffer.WriteFlush();
+
+    ReaderHttpResponse readerResponse(iReadBuffer);
+    HttpHeaderConnection headerConnection;
+    readerResponse.AddHeader(headerConnection);
+    readerResponse.Read(kResponseTimeoutMs);
+    ASSERT(readerResponse.Status() == HttpStatus::kOk);
+    ReaderHttpChunked readerChunked(iReadBuffer);
+    readerChunked.Read();
+    return !headerConnection.Close();
+}
+
+
 void OpenHome::TestFramework::Runner::Main(TInt aArgc, TChar* aArgv[], InitialisationParams* aInitParams)
 {
     OptionParser parser;
     Brn emptyString("");
     OptionBool loopback("-l", "--loopback", "Use the loopback adapter only");
     parser.AddOption(&loopback);
+    OptionUint duration("-t", "--timeout", 1, "Time (in seconds) to run the local invocation benchmark for (0 to skip it)");
+    parser.AddOption(&duration);
     if (!parser.Parse(aArgc, aArgv) || parser.HelpDisplayed()) {
         return;
     }
@@ -30,6 +125,19 @@ void OpenHome::TestFramework::Runner::Main(TInt aArgc, TChar* aArgv[], Initialis
 
     Print("TestPerformanceDv - starting ('q' to quit)\n");
     DeviceBasic* device = new DeviceBasic(DeviceBasic::eProtocolUpnp);
+    if (duration.Value() > 0) {
+        std::vector<NetworkAdapter*>* subnetList = UpnpLibrary::CreateSubnetList();
+        TIpAddress addr = (*subnetList)[0]->Address();
+        UpnpLibrary::DestroySubnetList(subnetList);
+        Endpoint endpoint(DviStack::ServerUpnp().Port(addr), addr);
+        const std::string& udn = device->Device().Udn();
+        InvocationBenchmark benchmark(endpoint, Brn((const TByte*)udn.c_str(), (TUint)udn.length()));
+        const TUint durationMs = duration.Value() * 1000;
+        TUint count = benchmark.Run(durationMs, false);
+        Print("Invoked %u actions in %us using a connection per action\n", count, duration.Value());
+        count = benchmark.Run(durationMs, true);
+        Print("Invoked %u actions in %us using a keep-alive connection\n", count, duration.Value());
+    }
     while (getchar() != 'q');
     delete device;
     Print("TestPerformanceDv - exiting\n");
@@ -57,6 +57,15 @@ public:
      *          aValue will not have been set if false is returned
      */
     DllExport TBool GetAttribute(const char* aKey, Brh& aValue) const;
+    /**
+     * Query the number of invocations on this device which are waiting to start and
+     * the number which are in progress.  Intended for diagnostics.
+     *
+     * @param[out] aQueued    Invocations waiting for the device's limit (see
+     *                        InitialisationParams::SetMaxInvocationsPerDevice) to allow them
+     * @param[out] aInFlight  Invocations in progress
+     */
+    DllExport void GetInvocationCounts(TUint& aQueued, TUint& aInFlight) const;
     /**
      * Not intended for external use
      */
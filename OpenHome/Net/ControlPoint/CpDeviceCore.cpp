@@ -1,5 +1,6 @@
 #include <OpenHome/Net/Core/CpDevice.h>
 #include <OpenHome/Net/Private/CpiDevice.h>
+#include <OpenHome/Net/Private/CpiService.h>
 #include <OpenHome/Private/Thread.h>
 #include <OpenHome/Private/Printer.h>
 
@@ -42,6 +43,11 @@ TBool CpDevice::GetAttribute(const char* aKey, Brh& aValue) const
     return iDevice.GetAttribute(aKey, aValue);
 }
 
+void CpDevice::GetInvocationCounts(TUint& aQueued, TUint& aInFlight) const
+{
+    InvocationManager::DeviceCounters(iDevice, aQueued, aInFlight);
+}
+
 CpiDevice& CpDevice::Device()
 {
     return iDevice;
@@ -175,7 +175,7 @@ CpiDeviceList::CpiDeviceList(FunctorCpiDevice aAdded, FunctorCpiDevice aRemoved)
     , iLock("CDLM")
     , iAdded(aAdded)
     , iRemoved(aRemoved)
-    , iRefCount(0)
+    , iRefCount(1) // our own reference, only dropped by the destructor
     , iShutdownSem("CDLS", 0)
 {
     ASSERT(iAdded);
@@ -185,14 +185,9 @@ CpiDeviceList::CpiDeviceList(FunctorCpiDevice aAdded, FunctorCpiDevice aRemoved)
 
 CpiDeviceList::~CpiDeviceList()
 {
-    TBool wait = false;
-    Stack::Mutex().Wait();
-    if (iRefCount > 0) {
-        wait = true;
-        iShutdownSem.Clear();
-    }
-    Stack::Mutex().Signal();
-    if (wait) {
+    // Drop our own reference.  If others remain, whichever RemoveRef() takes the count
+    // to zero signals us; it is the last access any other thread makes to this object.
+    if (iRefCount.Dec() != 0) {
         iShutdownSem.Wait();
     }
     ClearMap(iMap);
@@ -304,18 +299,14 @@ void CpiDeviceList::ClearMap(Map& aMap)
 
 void CpiDeviceList::AddRef()
 {
-    Stack::Mutex().Wait();
-    ++iRefCount;
-    Stack::Mutex().Signal();
+    (void)iRefCount.Inc();
 }
 
 void CpiDeviceList::RemoveRef()
 {
-    Stack::Mutex().Wait();
-    if (--iRefCount == 0) {
+    if (iRefCount.Dec() == 0) {
         iShutdownSem.Signal();
     }
-    Stack::Mutex().Signal();
 }
 
 void CpiDeviceList::NotifyAdded(CpiDevice& aDevice)
@@ -39,6 +39,19 @@ public:
     virtual void InvokeAction(Invocation& aInvocation) = 0;
 };
 
+/**
+ * Optional alternative to IInvocable for protocols which can run an invocation without
+ * blocking an Invoker thread for its duration.
+ *
+ * BeginInvokeAction() should return promptly.  The protocol must later pass the invocation
+ * (with any error set) to InvocationManager::Completed(), which will run its callback.
+ */
+class IInvocableAsync
+{
+public:
+    virtual void BeginInvokeAction(Invocation& aInvocation) = 0;
+};
+
 class ICpiProtocol : public IInvocable
 {
 public:
@@ -272,7 +285,7 @@ protected:
 private:
     FunctorCpiDevice iAdded;
     FunctorCpiDevice iRemoved;
-    TUint iRefCount;
+    AtomicInt iRefCount;
     Semaphore iShutdownSem;
 };
 
@@ -565,6 +565,11 @@ IInvocable& OpenHome::Net::Invocation::Invoker()
     return *iInvoker;
 }
 
+void OpenHome::Net::Invocation::SetAsyncInvoker(IInvocableAsync& aInvocable)
+{
+    iInvokerAsync = &aInvocable;
+}
+
 TUint OpenHome::Net::Invocation::Type() const
 {
     return eInvocation;
@@ -578,6 +583,9 @@ OpenHome::Net::Invocation::Invocation(Fifo<OpenHome::Net::Invocation*>& aFree)
     , iDevice(NULL)
     , iCompleted(false)
     , iInterruptHandler(NULL)
+    , iInvoker(NULL)
+    , iInvokerAsync(NULL)
+    , iAsyncStarted(false)
 {
 }
 
@@ -605,16 +613,20 @@ void OpenHome::Net::Invocation::Clear()
     iError.Clear();
     iCompleted = false;
     iInterruptHandler = NULL;
+    iInvokerAsync = NULL;
+    iAsyncStarted = false;
     iLock.Signal();
 }
 
 
 // Invoker
 
-Invoker::Invoker(const TChar* aName, Fifo<Invoker*>& aFree)
+Invoker::Invoker(const TChar* aName, InvocationManager& aManager, Fifo<Invoker*>& aFree)
     : Thread(aName)
+    , iManager(aManager)
     , iFree(aFree)
     , iInvocation(NULL)
+    , iCompleteOnly(false)
     , iLock("MVOK")
 {
 }
@@ -633,6 +645,15 @@ void Invoker::Invoke(Invocation* aInvocation)
     Signal();
 }
 
+void Invoker::Complete(Invocation* aInvocation)
+{
+    iLock.Wait();
+    iInvocation = aInvocation;
+    iCompleteOnly = true;
+    iLock.Signal();
+    Signal();
+}
+
 void Invoker::Interrupt(const Service& aService)
 {
     AutoMutex a(iLock);
@@ -667,7 +688,9 @@ void Invoker::Run()
                           (const TChar*)Name().Ptr(), iInvocation);
             LOG(kService, iInvocation->Action().Name());
             LOG(kService, "\n");
-            iInvocation->Invoker().InvokeAction(*iInvocation);
+            if (!iCompleteOnly) {
+                iInvocation->Invoker().InvokeAction(*iInvocation);
+            }
         }
         catch (HttpError&) {
             SetError(Error::eHttp, Error::kCodeUnknown, Error::kDescriptionUnknown, "Http");
@@ -687,30 +710,44 @@ void Invoker::Run()
         catch (ParameterValidationError&) {
             SetError(Error::eService, Error::eCodeParameterInvalid, Error::kDescriptionParameterInvalid, "Parameter");
         }
+        if (!iCompleteOnly) {
+            iManager.InvocationFinished(iInvocation->Device());
+        }
         iLock.Wait();
         iInvocation->SignalCompleted();
         iInvocation = NULL;
+        iCompleteOnly = false;
         iLock.Signal();
         iFree.Write(this);
+        iManager.Signal();
     }
 }
 
 
 // InvocationManager
 
+InvocationManager::DeviceQueue::DeviceQueue()
+    : iInFlight(0)
+{
+}
+
 InvocationManager::InvocationManager()
     : Thread("INVM")
     , iLock("INVM")
     , iFreeInvocations(Stack::InitParams().NumInvocations())
     , iWaitingInvocations(Stack::InitParams().NumInvocations())
     , iFreeInvokers(Stack::InitParams().NumActionInvokerThreads())
+    , iAsyncLock("INVA")
+    , iDeviceLock("INVD")
+    , iNextDevice(0)
+    , iMaxInFlightPerDevice(Stack::InitParams().MaxInvocationsPerDevice())
 {
     TUint i;
     TChar thName[5] = "IN  ";
     iInvokers = (Invoker**)malloc(sizeof(*iInvokers) * Stack::InitParams().NumActionInvokerThreads());
     for (i=0; i<Stack::InitParams().NumActionInvokerThreads(); i++) {
         thName[3] = (TChar)('0'+i);
-        iInvokers[i] = new Invoker(&thName[0], iFreeInvokers);
+        iInvokers[i] = new Invoker(&thName[0], *this, iFreeInvokers);
         iFreeInvokers.Write(iInvokers[i]);
         iInvokers[i]->Start();
     }
@@ -728,7 +765,6 @@ InvocationManager::~InvocationManager()
     iActive = false;
     iLock.Signal();
 
-    iFreeInvokers.ReadInterrupt();
     Kill();
     Join();
 
@@ -738,6 +774,20 @@ InvocationManager::~InvocationManager()
     }
     free(iInvokers);
 
+    // fail anything still waiting so that every invocation is returned to the free pool
+    std::vector<OpenHome::Net::Invocation*> pending(iCompletions.begin(), iCompletions.end());
+    while (iWaitingInvocations.SlotsUsed() > 0) {
+        pending.push_back(iWaitingInvocations.Read());
+    }
+    for (DeviceMap::iterator it = iDeviceQueues.begin(); it != iDeviceQueues.end(); ++it) {
+        pending.insert(pending.end(), it->second->iWaiting.begin(), it->second->iWaiting.end());
+        delete it->second;
+    }
+    for (i=0; i<(TUint)pending.size(); i++) {
+        pending[i]->SetError(Error::eAsync, Error::eCodeShutdown, Error::kDescriptionAsyncShutdown);
+        pending[i]->SignalCompleted();
+    }
+
     for (i=0; i<Stack::InitParams().NumInvocations(); i++) {
         OpenHome::Net::Invocation* invocation = iFreeInvocations.Read();
         delete invocation;
@@ -766,12 +816,48 @@ void InvocationManager::Invoke(OpenHome::Net::Invocation* aInvocation)
     self.Signal();
 }
 
+void InvocationManager::Completed(OpenHome::Net::Invocation& aInvocation)
+{
+    InvocationManager& self = Self();
+    self.iAsyncLock.Wait();
+    for (TUint i=0; i<(TUint)self.iAsyncInvocations.size(); i++) {
+        if (self.iAsyncInvocations[i] == &aInvocation) {
+            self.iAsyncInvocations.erase(self.iAsyncInvocations.begin() + i);
+            break;
+        }
+    }
+    self.iAsyncLock.Signal();
+    self.InvocationFinished(aInvocation.Device());
+    // never blocks - iWaitingInvocations has room for every invocation in the pool
+    self.iWaitingInvocations.Write(&aInvocation);
+    self.Signal();
+}
+
 void InvocationManager::Interrupt(const Service& aService)
 {
     InvocationManager& self = Self();
     for (TUint i=0; i<Stack::InitParams().NumActionInvokerThreads(); i++) {
         self.iInvokers[i]->Interrupt(aService);
     }
+    AutoMutex a(self.iAsyncLock);
+    for (TUint i=0; i<(TUint)self.iAsyncInvocations.size(); i++) {
+        self.iAsyncInvocations[i]->Interrupt(aService);
+    }
+}
+
+void InvocationManager::DeviceCounters(const CpiDevice& aDevice, TUint& aQueued, TUint& aInFlight)
+{
+    InvocationManager& self = Self();
+    AutoMutex a(self.iDeviceLock);
+    DeviceMap::iterator it = self.iDeviceQueues.find(&aDevice);
+    if (it == self.iDeviceQueues.end()) {
+        aQueued = 0;
+        aInFlight = 0;
+    }
+    else {
+        aQueued = (TUint)it->second->iWaiting.size();
+        aInFlight = it->second->iInFlight;
+    }
 }
 
 InvocationManager& InvocationManager::Self()
@@ -783,30 +869,115 @@ void InvocationManager::Run()
 {
     for (;;) {
         Wait();
-        OpenHome::Net::Invocation* invocation = NULL;
-        try {
-            invocation = iWaitingInvocations.Read();
-            if (invocation->Interrupt()) {
-                // the service associated with this invocation is being deleted
-                // complete it with an error immediately and process the next waiting
-                invocation->SetError(Error::eAsync,
-                                     Error::eCodeInterrupted,
-                                     Error::kDescriptionAsyncInterrupted);
-                invocation->SignalCompleted();
+        // this is the only thread which reads from iWaitingInvocations or iFreeInvokers
+        while (iWaitingInvocations.SlotsUsed() > 0) {
+            OpenHome::Net::Invocation* invocation = iWaitingInvocations.Read();
+            if (invocation->iAsyncStarted) {
+                // started by an IInvocableAsync which has now finished with it
+                iCompletions.push_back(invocation);
             }
             else {
-                Invoker* invoker = iFreeInvokers.Read();
-                invoker->Invoke(invocation);
+                AutoMutex a(iDeviceLock);
+                DeviceQueue*& queue = iDeviceQueues[&invocation->Device()];
+                if (queue == NULL) {
+                    queue = new DeviceQueue;
+                    iRoundRobin.push_back(queue);
+                }
+                queue->iWaiting.push_back(invocation);
             }
         }
-        catch (FifoReadError&) {
-            if (invocation != NULL) {
-                invocation->SetError(Error::eAsync,
-                                     Error::eCodeShutdown,
-                                     Error::kDescriptionAsyncShutdown);
-                invocation->SignalCompleted();
+        while (iCompletions.size() > 0 && iFreeInvokers.SlotsUsed() > 0) {
+            Invoker* invoker = iFreeInvokers.Read();
+            invoker->Complete(iCompletions.front());
+            iCompletions.pop_front();
+        }
+        Dispatch();
+    }
+}
+
+void InvocationManager::Dispatch()
+{
+    for (;;) {
+        OpenHome::Net::Invocation* invocation = NULL;
+        iDeviceLock.Wait();
+        const TBool invokerAvailable = (iFreeInvokers.SlotsUsed() > 0);
+        const TUint count = (TUint)iRoundRobin.size();
+        for (TUint i=0; i<count; i++) {
+            const TUint index = (iNextDevice + i) % count;
+            DeviceQueue& queue = *iRoundRobin[index];
+            if (queue.iWaiting.size() == 0 ||
+                (iMaxInFlightPerDevice != 0 && queue.iInFlight >= iMaxInFlightPerDevice)) {
+                continue;
+            }
+            OpenHome::Net::Invocation* next = queue.iWaiting.front();
+            if (!invokerAvailable && next->iInvokerAsync == NULL) {
+                continue;
+            }
+            queue.iWaiting.pop_front();
+            queue.iInFlight++;
+            iNextDevice = index + 1;
+            invocation = next;
+            break;
+        }
+        iDeviceLock.Signal();
+        if (invocation == NULL) {
+            break;
+        }
+        StartInvocation(invocation);
+    }
+}
+
+void InvocationManager::StartInvocation(OpenHome::Net::Invocation* aInvocation)
+{
+    if (aInvocation->Interrupt()) {
+        // the service associated with this invocation is being deleted
+        // complete it with an error immediately
+        aInvocation->SetError(Error::eAsync,
+                              Error::eCodeInterrupted,
+                              Error::kDescriptionAsyncInterrupted);
+        InvocationFinished(aInvocation->Device());
+        aInvocation->SignalCompleted();
+    }
+    else if (aInvocation->iInvokerAsync != NULL) {
+        aInvocation->iAsyncStarted = true;
+        iAsyncLock.Wait();
+        iAsyncInvocations.push_back(aInvocation);
+        iAsyncLock.Signal();
+        aInvocation->iInvokerAsync->BeginInvokeAction(*aInvocation);
+    }
+    else {
+        Invoker* invoker = iFreeInvokers.Read(); // Dispatch() checked that this won't block
+        invoker->Invoke(aInvocation);
+    }
+}
+
+void InvocationManager::InvocationFinished(const CpiDevice& aDevice)
+{
+    AutoMutex a(iDeviceLock);
+    DeviceMap::iterator it = iDeviceQueues.find(&aDevice);
+    ASSERT(it != iDeviceQueues.end());
+    ASSERT(it->second->iInFlight > 0);
+    it->second->iInFlight--;
+    RemoveDeviceIfIdleLocked(it);
+}
+
+void InvocationManager::RemoveDeviceIfIdleLocked(DeviceMap::iterator aIt)
+{
+    /* Devices are only tracked while they have outstanding invocations.  Their services
+       (and so the devices) may be deleted once the last of these completes. */
+    DeviceQueue* queue = aIt->second;
+    if (queue->iInFlight > 0 || queue->iWaiting.size() > 0) {
+        return;
+    }
+    for (TUint i=0; i<(TUint)iRoundRobin.size(); i++) {
+        if (iRoundRobin[i] == queue) {
+            iRoundRobin.erase(iRoundRobin.begin() + i);
+            if (iNextDevice > i) {
+                iNextDevice--;
             }
             break;
         }
     }
+    iDeviceQueues.erase(aIt);
+    delete queue;
 }
@@ -24,6 +24,7 @@
 
 #include <vector>
 #include <map>
+#include <deque>
 
 namespace OpenHome {
 namespace Net {
@@ -369,6 +370,12 @@ public:
 
     void SetInvoker(IInvocable& aInvocable);
     IInvocable& Invoker();
+
+    /**
+     * Optionally, have InvocationManager start this invocation using aInvocable rather than
+     * passing it to an Invoker thread.  Must be called after SetInvoker().
+     */
+    void SetAsyncInvoker(IInvocableAsync& aInvocable);
 private:
     Invocation(Fifo<OpenHome::Net::Invocation*>& aFree);
     Invocation& operator=(const Invocation& aInvocation);
@@ -390,6 +397,8 @@ private:
     VectorArguments iOutput;
     IInterruptHandler* iInterruptHandler;
     IInvocable* iInvoker;
+    IInvocableAsync* iInvokerAsync;
+    TBool iAsyncStarted;
 private:
     friend class InvocationManager;
 };
@@ -399,10 +408,12 @@ private:
  *
  * Intended for internal use only
  */
+class InvocationManager;
+
 class Invoker : public Thread
 {
 public:
-    Invoker(const TChar* aName, Fifo<Invoker*>& aFree);
+    Invoker(const TChar* aName, InvocationManager& aManager, Fifo<Invoker*>& aFree);
     ~Invoker();
 
     /**
@@ -410,6 +421,11 @@ public:
      */
     void Invoke(Invocation* aInvocation);
     
+    /**
+     * Run the callback for aInvocation, which has already been invoked elsewhere
+     */
+    void Complete(Invocation* aInvocation);
+
     /**
      * Interrupt any current invocation if its action is a member of aService
      */
@@ -418,13 +434,19 @@ private:
     void SetError(Error::ELevel aLevel, TUint aCode, const Brx& aDescription, const TChar* aLogStr);
     void Run();
 private:
+    InvocationManager& iManager;
     Fifo<Invoker*>& iFree;
     Invocation* iInvocation;
+    TBool iCompleteOnly;
     OpenHome::Mutex iLock;
 };
 
 /**
  * Singleton which manages the pools of Invocation and Invoker instances
+ *
+ * Waiting invocations are queued per device.  Devices take turns to start their next
+ * invocation and each is limited to InitParams().MaxInvocationsPerDevice() in progress
+ * so one slow device cannot occupy every Invoker.
  */
 class InvocationManager : public Thread
 {
@@ -432,11 +454,35 @@ public:
     InvocationManager();
     ~InvocationManager();
     static void Invoke(OpenHome::Net::Invocation* aInvocation);
+    /**
+     * Used by IInvocableAsync implementations to report that an invocation passed to
+     * BeginInvokeAction() has completed.  Its callback will be run by an Invoker thread.
+     */
+    static void Completed(OpenHome::Net::Invocation& aInvocation);
     static void Interrupt(const Service& aService);
+    /**
+     * Diagnostic counters for aDevice: the number of invocations waiting to start and
+     * the number in progress.  Both are 0 for a device with no outstanding invocations.
+     */
+    static void DeviceCounters(const CpiDevice& aDevice, TUint& aQueued, TUint& aInFlight);
+private:
+    class DeviceQueue
+    {
+    public:
+        DeviceQueue();
+    public:
+        std::deque<OpenHome::Net::Invocation*> iWaiting;
+        TUint iInFlight;
+    };
+    typedef std::map<const CpiDevice*, DeviceQueue*> DeviceMap;
 private:
     static OpenHome::Net::Invocation* Invocation();
     static InvocationManager& Self();
     void Run();
+    void Dispatch();
+    void StartInvocation(OpenHome::Net::Invocation* aInvocation);
+    void InvocationFinished(const CpiDevice& aDevice);
+    void RemoveDeviceIfIdleLocked(DeviceMap::iterator aIt);
 private:
     OpenHome::Mutex iLock;
     Fifo<OpenHome::Net::Invocation*> iFreeInvocations;
@@ -444,8 +490,17 @@ private:
     Fifo<Invoker*> iFreeInvokers;
     Invoker** iInvokers;
     TBool iActive;
+    OpenHome::Mutex iAsyncLock;
+    std::vector<OpenHome::Net::Invocation*> iAsyncInvocations; // started by an IInvocableAsync, not yet completed
+    std::deque<OpenHome::Net::Invocation*> iCompletions;       // async invocations waiting for an Invoker to run their callback
+    OpenHome::Mutex iDeviceLock;
+    DeviceMap iDeviceQueues;                // devices with waiting or in progress invocations
+    std::vector<DeviceQueue*> iRoundRobin;  // iDeviceQueues in the order they take turns
+    TUint iNextDevice;                      // index into iRoundRobin of the next device to get a turn
+    TUint iMaxInFlightPerDevice;
 private:
     friend class CpiService;
+    friend class Invoker;
 };
 
 } // namespace Net
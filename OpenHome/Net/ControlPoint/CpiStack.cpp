@@ -4,6 +4,7 @@
 #include <OpenHome/Net/Private/XmlFetcher.h>
 #include <OpenHome/Net/Private/CpiSubscription.h>
 #include <OpenHome/Net/Private/CpiDevice.h>
+#include <OpenHome/Net/Private/ProtocolUpnp.h>
 #include <OpenHome/Private/Printer.h>
 
 using namespace OpenHome;
@@ -15,6 +16,15 @@ CpiStack::CpiStack()
 {
     Stack::SetCpiStack(this);
     iInvocationManager = new OpenHome::Net::InvocationManager;
+    iInvocationReactor = NULL;
+    if (Stack::InitParams().CpIsInvocationReactorEnabled()) {
+        try {
+            iInvocationReactor = new InvocationReactorUpnp;
+        }
+        catch (NetworkError&) {
+            // no reactor support on this platform
+        }
+    }
     iXmlFetchManager = new OpenHome::Net::XmlFetchManager;
     iSubscriptionManager = new CpiSubscriptionManager;
     iDeviceListUpdater = new CpiDeviceListUpdater;
@@ -25,6 +35,7 @@ CpiStack::~CpiStack()
     delete iDeviceListUpdater;
     delete iSubscriptionManager;
     delete iXmlFetchManager;
+    delete iInvocationReactor;
     delete iInvocationManager;
 }
 
@@ -34,6 +45,12 @@ InvocationManager& CpiStack::InvocationManager()
     return *(self->iInvocationManager);
 }
 
+InvocationReactorUpnp* CpiStack::InvocationReactor()
+{
+    CpiStack* self = CpiStack::Self();
+    return self->iInvocationReactor;
+}
+
 OpenHome::Net::XmlFetchManager& CpiStack::XmlFetchManager()
 {
     CpiStack* self = CpiStack::Self();
@@ -19,11 +19,17 @@
 namespace OpenHome {
 namespace Net {
 
+class InvocationReactorUpnp;
+
 class CpiStack : public IStack
 {
 public:
     CpiStack();
     static OpenHome::Net::InvocationManager& InvocationManager();
+    /**
+     * Returns NULL if invocations should each be run on an Invoker thread instead
+     */
+    static InvocationReactorUpnp* InvocationReactor();
     static OpenHome::Net::XmlFetchManager& XmlFetchManager();
     static CpiSubscriptionManager& SubscriptionManager();
     static CpiDeviceListUpdater& DeviceListUpdater();
@@ -32,6 +38,7 @@ private:
     static CpiStack* Self();
 private:
     OpenHome::Net::InvocationManager* iInvocationManager;
+    InvocationReactorUpnp* iInvocationReactor;
     OpenHome::Net::XmlFetchManager* iXmlFetchManager;
     CpiSubscriptionManager* iSubscriptionManager;
     CpiDeviceListUpdater* iDeviceListUpdater;
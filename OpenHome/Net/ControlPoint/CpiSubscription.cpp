@@ -32,19 +32,14 @@ const Brx& CpiSubscription::Sid() const
 
 void CpiSubscription::AddRef()
 {
-    Stack::Mutex().Wait();
-    iRefCount++;
-    Stack::Mutex().Signal();
+    (void)iRefCount.Inc();
 }
 
 void CpiSubscription::RemoveRef()
 {
-    TBool dead;
-    Stack::Mutex().Wait();
-    ASSERT(iRefCount != 0);
-    dead = (--iRefCount == 0);
-    Stack::Mutex().Signal();
-    if (dead) {
+    const TInt count = iRefCount.Dec();
+    ASSERT(count >= 0);
+    if (count == 0) {
         delete this;
     }
 }
@@ -161,7 +156,7 @@ void CpiSubscription::Schedule(EOperation aOperation, TBool aRejectFutureOperati
     if (aRejectFutureOperations) {
         iRejectFutureOperations = true;
     }
-    iRefCount++;
+    (void)iRefCount.Inc();
     iPendingOperation = aOperation;
     Stack::Mutex().Signal();
     CpiSubscriptionManager::Schedule(*this);
@@ -347,7 +342,7 @@ void CpiSubscription::ListObjectDetails() const
 {
     Log::Print("  CpiSubscription: addr=%p, device=", this);
     Log::Print(iDevice.Udn());
-    Log::Print(", refCount=%u, sid=", iRefCount);
+    Log::Print(", refCount=%d, sid=", iRefCount.Value());
     Log::Print(iSid);
     Log::Print("\n");
 }
@@ -135,7 +135,7 @@ private:
     Timer* iTimer;
     TUint iNextSequenceNumber;
     EOperation iPendingOperation;
-    TUint iRefCount;
+    AtomicInt iRefCount;
     IInterruptHandler* iInterruptHandler;
     TBool iRejectFutureOperations;
 
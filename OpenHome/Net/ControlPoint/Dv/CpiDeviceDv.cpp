@@ -380,6 +380,16 @@ void PropertyWriterDv::PropertyWriteEnd()
     iEventProcessor.EventUpdateEnd();
 }
 
+TBool PropertyWriterDv::SupportsEncodedProperties() const
+{
+    return false;
+}
+
+void PropertyWriterDv::PropertyWriteEncoded(const Brx& /*aProperties*/)
+{
+    ASSERTS();
+}
+
 
 // OutputProcessorDv
 
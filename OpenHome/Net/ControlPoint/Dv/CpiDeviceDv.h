@@ -104,6 +104,8 @@ private: // IPropertyWriter
     void PropertyWriteBool(const Brx& aName, TBool aValue);
     void PropertyWriteBinary(const Brx& aName, const Brx& aValue);
     void PropertyWriteEnd();
+    TBool SupportsEncodedProperties() const;
+    void PropertyWriteEncoded(const Brx& aProperties);
 private:
     IEventProcessor& iEventProcessor;
 };
@@ -3,6 +3,7 @@
 #include <OpenHome/Private/Thread.h>
 #include <OpenHome/Net/Private/Stack.h>
 #include <OpenHome/Net/Private/CpiService.h>
+#include <OpenHome/Net/Private/CpiStack.h>
 #include <OpenHome/Private/Stream.h>
 #include <OpenHome/Net/Core/OhNet.h>
 #include <OpenHome/Private/Http.h>
@@ -40,6 +41,7 @@ CpiDeviceUpnp::CpiDeviceUpnp(const Brx& aUdn, const Brx& aLocation, TUint aMaxAg
     iTimer = new Timer(MakeFunctor(*this, &CpiDeviceUpnp::TimerExpired));
     UpdateMaxAge(aMaxAgeSecs);
     iInvocable = new Invocable(*this);
+    iConnectionPool = new InvocationConnectionPool();
 }
 
 const Brx& CpiDeviceUpnp::Udn() const
@@ -143,6 +145,9 @@ TBool CpiDeviceUpnp::GetAttribute(const char* aKey, Brh& aValue) const
 void CpiDeviceUpnp::InvokeAction(Invocation& aInvocation)
 {
     aInvocation.SetInvoker(*iInvocable);
+    if (CpiStack::InvocationReactor() != NULL) {
+        aInvocation.SetAsyncInvoker(*iInvocable);
+    }
     InvocationManager::Invoke(&aInvocation);
 }
 
@@ -194,6 +199,7 @@ CpiDeviceUpnp::~CpiDeviceUpnp()
     delete iDeviceXml;
     delete iTimer;
     delete iInvocable;
+    delete iConnectionPool;
 }
 
 void CpiDeviceUpnp::TimerExpired()
@@ -315,7 +321,7 @@ void CpiDeviceUpnp::Invocable::InvokeAction(Invocation& aInvocation)
     try {
         Uri uri;
         iDevice.GetServiceUri(uri, "controlURL", aInvocation.ServiceType());
-        InvocationUpnp invoker(aInvocation);
+        InvocationUpnp invoker(aInvocation, *iDevice.iConnectionPool);
         invoker.Invoke(uri);
     }
     catch (XmlError&) {
@@ -323,6 +329,23 @@ void CpiDeviceUpnp::Invocable::InvokeAction(Invocation& aInvocation)
     }
 }
 
+void CpiDeviceUpnp::Invocable::BeginInvokeAction(Invocation& aInvocation)
+{
+    try {
+        Uri uri;
+        iDevice.GetServiceUri(uri, "controlURL", aInvocation.ServiceType());
+        CpiStack::InvocationReactor()->Invoke(aInvocation, uri, *iDevice.iConnectionPool);
+    }
+    catch (XmlError&) {
+        aInvocation.SetError(Error::eSocket, Error::kCodeUnknown, Error::kDescriptionUnknown);
+        InvocationManager::Completed(aInvocation);
+    }
+    catch (NetworkError&) {
+        aInvocation.SetError(Error::eSocket, Error::kCodeUnknown, Error::kDescriptionUnknown);
+        InvocationManager::Completed(aInvocation);
+    }
+}
+
 
 // CpiDeviceListUpnp
 
@@ -22,6 +22,7 @@ namespace OpenHome {
 namespace Net {
 
 class CpiDeviceListUpnp;
+class InvocationConnectionPool;
 /**
  * UPnP-specific device
  *
@@ -63,11 +64,12 @@ private:
     void XmlFetchCompleted(IAsync& aAsync);
     static TBool UdnMatches(const Brx& aFound, const Brx& aTarget);
 private:
-    class Invocable : public IInvocable, private INonCopyable
+    class Invocable : public IInvocable, public IInvocableAsync, private INonCopyable
     {
     public:
         Invocable(CpiDeviceUpnp& aDevice);
         virtual void InvokeAction(Invocation& aInvocation);
+        virtual void BeginInvokeAction(Invocation& aInvocation);
     private:
         CpiDeviceUpnp& iDevice;
     };
@@ -84,6 +86,7 @@ private:
     IDeviceRemover& iDeviceList;
     CpiDeviceListUpnp* iList;
     Invocable* iInvocable;
+    InvocationConnectionPool* iConnectionPool;
     Semaphore iSemReady;
     TBool iRemoved;
     friend class Invocable;
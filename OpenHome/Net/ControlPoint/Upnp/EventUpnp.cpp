@@ -32,6 +32,7 @@ EventSessionUpnp::EventSessionUpnp()
     iReaderRequest->AddHeader(iHeaderSeq);
     iReaderRequest->AddHeader(iHeaderContentLength);
     iReaderRequest->AddHeader(iHeaderTransferEncoding);
+    iReaderRequest->AddHeader(iHeaderConnection);
 }
 
 EventSessionUpnp::~EventSessionUpnp()
@@ -66,6 +67,7 @@ void EventSessionUpnp::LogError(CpiSubscription* aSubscription, const TChar* /*a
 void EventSessionUpnp::Run()
 {
     CpiSubscription* subscription = NULL;
+    TBool keepAlive = false;
     iErrorStatus = &HttpStatus::kOk;
     try {
         iReaderRequest->Flush();
@@ -110,10 +112,27 @@ void EventSessionUpnp::Run()
     catch(ReaderError) {}
 
     try {
+        // the connection can only be reused if the entity is read below
+        if (subscription != NULL && KeepAliveSupported()) {
+            if (iReaderRequest->Version() == Http::eHttp11) {
+                keepAlive = !iHeaderConnection.Close();
+            }
+            else {
+                keepAlive = iHeaderConnection.KeepAlive();
+            }
+        }
+
         // write response
         Sws<128> writerBuffer(*this);
         WriterHttpResponse response(writerBuffer);
         response.WriteStatus(*iErrorStatus, Http::eHttp11);
+        Http::WriteHeaderContentLength(response, 0);
+        if (!keepAlive) {
+            Http::WriteHeaderConnectionClose(response);
+        }
+        else if (iReaderRequest->Version() == Http::eHttp10) {
+            response.WriteHeader(Http::kHeaderConnection, Http::kConnectionKeepAlive);
+        }
         response.WriteFlush();
 
         // read entity
@@ -142,6 +161,9 @@ void EventSessionUpnp::Run()
             LOG(kEvent, iHeaderSid.Sid());
             LOG(kEvent, " seq - %u\n", iHeaderSeq.Seq());
             ProcessNotification(*subscription, entity);
+            if (keepAlive) {
+                KeepAlive(iReadBuffer->Snaffle());
+            }
         }
     }
     catch(HttpError) {
@@ -224,6 +246,10 @@ EventServerUpnp::EventServerUpnp(TIpAddress aInterface)
     // nothing terribly bad would happen if this assertion failed so its not worth a separate Windows implementation
     ASSERT(Stack::InitParams().NumEventSessionThreads() < 10);
 #endif
+    const TUint maxParked = Stack::InitParams().MaxParkedConnections();
+    if (maxParked > 0) {
+        (void)iTcpServer.ParkConnections(maxParked, Brn("\r\n\r\n"), kParkTimeoutMs);
+    }
     for (TUint i=0; i<Stack::InitParams().NumEventSessionThreads(); i++) {
         name[3] = (TChar)('0' + i);
         iTcpServer.Add(&name[0], new EventSessionUpnp());
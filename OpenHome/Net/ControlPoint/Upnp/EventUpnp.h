@@ -37,6 +37,7 @@ private:
     HeaderSeq iHeaderSeq;
     HttpHeaderContentLength iHeaderContentLength;
     HttpHeaderTransferEncoding iHeaderTransferEncoding;
+    HttpHeaderConnection iHeaderConnection;
     const HttpStatus* iErrorStatus;
 };
 
@@ -45,6 +46,8 @@ class EventServerUpnp
 public:
     EventServerUpnp(TIpAddress aInterface);
     TUint Port() const { return iTcpServer.Port(); }
+private:
+    static const TUint kParkTimeoutMs = 5 * 1000;
 private:
     SocketTcpServer iTcpServer;
 };
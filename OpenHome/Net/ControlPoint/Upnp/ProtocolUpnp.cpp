@@ -11,19 +11,113 @@
 using namespace OpenHome;
 using namespace OpenHome::Net;
 
+// InvocationConnection
+
+InvocationConnection::InvocationConnection(const Endpoint& aEndpoint)
+    : iEndpoint(aEndpoint)
+    , iReader(iSocket)
+    , iReadBuffer(iReader)
+    , iConnected(false)
+    , iIdleSinceMs(0)
+{
+    iSocket.Open();
+}
+
+InvocationConnection::~InvocationConnection()
+{
+    try {
+        iSocket.Close();
+    }
+    catch (NetworkError&) {
+        LOG2(kService, kError, "InvocationConnection - error closing socket\n");
+    }
+}
+
+void InvocationConnection::Connect()
+{
+    TUint timeout = Stack::InitParams().TcpConnectTimeoutMs();
+    iSocket.Connect(iEndpoint, timeout);
+    iConnected = true;
+}
+
+
+// InvocationConnectionPool
+
+InvocationConnectionPool::InvocationConnectionPool(TUint aMaxIdleConnections)
+    : iMaxIdleConnections(aMaxIdleConnections)
+    , iLock("ICPL")
+{
+}
+
+InvocationConnectionPool::~InvocationConnectionPool()
+{
+    for (TUint i=0; i<(TUint)iIdle.size(); i++) {
+        delete iIdle[i];
+    }
+}
+
+InvocationConnection* InvocationConnectionPool::Claim(const Endpoint& aEndpoint)
+{
+    iLock.Wait();
+    RemoveExpiredLocked(Os::TimeInMs());
+    for (TUint i=(TUint)iIdle.size(); i>0; i--) {
+        // search from the back to favour the most recently used connection
+        InvocationConnection* connection = iIdle[i-1];
+        if (connection->iEndpoint.Equals(aEndpoint)) {
+            iIdle.erase(iIdle.begin() + i - 1);
+            iLock.Signal();
+            return connection;
+        }
+    }
+    iLock.Signal();
+    return new InvocationConnection(aEndpoint);
+}
+
+void InvocationConnectionPool::Release(InvocationConnection* aConnection, TBool aReusable)
+{
+    if (aReusable) {
+        AutoMutex a(iLock);
+        const TUint now = Os::TimeInMs();
+        RemoveExpiredLocked(now);
+        if (iIdle.size() < iMaxIdleConnections) {
+            aConnection->iIdleSinceMs = now;
+            iIdle.push_back(aConnection);
+            return;
+        }
+    }
+    delete aConnection;
+}
+
+void InvocationConnectionPool::RemoveExpiredLocked(TUint aTimeNowMs)
+{
+    // iIdle is ordered by release time so expired connections are all at the front
+    TUint count = 0;
+    while (count < (TUint)iIdle.size() && aTimeNowMs - iIdle[count]->iIdleSinceMs >= kIdleTimeoutMs) {
+        delete iIdle[count];
+        count++;
+    }
+    if (count > 0) {
+        iIdle.erase(iIdle.begin(), iIdle.begin() + count);
+    }
+}
+
+
 // InvocationUpnp
 
-InvocationUpnp::InvocationUpnp(Invocation& aInvocation)
+InvocationUpnp::InvocationUpnp(Invocation& aInvocation, InvocationConnectionPool& aConnectionPool)
     : iInvocation(aInvocation)
-    , iReadBuffer(iSocket)
-    , iReaderResponse(iReadBuffer)
+    , iConnectionPool(aConnectionPool)
+    , iConnection(NULL)
+    , iReusable(false)
 {
 }
 
 InvocationUpnp::~InvocationUpnp()
 {
     iInvocation.SetInterruptHandler(NULL);
-    iSocket.Close();
+    if (iConnection != NULL) {
+        iConnectionPool.Release(iConnection, iReusable && !iInvocation.Interrupt());
+    }
 }
 
 void InvocationUpnp::Invoke(const Uri& aUri)
@@ -32,10 +126,47 @@ void InvocationUpnp::Invoke(const Uri& aUri)
     LOG(kService, iInvocation.Action().Name());
     LOG(kService, ")\n");
 
-    iSocket.Open();
-    WriteRequest(aUri);
-    iInvocation.SetInterruptHandler(this);
-    ReadResponse();
+    Endpoint endpoint(aUri.Port(), aUri.Host());
+    iConnection = iConnectionPool.Claim(endpoint);
+    for (;;) {
+        const TBool reused = iConnection->iConnected;
+        try {
+            if (!reused) {
+                try {
+                    iConnection->Connect();
+                }
+                catch (NetworkTimeout&) {
+                    iInvocation.SetError(Error::eSocket, Error::eCodeTimeout, Error::kDescriptionSocketTimeout);
+                    THROW(NetworkTimeout);
+                }
+            }
+            iInvocation.SetInterruptHandler(this);
+            Sws<1024> writeBuffer(iConnection->iSocket);
+            WriteRequest(writeBuffer, iInvocation, aUri);
+            writeBuffer.WriteFlush();
+            ReadResponse(iInvocation, iConnection->iReadBuffer, Stack::InitParams().InvocationTimeoutMs(), iReusable);
+            break;
+        }
+        catch (WriterError&) {
+            if (!reused || iInvocation.Interrupt()) {
+                iInvocation.SetError(Error::eHttp, Error::kCodeUnknown, Error::kDescriptionUnknown);
+                throw;
+            }
+        }
+        catch (ReaderError&) {
+            if (!reused || !iConnection->iReader.ClosedBeforeData() || iInvocation.Interrupt()) {
+                throw;
+            }
+        }
+        /* The device closed a keep-alive connection while it was idle.  Nothing has been
+           read back so assume the request wasn't processed and retry on another connection.
+           A timeout or partial response means the device may have acted on the request so
+           is never retried. */
+        LOG(kService, "InvocationUpnp::Invoke - stale connection, retrying\n");
+        iInvocation.SetInterruptHandler(NULL);
+        iConnectionPool.Release(iConnection, false);
+        iConnection = iConnectionPool.Claim(endpoint);
+    }
 
     LOG(kService, "< InvocationUpnp::Invoke (%p, action ", &iInvocation);
     LOG(kService, iInvocation.Action().Name());
@@ -48,57 +179,43 @@ void InvocationUpnp::WriteServiceType(IWriterAscii& aWriter, const Invocation& a
     aWriter.Write(serviceType.FullName());
 }
 
-void InvocationUpnp::WriteRequest(const Uri& aUri)
+void InvocationUpnp::WriteRequest(IWriter& aWriter, const Invocation& aInvocation, const Uri& aUri)
 {
-    Sws<1024> writeBuffer(iSocket);
-    WriterHttpRequest writerRequest(writeBuffer);
+    WriterHttpRequest writerRequest(aWriter);
     Bwh body;
 
-    try {
-        Endpoint endpoint(aUri.Port(), aUri.Host());
-        TUint timeout = Stack::InitParams().TcpConnectTimeoutMs();
-        iSocket.Connect(endpoint, timeout);
-    }
-    catch (NetworkTimeout&) {
-        iInvocation.SetError(Error::eSocket, Error::eCodeTimeout, Error::kDescriptionSocketTimeout);
-        THROW(NetworkTimeout);
-    }
-
-    try {
-        InvocationBodyWriter::Write(iInvocation, body);
-        WriteHeaders(writerRequest, aUri, body.Bytes());
-        writeBuffer.Write(body);
-        writeBuffer.WriteFlush();
-    }
-    catch (WriterError) {
-        iInvocation.SetError(Error::eHttp, Error::kCodeUnknown, Error::kDescriptionUnknown);
-        THROW(WriterError);
-    }
+    InvocationBodyWriter::Write(aInvocation, body);
+    WriteHeaders(writerRequest, aInvocation, aUri, body.Bytes());
+    aWriter.Write(body);
 }
 
-void InvocationUpnp::ReadResponse()
+void InvocationUpnp::ReadResponse(Invocation& aInvocation, Srx& aReadBuffer, TUint aTimeoutMs, TBool& aReusable)
 {
     OutputProcessorUpnp outputProcessor;
+    ReaderHttpResponse readerResponse(aReadBuffer);
     HttpHeaderContentLength headerContentLength;
     HttpHeaderTransferEncoding headerTransferEncoding;
+    HttpHeaderConnection headerConnection;
     Bwh entity;
 
-    iReaderResponse.AddHeader(headerContentLength);
-    iReaderResponse.AddHeader(headerTransferEncoding);
-    iReaderResponse.Read(kResponseTimeoutMs);
-    const HttpStatus& status = iReaderResponse.Status();
+    readerResponse.AddHeader(headerContentLength);
+    readerResponse.AddHeader(headerTransferEncoding);
+    readerResponse.AddHeader(headerConnection);
+    readerResponse.Read(aTimeoutMs);
+    const HttpStatus& status = readerResponse.Status();
     if (status != HttpStatus::kOk) {
         LOG2(kService, kError, "InvocationUpnp::ReadResponse, http error %u ", status.Code());
         LOG2(kService, kError, status.Reason());
         LOG2(kService, kError, "\n");
         if (status != HttpStatus::kInternalServerError) {
-            iInvocation.SetError(Error::eHttp, status.Code(), status.Reason());
+            aInvocation.SetError(Error::eHttp, status.Code(), status.Reason());
             THROW(HttpError);
         }
     }
 
+    TBool keepAlive = (readerResponse.Version() == Http::eHttp11? !headerConnection.Close() : headerConnection.KeepAlive());
     if (headerTransferEncoding.IsChunked()) {
-        ReaderHttpChunked dechunker(iReadBuffer);
+        ReaderHttpChunked dechunker(aReadBuffer);
         dechunker.Read();
         dechunker.TransferTo(entity);
     }
@@ -108,26 +225,28 @@ void InvocationUpnp::ReadResponse()
             Bwh buf(length);
             while (length > 0) {
                 TUint readBytes = (length<kMaxReadBytes? length : kMaxReadBytes);
-                buf.Append(iReadBuffer.Read(readBytes));
+                buf.Append(aReadBuffer.Read(readBytes));
                 length -= readBytes;
             }
             buf.TransferTo(entity);
         }
-        else { // no content length - read until connection closed by server
+        else if (!headerContentLength.Received()) { // no content length - read until connection closed by server
+            keepAlive = false;
             try {
                 for (;;) {
-                    Brn buf = iReadBuffer.Read(kMaxReadBytes);
+                    Brn buf = aReadBuffer.Read(kMaxReadBytes);
                     entity.Grow(entity.Bytes() + kMaxReadBytes);
                     entity.Append(buf);
                 }
             }
             catch (ReaderError&) {
-                Brn snaffle = iReadBuffer.Snaffle();
+                Brn snaffle = aReadBuffer.Snaffle();
                 entity.Grow(entity.Bytes() + snaffle.Bytes());
                 entity.Append(snaffle);
             }
         }
     }
+    aReusable = keepAlive; // full response has been read so the connection can be used again
 
     if (status == HttpStatus::kInternalServerError) {
         Brn envelope = XmlParserBasic::Find("Envelope", entity);
@@ -136,34 +255,37 @@ void InvocationUpnp::ReadResponse()
         Brn detail = XmlParserBasic::Find("detail", fault);
         Brn code = XmlParserBasic::Find("errorCode", detail);
         Brn description = XmlParserBasic::Find("errorDescription", detail);
-        iInvocation.SetError(Error::eUpnp, Ascii::Uint(code), description);
+        aInvocation.SetError(Error::eUpnp, Ascii::Uint(code), description);
         THROW(HttpError);
     }
 
-    const Invocation::VectorArguments& outArgs = iInvocation.OutputArguments();
+    const Invocation::VectorArguments& outArgs = aInvocation.OutputArguments();
     const TUint count = (TUint)outArgs.size();
     Brn envelope = XmlParserBasic::Find("Envelope", entity);
     Brn body = XmlParserBasic::Find("Body", envelope);
     const Brn responseTagTrailer("Response");
-    const Brx& actionName = iInvocation.Action().Name();
+    const Brx& actionName = aInvocation.Action().Name();
     TUint len = actionName.Bytes() + responseTagTrailer.Bytes();
     Bwh responseTag(len);
     responseTag.Append(actionName);
     responseTag.Append(responseTagTrailer);
     Brn response = XmlParserBasic::Find(responseTag, body);
+    XmlParserChildIndex args;
+    args.Set(response);
     for (TUint i=0; i<count; i++) {
         const Brx& name = outArgs[i]->Parameter().Name();
-        Brn value = XmlParserBasic::Find(name, response);
+        Brn value = args.Find(name);
         outArgs[i]->ProcessOutput(outputProcessor, value);
     }
 }
 
-void InvocationUpnp::WriteHeaders(WriterHttpRequest& aWriterRequest, const Uri& aUri, TUint aBodyBytes)
+void InvocationUpnp::WriteHeaders(WriterHttpRequest& aWriterRequest, const Invocation& aInvocation,
+                                  const Uri& aUri, TUint aBodyBytes)
 {
     const Brn kContentType("text/xml; charset=\"utf-8\"");
     const Brn kSoapAction("SOAPACTION");
 
-    aWriterRequest.WriteMethod(Http::kMethodPost, aUri.PathAndQuery(), Http::eHttp10);
+    aWriterRequest.WriteMethod(Http::kMethodPost, aUri.PathAndQuery(), Http::eHttp11);
 
     Http::WriteHeaderHostAndPort(aWriterRequest, aUri);
     Http::WriteHeaderContentLength(aWriterRequest, aBodyBytes);
@@ -171,9 +293,9 @@ void InvocationUpnp::WriteHeaders(WriterHttpRequest& aWriterRequest, const Uri&
 
     IWriterAscii& writerField = aWriterRequest.WriteHeaderField(kSoapAction);
     writerField.Write('\"');
-    WriteServiceType(writerField, iInvocation);
+    WriteServiceType(writerField, aInvocation);
     writerField.Write('#');
-    writerField.Write(iInvocation.Action().Name());
+    writerField.Write(aInvocation.Action().Name());
     writerField.Write('\"');
     writerField.WriteNewline();
 
@@ -184,7 +306,290 @@ void InvocationUpnp::Interrupt()
 {
     /* Assumes that interrupting the socket is always safe, regardless of whether we're
        using it or one of its stream/http wrappers */
-    iSocket.Interrupt(true);
+    iConnection->iSocket.Interrupt(true);
+}
+
+
+// InvocationReactorUpnp::Request
+
+class InvocationReactorUpnp::Request : public ReactorHttpExchange, public IInterruptHandler
+{
+    friend class InvocationReactorUpnp;
+public:
+    Request(InvocationReactorUpnp& aOwner, Invocation& aInvocation, const Endpoint& aEndpoint, InvocationConnectionPool& aConnectionPool);
+private: // ReactorHttpExchange
+    SocketTcpClient& ClaimConnection(const Endpoint& aEndpoint, TBool& aReused);
+    void ReleaseConnection(TBool aReusable);
+    void Connected();
+    TBool Retryable() const;
+private: // IInterruptHandler
+    void Interrupt();
+private:
+    InvocationReactorUpnp& iOwner;
+    Invocation& iInvocation;
+    Endpoint iEndpoint;
+    InvocationConnectionPool& iConnectionPool;
+    InvocationConnection* iConnection;
+    Bwh iRequest;
+    TBool iInterrupted;
+};
+
+InvocationReactorUpnp::Request::Request(InvocationReactorUpnp& aOwner, Invocation& aInvocation, const Endpoint& aEndpoint, InvocationConnectionPool& aConnectionPool)
+    : iOwner(aOwner)
+    , iInvocation(aInvocation)
+    , iEndpoint(aEndpoint)
+    , iConnectionPool(aConnectionPool)
+    , iConnection(NULL)
+    , iInterrupted(false)
+{
+}
+
+SocketTcpClient& InvocationReactorUpnp::Request::ClaimConnection(const Endpoint& aEndpoint, TBool& aReused)
+{
+    iConnection = iConnectionPool.Claim(aEndpoint);
+    aReused = iConnection->iConnected;
+    return iConnection->iSocket;
+}
+
+void InvocationReactorUpnp::Request::ReleaseConnection(TBool aReusable)
+{
+    iConnectionPool.Release(iConnection, aReusable && !iInterrupted && !iInvocation.Interrupt());
+    iConnection = NULL;
+}
+
+void InvocationReactorUpnp::Request::Connected()
+{
+    iConnection->iConnected = true;
+}
+
+TBool InvocationReactorUpnp::Request::Retryable() const
+{
+    return !iInterrupted;
+}
+
+void InvocationReactorUpnp::Request::Interrupt()
+{
+    // called with the invocation's lock held; just flag the request for the reactor thread
+    iInterrupted = true;
+    iOwner.RequestInterrupted();
+}
+
+
+// ResponseSource - feeds a buffered response to InvocationUpnp::ReadResponse()
+
+namespace OpenHome {
+namespace Net {
+
+class ResponseSource : public IReaderSource, private INonCopyable
+{
+public:
+    ResponseSource(const Brx& aResponse);
+private: // IReaderSource
+    void Read(Bwx& aBuffer);
+    void ReadFlush();
+    void ReadInterrupt();
+private:
+    const Brx& iResponse;
+    TUint iOffset;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+ResponseSource::ResponseSource(const Brx& aResponse)
+    : iResponse(aResponse)
+    , iOffset(0)
+{
+}
+
+void ResponseSource::Read(Bwx& aBuffer)
+{
+    TUint bytes = iResponse.Bytes() - iOffset;
+    if (bytes == 0) {
+        THROW(ReaderError); // more of the response is still to arrive
+    }
+    if (bytes > aBuffer.MaxBytes()) {
+        bytes = aBuffer.MaxBytes();
+    }
+    aBuffer.Replace(iResponse.Split(iOffset, bytes));
+    iOffset += bytes;
+}
+
+void ResponseSource::ReadFlush()
+{
+}
+
+void ResponseSource::ReadInterrupt()
+{
+}
+
+
+// InvocationReactorUpnp
+
+InvocationReactorUpnp::InvocationReactorUpnp()
+    : ReactorHttpClient("INVR", 0, eReadUntilClosed)
+    , iLock("INVR")
+    , iScanInterrupts(false)
+{
+    ReactorHttpClient::Start();
+}
+
+InvocationReactorUpnp::~InvocationReactorUpnp()
+{
+    Stop();
+    for (TUint i=0; i<(TUint)iQueued.size(); i++) {
+        Fail(*iQueued[i], Error::eAsync, Error::eCodeShutdown, Error::kDescriptionAsyncShutdown, "Shutdown");
+    }
+    iQueued.clear();
+    while (ActiveCount() > 0) {
+        Fail(static_cast<Request&>(Active(ActiveCount() - 1)), Error::eAsync, Error::eCodeShutdown, Error::kDescriptionAsyncShutdown, "Shutdown");
+    }
+}
+
+void InvocationReactorUpnp::Invoke(Invocation& aInvocation, const Uri& aUri, InvocationConnectionPool& aConnectionPool)
+{
+    LOG(kService, "InvocationReactorUpnp::Invoke (%p, action ", &aInvocation);
+    LOG(kService, aInvocation.Action().Name());
+    LOG(kService, ")\n");
+
+    Endpoint endpoint(aUri.Port(), aUri.Host());
+    WriterBwh writer(1024);
+    InvocationUpnp::WriteRequest(writer, aInvocation, aUri);
+    Request* request = new Request(*this, aInvocation, endpoint, aConnectionPool);
+    writer.TransferTo(request->iRequest);
+
+    iLock.Wait();
+    iQueued.push_back(request);
+    iLock.Signal();
+    Wake();
+}
+
+void InvocationReactorUpnp::RequestInterrupted()
+{
+    iLock.Wait();
+    iScanInterrupts = true;
+    iLock.Signal();
+    Wake();
+}
+
+void InvocationReactorUpnp::Start(Request& aRequest)
+{
+    aRequest.iInvocation.SetInterruptHandler(&aRequest);
+    if (aRequest.iInterrupted) {
+        Fail(aRequest, Error::eAsync, Error::eCodeInterrupted, Error::kDescriptionAsyncInterrupted, "Interrupt");
+        return;
+    }
+    Begin(aRequest, aRequest.iEndpoint, aRequest.iRequest);
+}
+
+void InvocationReactorUpnp::Fail(Request& aRequest, Error::ELevel aLevel, TUint aCode, const Brx& aDescription, const TChar* aLogStr)
+{
+    Invocation& invocation = aRequest.iInvocation;
+    invocation.SetError(aLevel, aCode, aDescription);
+    // the above error details might be ignored if an earlier (presumed more detailed) error had been set
+    Error::ELevel level;
+    TUint code;
+    const TChar* desc;
+    (void)invocation.Error(level, code, desc);
+    LOG2(kService, kError, "Error - %s(%s, %d, %s) - from invocation %p, on action ", aLogStr, Error::LevelName(level), code, (desc==NULL? "" : desc), &invocation);
+    LOG2(kService, kError, invocation.Action().Name());
+    LOG2(kService, kError, "\n");
+    Finish(aRequest, false);
+}
+
+void InvocationReactorUpnp::Finish(Request& aRequest, TBool aReusable)
+{
+    Invocation& invocation = aRequest.iInvocation;
+    invocation.SetInterruptHandler(NULL);
+    End(aRequest, aReusable);
+    delete &aRequest;
+    InvocationManager::Completed(invocation);
+}
+
+void InvocationReactorUpnp::ProcessQueued()
+{
+    std::vector<Request*> queued;
+    iLock.Wait();
+    queued.swap(iQueued);
+    const TBool scanInterrupts = iScanInterrupts;
+    iScanInterrupts = false;
+    iLock.Signal();
+
+    for (TUint i=0; i<(TUint)queued.size(); i++) {
+        Start(*queued[i]);
+    }
+    if (scanInterrupts) {
+        for (TUint i=ActiveCount(); i>0; i--) {
+            // iterate backwards as Fail() removes requests from the active list
+            Request& request = static_cast<Request&>(Active(i-1));
+            if (request.iInterrupted) {
+                Fail(request, Error::eAsync, Error::eCodeInterrupted, Error::kDescriptionAsyncInterrupted, "Interrupt");
+            }
+        }
+    }
+}
+
+TUint InvocationReactorUpnp::TimeoutMs() const
+{
+    return Stack::InitParams().InvocationTimeoutMs();
+}
+
+void InvocationReactorUpnp::ResponseReceived(ReactorHttpExchange& aExchange, TBool aClosed)
+{
+    Request& request = static_cast<Request&>(aExchange);
+    TBool reusable = false;
+    try {
+        ResponseSource source(aExchange.Response());
+        Srd readBuffer(kMaxReadBytes, source);
+        InvocationUpnp::ReadResponse(request.iInvocation, readBuffer, 0, reusable);
+    }
+    catch (HttpError&) {
+        Fail(request, Error::eHttp, Error::kCodeUnknown, Error::kDescriptionUnknown, "Http");
+        return;
+    }
+    catch (ReaderError&) {
+        if (!aClosed && aExchange.Chunked()) {
+            // data ending in what looked like the last chunk wasn't actually the end of the response
+            ContinueReceiving(aExchange);
+        }
+        else {
+            Fail(request, Error::eSocket, Error::kCodeUnknown, Error::kDescriptionUnknown, "Reader");
+        }
+        return;
+    }
+    catch (XmlError&) {
+        Fail(request, Error::eSocket, Error::kCodeUnknown, Error::kDescriptionUnknown, "Reader");
+        return;
+    }
+    catch (ParameterValidationError&) {
+        Fail(request, Error::eService, Error::eCodeParameterInvalid, Error::kDescriptionParameterInvalid, "Parameter");
+        return;
+    }
+    Finish(request, reusable && !aClosed);
+}
+
+void InvocationReactorUpnp::ExchangeFailed(ReactorHttpExchange& aExchange, EFailure aFailure)
+{
+    Request& request = static_cast<Request&>(aExchange);
+    switch (aFailure)
+    {
+    case eFailConnect:
+        Fail(request, Error::eSocket, Error::eCodeTimeout, Error::kDescriptionSocketTimeout, "Connect");
+        break;
+    case eFailConnectTimeout:
+    case eFailTimeout:
+        Fail(request, Error::eSocket, Error::eCodeTimeout, Error::kDescriptionSocketTimeout, "NetworkTimeout");
+        break;
+    case eFailWrite:
+        Fail(request, Error::eHttp, Error::kCodeUnknown, Error::kDescriptionUnknown, "Writer");
+        break;
+    case eFailNetwork:
+        Fail(request, Error::eSocket, Error::kCodeUnknown, Error::kDescriptionUnknown, "Network");
+        break;
+    case eFailResponseTooLong:
+        Fail(request, Error::eSocket, Error::kCodeUnknown, Error::kDescriptionUnknown, "Reader");
+        break;
+    }
 }
 
 
@@ -13,32 +13,140 @@
 #include <OpenHome/Private/Http.h>
 #include <OpenHome/Private/Ascii.h>
 #include <OpenHome/Private/Stream.h>
+#include <OpenHome/Private/Thread.h>
+#include <OpenHome/Net/Private/ReactorHttp.h>
+
+#include <vector>
 
 namespace OpenHome {
 namespace Net {
 
 class CpiSubscription;
 
+/**
+ * Tcp connection to a device's http server.
+ *
+ * Kept open between invocations if the device supports http keep-alive.
+ * Intended for internal use only
+ */
+class InvocationConnection : private INonCopyable
+{
+    friend class InvocationUpnp;
+    friend class InvocationConnectionPool;
+    friend class InvocationReactorUpnp;
+    friend class XmlFetch;
+public:
+    static const TUint kMaxReadBytes = 4096;
+private:
+    InvocationConnection(const Endpoint& aEndpoint);
+    ~InvocationConnection();
+    void Connect();
+private:
+    Endpoint iEndpoint;
+    OpenHome::SocketTcpClient iSocket;
+    OpenHome::SocketTcpReader iReader;
+    Srs<kMaxReadBytes> iReadBuffer;
+    TBool iConnected;
+    TUint iIdleSinceMs;
+};
+
+/**
+ * Idle keep-alive connections to a single device, shared by all invocations on it.
+ * Also used by XmlFetchManager to share connections across all devices.
+ *
+ * Connections which have been idle for kIdleTimeoutMs are closed rather than reused.
+ * Intended for internal use only
+ */
+class InvocationConnectionPool : private INonCopyable
+{
+public:
+    InvocationConnectionPool(TUint aMaxIdleConnections = kMaxIdleConnections);
+    ~InvocationConnectionPool();
+    /**
+     * Returns an idle connection to aEndpoint if one is available, otherwise a new unconnected one.
+     * Ownership passes to the caller until Release() is called.
+     */
+    InvocationConnection* Claim(const Endpoint& aEndpoint);
+    /**
+     * Return a connection claimed earlier.  aReusable indicates whether a complete response
+     * was read and the device agreed to keep the connection open.
+     */
+    void Release(InvocationConnection* aConnection, TBool aReusable);
+private:
+    void RemoveExpiredLocked(TUint aTimeNowMs);
+private:
+    static const TUint kMaxIdleConnections = 4;
+    static const TUint kIdleTimeoutMs = 3 * 1000;
+    const TUint iMaxIdleConnections;
+    Mutex iLock;
+    std::vector<InvocationConnection*> iIdle;
+};
+
 class InvocationUpnp : private IInterruptHandler
 {
+    friend class InvocationReactorUpnp;
 public:
-    InvocationUpnp(Invocation& aInvocation);
+    InvocationUpnp(Invocation& aInvocation, InvocationConnectionPool& aConnectionPool);
     ~InvocationUpnp();
     void Invoke(const Uri& aUri);
     static void WriteServiceType(IWriterAscii& aWriter, const Invocation& aInvocation);
 private:
-    void WriteRequest(const Uri& aUri);
-    void ReadResponse();
-    void WriteHeaders(WriterHttpRequest& aWriterRequest, const Uri& aUri, TUint aBodyBytes);
+    static void WriteRequest(IWriter& aWriter, const Invocation& aInvocation, const Uri& aUri);
+    /**
+     * Read a complete response, setting output arguments or errors on aInvocation.
+     * aReusable is set if the whole response was read and the device will keep the
+     * connection open.
+     */
+    static void ReadResponse(Invocation& aInvocation, Srx& aReadBuffer, TUint aTimeoutMs, TBool& aReusable);
+    static void WriteHeaders(WriterHttpRequest& aWriterRequest, const Invocation& aInvocation,
+                             const Uri& aUri, TUint aBodyBytes);
     // IInterruptHandler
     void Interrupt();
 private:
-    static const TUint kMaxReadBytes = 4096;
-    static const TUint kResponseTimeoutMs = 60 * 1000;
+    static const TUint kMaxReadBytes = InvocationConnection::kMaxReadBytes;
     Invocation& iInvocation;
-    OpenHome::SocketTcpClient iSocket;
-    Srs<kMaxReadBytes> iReadBuffer;
-    ReaderHttpResponse iReaderResponse;
+    InvocationConnectionPool& iConnectionPool;
+    InvocationConnection* iConnection;
+    TBool iReusable;
+};
+
+/**
+ * Runs UPnP invocations without dedicating a thread to each.
+ *
+ * Requests are exchanged by a ReactorHttpClient so the number in flight is bounded by
+ * sockets rather than threads.  Finished invocations are passed to InvocationManager::Completed().
+ * Construction throws NetworkError on platforms with no reactor support.
+ * Intended for internal use only
+ */
+class InvocationReactorUpnp : private ReactorHttpClient
+{
+public:
+    InvocationReactorUpnp();
+    /**
+     * Any invocations still pending complete with a shutdown error
+     */
+    ~InvocationReactorUpnp();
+    /**
+     * Queue aInvocation to be sent to aUri.  Returns without waiting for a connection.
+     * Throws NetworkError if aUri's host cannot be resolved; aInvocation is not queued then.
+     */
+    void Invoke(Invocation& aInvocation, const Uri& aUri, InvocationConnectionPool& aConnectionPool);
+private:
+    class Request;
+    void RequestInterrupted();
+    void Start(Request& aRequest);
+    void Fail(Request& aRequest, Error::ELevel aLevel, TUint aCode, const Brx& aDescription, const TChar* aLogStr);
+    void Finish(Request& aRequest, TBool aReusable);
+private: // ReactorHttpClient
+    void ProcessQueued();
+    TUint TimeoutMs() const;
+    void ResponseReceived(ReactorHttpExchange& aExchange, TBool aClosed);
+    void ExchangeFailed(ReactorHttpExchange& aExchange, EFailure aFailure);
+private:
+    static const TUint kMaxReadBytes = InvocationConnection::kMaxReadBytes;
+    Mutex iLock;
+    std::vector<Request*> iQueued;  // protected by iLock
+    TBool iScanInterrupts;          // protected by iLock
 };
 
 /**
@@ -7,6 +7,7 @@
 #include <OpenHome/Private/Debug.h>
 
 #include <stdlib.h>
+#include <stdio.h>
 
 using namespace OpenHome;
 using namespace OpenHome::Net;
@@ -22,6 +23,10 @@ void XmlFetch::Set(OpenHome::Uri* aUri, FunctorAsync& aFunctor)
 
 XmlFetch::~XmlFetch()
 {
+    if (iConnection != NULL) {
+        // fetch failed part way through; the connection's state is unknown so don't reuse it
+        iConnectionPool->Release(iConnection, false);
+    }
     delete iUri;
 }
 
@@ -62,43 +67,71 @@ void XmlFetch::SetError(Error::ELevel aLevel, TUint aCode, const Brx& aDescripti
     }
 }
 
-void XmlFetch::Fetch()
+void XmlFetch::Fetch(InvocationConnectionPool& aConnectionPool)
 {
     LOG(kXmlFetch, "> XmlFetch::Fetch for ");
     LOG(kXmlFetch, iUri->AbsoluteUri());
     LOG(kXmlFetch, "\n");
-    
-    OpenHome::SocketTcpClient socket;
-    socket.Open();
-    AutoSocket a(socket);
-    iLock.Wait();
-    if (iInterrupted) {
-        SetError(Error::eAsync, Error::eCodeInterrupted, Error::kDescriptionAsyncInterrupted);
-        iLock.Signal();
-        THROW(ReaderError);
-    }
-    iSocket = &socket;
-    iLock.Signal();
-    try {
-        Endpoint endpoint(iUri->Port(), iUri->Host());
-        TUint timeout = Stack::InitParams().TcpConnectTimeoutMs();
-        socket.Connect(endpoint, timeout);
-    }
-    catch (NetworkTimeout&) {
-        SetError(Error::eSocket, Error::eCodeTimeout, Error::kDescriptionSocketTimeout);
-        THROW(NetworkTimeout);
+
+    Endpoint endpoint(iUri->Port(), iUri->Host());
+    iConnectionPool = &aConnectionPool;
+    iConnection = aConnectionPool.Claim(endpoint);
+    TBool reusable = false;
+    for (;;) {
+        const TBool reused = iConnection->iConnected;
+        SetSocket(&iConnection->iSocket);
+        try {
+            if (!reused) {
+                try {
+                    iConnection->Connect();
+                }
+                catch (NetworkTimeout&) {
+                    SetError(Error::eSocket, Error::eCodeTimeout, Error::kDescriptionSocketTimeout);
+                    THROW(NetworkTimeout);
+                }
+            }
+            WriteRequest(iConnection->iSocket);
+            Read(iConnection->iReadBuffer, reusable);
+            break;
+        }
+        catch (WriterError&) {
+            if (!reused || Interrupted()) {
+                throw;
+            }
+        }
+        catch (ReaderError&) {
+            if (!reused || !iConnection->iReader.ClosedBeforeData() || Interrupted()) {
+                throw;
+            }
+        }
+        /* The host closed a keep-alive connection while it was idle.  Nothing has been
+           read back so retry on another connection.  A timeout or partial response is
+           reported rather than doubling the time spent waiting on an unresponsive host. */
+        LOG(kXmlFetch, "XmlFetch::Fetch - stale connection, retrying\n");
+        SetSocket(NULL);
+        aConnectionPool.Release(iConnection, false);
+        iConnection = NULL;
+        iConnection = aConnectionPool.Claim(endpoint);
     }
-    WriteRequest(socket);
-    Read(socket);
-    iLock.Wait();
-    iSocket = NULL;
-    iLock.Signal();
+    SetSocket(NULL);
+    aConnectionPool.Release(iConnection, reusable && !Interrupted());
+    iConnection = NULL;
 
     LOG(kXmlFetch, "< XmlFetch::Fetch for ");
     LOG(kXmlFetch, iUri->AbsoluteUri());
     LOG(kXmlFetch, "\n");
 }
 
+void XmlFetch::SetSocket(OpenHome::SocketTcpClient* aSocket)
+{
+    AutoMutex a(iLock);
+    if (aSocket != NULL && iInterrupted) {
+        SetError(Error::eAsync, Error::eCodeInterrupted, Error::kDescriptionAsyncInterrupted);
+        THROW(ReaderError);
+    }
+    iSocket = aSocket;
+}
+
 void XmlFetch::Interrupt()
 {
     iLock.Wait();
@@ -134,6 +167,8 @@ XmlFetch::XmlFetch()
     , iLock("XMLM")
     , iInterrupted(false)
     , iSocket(NULL)
+    , iConnectionPool(NULL)
+    , iConnection(NULL)
 {
 }
 
@@ -145,19 +180,19 @@ void XmlFetch::WriteRequest(SocketTcpClient& aSocket)
     writerRequest.WriteMethod(Http::kMethodGet, iUri->PathAndQuery(), Http::eHttp11);
     Http::WriteHeaderHost(writerRequest, *iUri);
     Http::WriteHeaderContentLength(writerRequest, 0);
-    Http::WriteHeaderConnectionClose(writerRequest);
     writerRequest.WriteFlush();
 }
 
-void XmlFetch::Read(SocketTcpClient& aSocket)
+void XmlFetch::Read(Srx& aReadBuffer, TBool& aReusable)
 {
-    Srd readBuffer(kRwBufferLength, aSocket);
-    ReaderHttpResponse readerResponse(readBuffer);
+    ReaderHttpResponse readerResponse(aReadBuffer);
     HttpHeaderContentLength headerContentLength;
     HttpHeaderTransferEncoding headerTransferEncoding;
+    HttpHeaderConnection headerConnection;
 
     readerResponse.AddHeader(headerContentLength);
     readerResponse.AddHeader(headerTransferEncoding);
+    readerResponse.AddHeader(headerConnection);
     readerResponse.Read(kResponseTimeoutMs);
     const HttpStatus& status = readerResponse.Status();
     if (status != HttpStatus::kOk) {
@@ -168,37 +203,37 @@ void XmlFetch::Read(SocketTcpClient& aSocket)
         THROW(HttpError);
     }
 
+    TBool keepAlive = (readerResponse.Version() == Http::eHttp11? !headerConnection.Close() : headerConnection.KeepAlive());
     if (headerTransferEncoding.IsChunked()) {
-        ReaderHttpChunked dechunker(readBuffer);
+        ReaderHttpChunked dechunker(aReadBuffer);
         dechunker.Read();
         dechunker.TransferTo(iXml);
     }
-    else {
-        TUint remaining = headerContentLength.ContentLength();
-        if (remaining == 0) { // no content length - read until connection closed by server
-            try {
-                for (;;) {
-                    Brn buf = readBuffer.Read(kRwBufferLength);
-                    iXml.Grow(iXml.Bytes() + kRwBufferLength);
-                    iXml.Append(buf);
-                }
-            }
-            catch (ReaderError&) {
-                Brn snaffle = readBuffer.Snaffle();
-                iXml.Grow(iXml.Bytes() + snaffle.Bytes());
-                iXml.Append(snaffle);
-            }
-        }
-        else {
-            while (remaining > 0) {
-                TInt readBytes = (remaining > kRwBufferLength ? kRwBufferLength : remaining);
-                Brn buf = readBuffer.Read(readBytes);
-                iXml.Grow(iXml.Bytes() + readBytes);
+    else if (!headerContentLength.Received()) { // no content length - read until connection closed by server
+        keepAlive = false;
+        try {
+            for (;;) {
+                Brn buf = aReadBuffer.Read(kMaxReadBytes);
+                iXml.Grow(iXml.Bytes() + kMaxReadBytes);
                 iXml.Append(buf);
-                remaining -= readBytes;
             }
         }
+        catch (ReaderError&) {
+            Brn snaffle = aReadBuffer.Snaffle();
+            iXml.Grow(iXml.Bytes() + snaffle.Bytes());
+            iXml.Append(snaffle);
+        }
     }
+    else {
+        TUint remaining = headerContentLength.ContentLength();
+        iXml.Grow(remaining);
+        while (remaining > 0) {
+            TUint readBytes = (remaining > kMaxReadBytes ? kMaxReadBytes : remaining);
+            iXml.Append(aReadBuffer.Read(readBytes));
+            remaining -= readBytes;
+        }
+    }
+    aReusable = keepAlive; // full response has been read so the connection can be used again
 }
 
 void XmlFetch::Output(IAsyncOutput& aConsole)
@@ -226,9 +261,12 @@ TUint XmlFetch::Type() const
 
 // XmlFetcher
 
-XmlFetcher::XmlFetcher(const TChar* aName, Fifo<XmlFetcher*>& aFree)
+XmlFetcher::XmlFetcher(const TChar* aName, XmlFetchManager& aManager)
     : Thread(aName)
-    , iFree(aFree)
+    , iManager(aManager)
+    , iFetch(NULL)
+    , iBusy(false)
+    , iPort(0)
 {
 }
 
@@ -265,7 +303,7 @@ void XmlFetcher::Run()
                                  Error::kDescriptionAsyncInterrupted);
             }
             else {
-                iFetch->Fetch();
+                iFetch->Fetch(iManager.iConnectionPool);
             }
         }
         catch (HttpError&) {
@@ -291,8 +329,8 @@ void XmlFetcher::Run()
         iFetch->SignalCompleted();
         delete iFetch;
         iFetch = NULL;
-        
-        iFree.Write(this);
+
+        iManager.FetchComplete(*this);
     }
 }
 
@@ -302,17 +340,16 @@ void XmlFetcher::Run()
 XmlFetchManager::XmlFetchManager()
     : Thread("FETM")
     , iLock("FETL")
-    , iFree(Stack::InitParams().NumXmlFetcherThreads())
+    , iNumFetchers(Stack::InitParams().NumXmlFetcherThreads())
+    , iConnectionPool(Stack::InitParams().NumXmlFetcherThreads())
 {
-    iFetchers = (XmlFetcher**)malloc(sizeof(*iFetchers) * Stack::InitParams().NumXmlFetcherThreads());
-    TChar thName[5] = "FET ";
-#ifndef _WIN32
-    ASSERT(Stack::InitParams().NumXmlFetcherThreads() <= 9);
-#endif
-    for (TUint i=0; i<Stack::InitParams().NumXmlFetcherThreads(); i++) {
-        thName[3] = (TChar)('0'+i);
-        iFetchers[i] = new XmlFetcher(&thName[0], iFree);
-        iFree.Write(iFetchers[i]);
+    iFetchers = (XmlFetcher**)malloc(sizeof(*iFetchers) * iNumFetchers);
+    iFree.reserve(iNumFetchers);
+    TChar thName[5];
+    for (TUint i=0; i<iNumFetchers; i++) {
+        (void)sprintf(&thName[0], "F%03lu", (unsigned long)(i % 1000));
+        iFetchers[i] = new XmlFetcher(&thName[0], *this);
+        iFree.push_back(iFetchers[i]);
         iFetchers[i]->Start();
     }
 
@@ -326,13 +363,11 @@ XmlFetchManager::~XmlFetchManager()
 
     iLock.Wait();
     iActive = false;
+    iLock.Signal();
     Kill();
     Join();
-    iLock.Signal();
 
-    iFree.ReadInterrupt();
-
-    for (TUint i=0; i<Stack::InitParams().NumXmlFetcherThreads(); i++) {
+    for (TUint i=0; i<iNumFetchers; i++) {
         delete iFetchers[i];
     }
     free(iFetchers);
@@ -384,20 +419,50 @@ XmlFetchManager& XmlFetchManager::Self()
     return CpiStack::XmlFetchManager();;
 }
 
+void XmlFetchManager::FetchComplete(XmlFetcher& aFetcher)
+{
+    iLock.Wait();
+    aFetcher.iBusy = false;
+    iFree.push_back(&aFetcher);
+    iLock.Signal();
+    Signal(); // a fetch held back by kMaxFetchesPerHost may now be able to start
+}
+
+TUint XmlFetchManager::NumFetchesLocked(const Brx& aHost, TUint aPort) const
+{
+    TUint count = 0;
+    for (TUint i=0; i<iNumFetchers; i++) {
+        const XmlFetcher& fetcher = *iFetchers[i];
+        if (fetcher.iBusy && fetcher.iPort == aPort && fetcher.iHost == aHost) {
+            count++;
+        }
+    }
+    return count;
+}
+
 void XmlFetchManager::Run()
 {
     for (;;) {
         Wait();
-        XmlFetcher* fetcher = iFree.Read();
-        iLock.Wait();
+        AutoMutex a(iLock);
         if (!iActive) {
-            iLock.Signal();
             continue; // the next Wait() will throw ThreadKill
         }
-        XmlFetch* fetch = iList.front();
-        iList.front() = NULL;
-        iList.pop_front();
-        iLock.Signal();
-        fetcher->Fetch(fetch);
+        std::list<XmlFetch*>::iterator it = iList.begin();
+        while (!iFree.empty() && it != iList.end()) {
+            XmlFetch* fetch = *it;
+            const OpenHome::Uri& uri = fetch->Uri();
+            if (NumFetchesLocked(uri.Host(), (TUint)uri.Port()) >= kMaxFetchesPerHost) {
+                it++;
+                continue;
+            }
+            it = iList.erase(it);
+            XmlFetcher* fetcher = iFree.back();
+            iFree.pop_back();
+            fetcher->iBusy = true;
+            fetcher->iHost.Replace(uri.Host());
+            fetcher->iPort = (TUint)uri.Port();
+            fetcher->Fetch(fetch);
+        }
     }
 }
@@ -9,11 +9,12 @@
 #include <OpenHome/Private/Thread.h>
 #include <OpenHome/Private/Uri.h>
 #include <OpenHome/OhNetTypes.h>
-#include <OpenHome/Private/Fifo.h>
 #include <OpenHome/Private/Stream.h>
 #include <OpenHome/Net/Private/Error.h>
+#include <OpenHome/Net/Private/ProtocolUpnp.h>
 
 #include <list>
+#include <vector>
 
 EXCEPTION(XmlFetchError);
 
@@ -21,6 +22,8 @@ namespace OpenHome {
 class SocketTcpClient;
 namespace Net {
 
+class XmlFetchManager;
+
 class XmlFetch : public Async
 {
 public:
@@ -30,18 +33,23 @@ public:
     void SignalCompleted();
     void SetError(Error::ELevel aLevel, TUint aCode, const Brx& aDescription);
     static Bwh& Xml(IAsync& aAsync);
-    void Fetch();
+    /**
+     * Fetch the xml, reusing a keep-alive connection from aConnectionPool if one is available
+     */
+    void Fetch(InvocationConnectionPool& aConnectionPool);
     void Interrupt();
     TBool Interrupted() const;
 private:
     XmlFetch();
     TBool Error() const;
+    void SetSocket(OpenHome::SocketTcpClient* aSocket);
     void WriteRequest(SocketTcpClient& aSocket);
-    void Read(SocketTcpClient& aSocket);
+    void Read(Srx& aReadBuffer, TBool& aReusable);
     virtual void Output(IAsyncOutput& aConsole);
     virtual TUint Type() const;
 private:
     static const TUint kRwBufferLength = 16*1024;
+    static const TUint kMaxReadBytes = InvocationConnection::kMaxReadBytes;
     static const TUint kResponseTimeoutMs = 60 * 1000;
     OpenHome::Uri* iUri;
     FunctorAsync iFunctor;
@@ -51,26 +59,41 @@ private:
     mutable OpenHome::Mutex iLock;
     TBool iInterrupted;
     OpenHome::SocketTcpClient* iSocket;
+    InvocationConnectionPool* iConnectionPool;
+    InvocationConnection* iConnection;
 
     friend class XmlFetchManager;
 };
 
 class XmlFetcher : public Thread
 {
+    friend class XmlFetchManager;
 public:
-    XmlFetcher(const TChar* aName, Fifo<XmlFetcher*>& aFree);
+    XmlFetcher(const TChar* aName, XmlFetchManager& aManager);
     ~XmlFetcher();
     void Fetch(XmlFetch* aFetch);
 private:
     void LogError(const TChar* aErr);
     void Run();
 private:
-    Fifo<XmlFetcher*>& iFree;
+    XmlFetchManager& iManager;
     XmlFetch* iFetch;
+    // host and port of the current fetch, guarded by XmlFetchManager::iLock
+    TBool iBusy;
+    Bws<OpenHome::Uri::kMaxUriBytes> iHost;
+    TUint iPort;
 };
 
+/**
+ * Schedules xml fetches on a pool of XmlFetcher threads.
+ *
+ * Fetches are started in the order they were requested, except that no more than
+ * kMaxFetchesPerHost are run concurrently against any one host.  Connections are
+ * kept open between fetches if the host supports http keep-alive.
+ */
 class XmlFetchManager : public Thread
 {
+    friend class XmlFetcher;
 public:
     XmlFetchManager();
     ~XmlFetchManager();
@@ -78,12 +101,17 @@ public:
     static void Fetch(XmlFetch* aFetch);
 private:
     static XmlFetchManager& Self();
+    void FetchComplete(XmlFetcher& aFetcher);
+    TUint NumFetchesLocked(const Brx& aHost, TUint aPort) const;
     void Run();
 private:
+    static const TUint kMaxFetchesPerHost = 2;
     OpenHome::Mutex iLock;
     std::list<XmlFetch*> iList;
-    Fifo<XmlFetcher*> iFree;
+    std::vector<XmlFetcher*> iFree;
     XmlFetcher** iFetchers;
+    TUint iNumFetchers;
+    InvocationConnectionPool iConnectionPool;
     TBool iActive;
 };
 
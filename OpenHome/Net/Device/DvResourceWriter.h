@@ -13,9 +13,46 @@ namespace Net {
 class IResourceWriter
 {
 public:
+    /**
+     * Optionally called before WriteResourceEntityTag and WriteResourceBegin to offer a
+     * compressed version of the file
+     *
+     * May be called several times, in order of preference, until one encoding is accepted.
+     *
+     * @param[in] aContentEncoding  HTTP content-coding of the compressed file (e.g. "gzip")
+     *
+     * @return  true if the client accepts aContentEncoding.  The size passed to WriteResourceBegin
+     *          and all data written must then be for the compressed file.
+     *          false if the uncompressed file (or another encoding) should be written instead.
+     */
+    virtual bool WriteResourceContentEncoding(const char* /*aContentEncoding*/) { return false; }
+    /**
+     * Optionally called before WriteResourceBegin to identify the version of the file being served
+     *
+     * @param[in] aEntityTag   Strong entity tag, including quotes, which changes whenever the file does
+     *
+     * @return  true if the client already holds this version of the file.  A 'not modified'
+     *          response will have been sent and no other function should be called.
+     *          false if the file should be written as normal.
+     */
+    virtual bool WriteResourceEntityTag(const char* /*aEntityTag*/) { return false; }
+    /**
+     * Optionally called before WriteResourceBegin (and after any WriteResourceEntityTag)
+     * to report when the file was last changed
+     *
+     * @param[in] aLastModified  Time of the last change, in seconds since 1970 (UTC)
+     *
+     * @return  true if the client's copy of the file is still current.  A 'not modified'
+     *          response will have been sent and no other function should be called.
+     *          false if the file should be written as normal.
+     */
+    virtual bool WriteResourceLastModified(uint64_t /*aLastModified*/) { return false; }
     /**
      * Must be called before writing any file data
      *
+     * The whole file should always be written; if the client requested a byte range, only
+     * that range will be sent on to it.
+     *
      * @param[in] aTotalBytes  Size in bytes of the file.  Can be 0 if size is unknown.
      * @param[in] aMimeType    MIME type of the file.  May be NULL if this is unknown.
      */
@@ -29,6 +66,28 @@ public:
      * @param[in] aBytes       Size in bytes of aData
      */
     virtual void WriteResource(const uint8_t* aData, uint32_t aBytes) = 0;
+    /**
+     * Alternative to WriteResource for file data which is already in memory (e.g. a memory mapped file)
+     *
+     * Large regions are sent directly to the client rather than being copied through the
+     * writer's buffers.  May be mixed with calls to WriteResource.
+     *
+     * @param[in] aData        File data to write.  Need only remain valid until this returns.
+     * @param[in] aBytes       Size in bytes of aData
+     */
+    virtual void WriteResourceRegion(const uint8_t* aData, uint32_t aBytes) { WriteResource(aData, aBytes); }
+    /**
+     * Alternative to WriteResource which sends part of an open file without copying it
+     * through user space where the platform allows.
+     *
+     * @param[in] aFile        Native file descriptor, open for reading.  Ownership is not transferred.
+     * @param[in] aOffset      Offset into aFile of the first byte to write
+     * @param[in] aBytes       Number of bytes to write
+     *
+     * @return  true if the data was written; false if this writer can't send from a file,
+     *          in which case the caller should read the data and pass it to WriteResource.
+     */
+    virtual bool WriteResourceFile(int32_t /*aFile*/, uint64_t /*aOffset*/, uint32_t /*aBytes*/) { return false; }
     /**
      * Called when serving of a file is complete
      *
@@ -183,6 +183,16 @@ void PropertyWriter2::PropertyWriteEnd()
     iPropertyUpdate = iMerger.MergeUpdate(iPropertyUpdate);
 }
 
+TBool PropertyWriter2::SupportsEncodedProperties() const
+{
+    return false;
+}
+
+void PropertyWriter2::PropertyWriteEncoded(const Brx& /*aProperties*/)
+{
+    ASSERTS();
+}
+
    
 // PropertyUpdatesFlattened
 
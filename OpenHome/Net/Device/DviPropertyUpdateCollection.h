@@ -62,6 +62,8 @@ private: // IPropertyWriter
     void PropertyWriteBool(const Brx& aName, TBool aValue);
     void PropertyWriteBinary(const Brx& aName, const Brx& aValue);
     void PropertyWriteEnd();
+    TBool SupportsEncodedProperties() const;
+    void PropertyWriteEncoded(const Brx& aProperties);
 private:
     IPropertyUpdateMerger& iMerger;
     PropertyUpdate* iPropertyUpdate;
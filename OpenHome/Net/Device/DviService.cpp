@@ -87,6 +87,7 @@ DviService::~DviService()
     for (i=0; i<iDvActions.size(); i++) {
         delete iDvActions[i].Action();
     }
+    ReleaseEncodedProperties(false);
     for (i=0; i<iProperties.size(); i++) {
         delete iProperties[i];
     }
@@ -109,18 +110,12 @@ void DviService::StopSubscriptions()
 
 void DviService::AddRef()
 {
-    Stack::Mutex().Wait();
-    iRefCount++;
-    Stack::Mutex().Signal();
+    (void)iRefCount.Inc();
 }
 
 void DviService::RemoveRef()
 {
-    Stack::Mutex().Wait();
-    iRefCount--;
-    TBool dead = (iRefCount == 0);
-    Stack::Mutex().Signal();
-    if (dead) {
+    if (iRefCount.Dec() == 0) {
         delete this;
     }
 }
@@ -217,6 +212,42 @@ const DviService::VectorProperties& DviService::Properties() const
     return iProperties;
 }
 
+EncodedPropertySet* DviService::EncodedProperties(const std::vector<TUint>& aSequenceNumbers)
+{
+    ReleaseEncodedProperties(true);
+    EncodedPropertySet* encoded = NULL;
+    for (TUint i=0; i<iEncodedProperties.size(); i++) {
+        if (iEncodedProperties[i]->Matches(aSequenceNumbers)) {
+            encoded = iEncodedProperties[i];
+            break;
+        }
+    }
+    if (encoded == NULL) {
+        if (iEncodedProperties.size() == kMaxEncodedPropertySets) {
+            iEncodedProperties[0]->RemoveRef();
+            iEncodedProperties.erase(iEncodedProperties.begin());
+        }
+        encoded = new EncodedPropertySet(iProperties, aSequenceNumbers);
+        iEncodedProperties.push_back(encoded);
+    }
+    encoded->AddRef();
+    return encoded;
+}
+
+void DviService::ReleaseEncodedProperties(TBool aStaleOnly)
+{
+    std::vector<EncodedPropertySet*>::iterator it = iEncodedProperties.begin();
+    while (it != iEncodedProperties.end()) {
+        if (aStaleOnly && (*it)->IsCurrent(iProperties)) {
+            it++;
+        }
+        else {
+            (*it)->RemoveRef();
+            it = iEncodedProperties.erase(it);
+        }
+    }
+}
+
 void DviService::PublishPropertyUpdates()
 {
     iLock.Wait();
@@ -256,7 +287,7 @@ void DviService::ListObjectDetails() const
 {
     Log::Print("  DviService: addr=%p, serviceType=", this);
     Log::Print(ServiceType().FullName());
-    Log::Print(", refCount=%u, subscriptions=%u\n", iRefCount, iSubscriptions.size());
+    Log::Print(", refCount=%d, subscriptions=%u\n", iRefCount.Value(), iSubscriptions.size());
 }
 
 
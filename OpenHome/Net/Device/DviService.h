@@ -89,6 +89,11 @@ public:
     DllExport void AddProperty(Property* aProperty);
     typedef std::vector<Property*> VectorProperties;
     const VectorProperties& Properties() const;
+    /**
+     * Returns the encoding of all properties which have changed since aSequenceNumbers.
+     * Must be called with PropertiesLock held.  Caller must RemoveRef() the returned object.
+     */
+    EncodedPropertySet* EncodedProperties(const std::vector<TUint>& aSequenceNumbers);
     void PublishPropertyUpdates();
 
     void AddSubscription(DviSubscription* aSubscription);
@@ -96,14 +101,17 @@ public:
 private:
     ~DviService();
     void InvocationCompleted();
+    void ReleaseEncodedProperties(TBool aStaleOnly);
 private: // from IStackObject
     void ListObjectDetails() const;
 private:
+    static const TUint kMaxEncodedPropertySets = 4;
     Mutex iLock;
-    TUint iRefCount;
+    AtomicInt iRefCount;
     Mutex iPropertiesLock;
     VectorActions iDvActions;
     VectorProperties iProperties;
+    std::vector<EncodedPropertySet*> iEncodedProperties; // guarded by iPropertiesLock
     std::vector<DviSubscription*> iSubscriptions;
     TBool iDisabled;
     TUint iCurrentInvocationCount;
@@ -24,6 +24,16 @@ DviStack::DviStack()
     TUint port = Stack::InitParams().DvUpnpServerPort();
     iDviServerUpnp = new DviServerUpnp(port);
     iDviDeviceMap = new DviDeviceMap;
+    iPropertyWriterPool = new PropertyWriterPoolUpnp;
+    iEventDispatcher = NULL;
+    if (Stack::InitParams().DvIsEventReactorEnabled()) {
+        try {
+            iEventDispatcher = new EventDispatcherUpnp(*iPropertyWriterPool);
+        }
+        catch (NetworkError&) {
+            // no reactor support on this platform
+        }
+    }
     iSubscriptionManager = new DviSubscriptionManager;
     iDviServerWebSocket = new DviServerWebSocket;
     if (Stack::InitParams().DvIsBonjourEnabled()) {
@@ -37,7 +47,10 @@ DviStack::~DviStack()
     delete iDviServerWebSocket;
     delete iDviServerUpnp;
     delete iDviDeviceMap;
+    // stop the publisher threads before the event dispatcher they write through
     delete iSubscriptionManager;
+    delete iEventDispatcher;
+    delete iPropertyWriterPool;
     delete iPropertyUpdateCollection;
 }
 
@@ -89,6 +102,18 @@ DviSubscriptionManager& DviStack::SubscriptionManager()
     return *(self->iSubscriptionManager);
 }
 
+PropertyWriterPoolUpnp& DviStack::PropertyWriterPool()
+{
+    DviStack* self = DviStack::Self();
+    return *(self->iPropertyWriterPool);
+}
+
+EventDispatcherUpnp* DviStack::EventDispatcher()
+{
+    DviStack* self = DviStack::Self();
+    return self->iEventDispatcher;
+}
+
 IMdnsProvider* DviStack::MdnsProvider()
 {
     DviStack* self = DviStack::Self();
@@ -32,6 +32,8 @@ public:
     static DviServerUpnp& ServerUpnp();
     static DviDeviceMap& DeviceMap();
     static DviSubscriptionManager& SubscriptionManager();
+    static PropertyWriterPoolUpnp& PropertyWriterPool();
+    static EventDispatcherUpnp* EventDispatcher(); // NULL if events are sent from publisher threads
     static IMdnsProvider* MdnsProvider();
     static DviPropertyUpdateCollection& PropertyUpdateCollection();
 private:
@@ -43,6 +45,8 @@ private:
     DviServerUpnp* iDviServerUpnp;
     DviDeviceMap* iDviDeviceMap;
     DviSubscriptionManager* iSubscriptionManager;
+    PropertyWriterPoolUpnp* iPropertyWriterPool;
+    EventDispatcherUpnp* iEventDispatcher;
     DviServerWebSocket* iDviServerWebSocket;
     IMdnsProvider* iMdns;
     DviPropertyUpdateCollection* iPropertyUpdateCollection;
@@ -49,6 +49,7 @@ DviSubscription::DviSubscription(DviDevice& aDevice, IPropertyWriterFactory& aWr
     , iUserData(aUserData)
     , iService(NULL)
     , iSequenceNumber(0)
+    , iPublishPending(false)
 {
     iDevice.AddWeakRef();
     aSid.TransferTo(iSid);
@@ -83,30 +84,17 @@ void DviSubscription::Stop()
 
 void DviSubscription::AddRef()
 {
-    Stack::Mutex().Wait();
-    iRefCount++;
-    Stack::Mutex().Signal();
+    (void)iRefCount.Inc();
 }
 
 TBool DviSubscription::TryAddRef()
 {
-    TBool added = false;
-    Stack::Mutex().Wait();
-    if (iRefCount != 0) {
-        iRefCount++;
-        added = true;
-    }
-    Stack::Mutex().Signal();
-    return added;
+    return iRefCount.IncIfNonZero();
 }
 
 void DviSubscription::RemoveRef()
 {
-    Stack::Mutex().Wait();
-    iRefCount--;
-    TBool dead = (iRefCount == 0);
-    Stack::Mutex().Signal();
-    if (dead) {
+    if (iRefCount.Dec() == 0) {
         delete this;
     }
 }
@@ -152,7 +140,6 @@ void DviSubscription::WriteChanges()
         writer = CreateWriter();
         if (writer != NULL) {
             writer->PropertyWriteEnd();
-            delete writer;
         }
     }
     catch(NetworkTimeout&) {
@@ -165,6 +152,7 @@ void DviSubscription::WriteChanges()
     catch(HttpError&) {}
     catch(WriterError&) {}
     catch(ReaderError&) {}
+    delete writer; // returns any connection to the subscriber for reuse if the event was delivered
 }
 
 IPropertyWriter* DviSubscription::CreateWriter()
@@ -182,33 +170,59 @@ IPropertyWriter* DviSubscription::CreateWriter()
         LOG(kDvEvent, "Subscription stopped; don't publish changes\n");
         return NULL;
     }
-    AutoPropertiesLock b(*iService);
     IPropertyWriter* writer = NULL;
-    const DviService::VectorProperties& properties = iService->Properties();
-    ASSERT(properties.size() == iPropertySequenceNumbers.size()); // services can't change definition after first advertisement
-    for (TUint i=0; i<properties.size(); i++) {
-        Property* prop = properties[i];
-        TUint seq = prop->SequenceNumber();
-        ASSERT(seq != 0); // => implementor hasn't initialised the property
-        if (seq != iPropertySequenceNumbers[i]) {
-            if (writer == NULL) {
-                writer = iWriterFactory.CreateWriter(iUserData, iSid, iSequenceNumber);
-                if (writer == NULL) {
-                    THROW(WriterError);
-                }
-                if (iSequenceNumber == UINT32_MAX) {
-                    iSequenceNumber = 1;
-                }
-                else {
-                    iSequenceNumber++;
+    EncodedPropertySet* encoded = NULL;
+    {
+        AutoPropertiesLock b(*iService);
+        const DviService::VectorProperties& properties = iService->Properties();
+        ASSERT(properties.size() == iPropertySequenceNumbers.size()); // services can't change definition after first advertisement
+        TBool changed = false;
+        for (TUint i=0; i<properties.size(); i++) {
+            TUint seq = properties[i]->SequenceNumber();
+            ASSERT(seq != 0); // => implementor hasn't initialised the property
+            if (seq != iPropertySequenceNumbers[i]) {
+                changed = true;
+            }
+        }
+        if (!changed) {
+            LOG(kDvEvent, "Found no changes to publish\n");
+            return NULL;
+        }
+        writer = iWriterFactory.CreateWriter(iUserData, iSid, iSequenceNumber);
+        if (writer == NULL) {
+            THROW(WriterError);
+        }
+        if (iSequenceNumber == UINT32_MAX) {
+            iSequenceNumber = 1;
+        }
+        else {
+            iSequenceNumber++;
+        }
+        if (writer->SupportsEncodedProperties()) {
+            // other subscribers with the same pending changes can share a single encoding
+            encoded = iService->EncodedProperties(iPropertySequenceNumbers);
+        }
+        for (TUint i=0; i<properties.size(); i++) {
+            Property* prop = properties[i];
+            TUint seq = prop->SequenceNumber();
+            if (seq != iPropertySequenceNumbers[i]) {
+                if (encoded == NULL) {
+                    prop->Write(*writer);
                 }
+                iPropertySequenceNumbers[i] = seq;
             }
-            prop->Write(*writer);
-            iPropertySequenceNumbers[i] = seq;
         }
     }
-    if (writer == NULL) {
-        LOG(kDvEvent, "Found no changes to publish\n");
+    if (encoded != NULL) {
+        try {
+            writer->PropertyWriteEncoded(encoded->Properties());
+        }
+        catch(...) {
+            encoded->RemoveRef();
+            delete writer;
+            throw;
+        }
+        encoded->RemoveRef();
     }
     return writer;
 }
@@ -319,6 +333,17 @@ void PropertyWriter::PropertyWriteBinary(const Brx& aName, const Brx& aValue)
     WriteVariable(aName, buf);
 }
 
+TBool PropertyWriter::SupportsEncodedProperties() const
+{
+    return true;
+}
+
+void PropertyWriter::PropertyWriteEncoded(const Brx& aProperties)
+{
+    ASSERT(iWriter != NULL);
+    iWriter->Write(aProperties);
+}
+
 void PropertyWriter::WriteVariable(const Brx& aName, const Brx& aValue)
 {
     ASSERT(iWriter != NULL);
@@ -326,6 +351,91 @@ void PropertyWriter::WriteVariable(const Brx& aName, const Brx& aValue)
 }
 
 
+// PropertyWriterEncoded
+
+namespace OpenHome {
+namespace Net {
+
+class PropertyWriterEncoded : public PropertyWriter
+{
+public:
+    PropertyWriterEncoded(IWriter& aWriter);
+private: // IPropertyWriter
+    void PropertyWriteEnd();
+};
+
+} // namespace Net
+} // namespace OpenHome
+
+PropertyWriterEncoded::PropertyWriterEncoded(IWriter& aWriter)
+{
+    SetWriter(aWriter);
+}
+
+void PropertyWriterEncoded::PropertyWriteEnd()
+{
+}
+
+
+// EncodedPropertySet
+
+EncodedPropertySet::EncodedPropertySet(const std::vector<Property*>& aProperties, const std::vector<TUint>& aSequenceNumbers)
+    : iRefCount(1)
+    , iFrom(aSequenceNumbers)
+{
+    ASSERT(aProperties.size() == aSequenceNumbers.size());
+    WriterBwh buf(kWriteBufGranularity);
+    PropertyWriterEncoded writer(buf);
+    iTo.reserve(aProperties.size());
+    for (TUint i=0; i<aProperties.size(); i++) {
+        Property* prop = aProperties[i];
+        const TUint seq = prop->SequenceNumber();
+        if (seq != iFrom[i]) {
+            prop->Write(writer);
+        }
+        iTo.push_back(seq);
+    }
+    buf.TransferTo(iProperties);
+}
+
+EncodedPropertySet::~EncodedPropertySet()
+{
+}
+
+void EncodedPropertySet::AddRef()
+{
+    (void)iRefCount.Inc();
+}
+
+void EncodedPropertySet::RemoveRef()
+{
+    if (iRefCount.Dec() == 0) {
+        delete this;
+    }
+}
+
+const Brx& EncodedPropertySet::Properties() const
+{
+    return iProperties;
+}
+
+TBool EncodedPropertySet::Matches(const std::vector<TUint>& aSequenceNumbers) const
+{
+    return (iFrom == aSequenceNumbers);
+}
+
+TBool EncodedPropertySet::IsCurrent(const std::vector<Property*>& aProperties) const
+{
+    ASSERT(aProperties.size() == iTo.size());
+    for (TUint i=0; i<aProperties.size(); i++) {
+        if (aProperties[i]->SequenceNumber() != iTo[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
 // Publisher
 
 Publisher::Publisher(const TChar* aName, Fifo<Publisher*>& aFree)
@@ -391,6 +501,7 @@ void Publisher::Run()
 DviSubscriptionManager::DviSubscriptionManager()
     : Thread("DVSM")
     , iLock("DSBM")
+    , iCoalesceMs(Stack::InitParams().DvPublisherCoalesceMs())
     , iFree(Stack::InitParams().DvNumPublisherThreads())
 {
     const TUint numPublisherThreads = Stack::InitParams().DvNumPublisherThreads();
@@ -462,11 +573,15 @@ void DviSubscriptionManager::QueueUpdate(DviSubscription& aSubscription)
 {
     DviSubscriptionManager& self = DviSubscriptionManager::Self();
     ASSERT(aSubscription.PropertiesInitialised());
+    AutoMutex a(self.iLock);
+    if (aSubscription.iPublishPending) {
+        // WriteChanges() reads current values so will pick up this change too
+        return;
+    }
+    aSubscription.iPublishPending = true;
     aSubscription.AddRef();
-    self.iLock.Wait();
-    self.iList.push_back(&aSubscription);
+    self.iList.push_back(PendingUpdate(aSubscription, Time::Now() + self.iCoalesceMs));
     self.Signal();
-    self.iLock.Signal();
 }
 
 DviSubscriptionManager& DviSubscriptionManager::Self()
@@ -478,10 +593,21 @@ void DviSubscriptionManager::Run()
 {
     for (;;) {
         Wait();
+        iLock.Wait();
+        const TUint dueTime = iList.front().iDueTime;
+        iLock.Signal();
+        // all updates are delayed by the same amount so the front of the list is always due first
+        const TInt delay = Time::TimeToWaitFor(dueTime);
+        if (delay > 0) {
+            Thread::Sleep(delay);
+            CheckForKill();
+        }
         Publisher* publisher = iFree.Read();
         iLock.Wait();
-        DviSubscription* subscription = iList.front();
+        DviSubscription* subscription = iList.front().iSubscription;
         iList.pop_front();
+        // any change from here on needs a further update
+        subscription->iPublishPending = false;
         iLock.Signal();
         publisher->Publish(subscription);
     }
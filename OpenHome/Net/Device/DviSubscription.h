@@ -39,6 +39,7 @@ class DviDevice;
 class DviService;
 class DviSubscription
 {
+    friend class DviSubscriptionManager;
 public:
     DviSubscription(DviDevice& aDevice, IPropertyWriterFactory& aWriterFactory,
                     IDviSubscriptionUserData* aUserData, Brh& aSid, TUint& aDurationSecs);
@@ -59,7 +60,7 @@ private:
     void DoRenew(TUint& aSeconds);
 private:
     mutable Mutex iLock;
-    TUint iRefCount;
+    AtomicInt iRefCount;
     DviDevice& iDevice;
     IPropertyWriterFactory& iWriterFactory;
     IDviSubscriptionUserData* iUserData;
@@ -68,6 +69,7 @@ private:
     std::vector<TUint> iPropertySequenceNumbers;
     TUint iSequenceNumber;
     Timer* iTimer;
+    TBool iPublishPending; // guarded by DviSubscriptionManager's lock
 };
 
 class PropertyWriter : public IPropertyWriter
@@ -83,12 +85,41 @@ private: // IPropertyWriter
     void PropertyWriteUint(const Brx& aName, TUint aValue);
     void PropertyWriteBool(const Brx& aName, TBool aValue);
     void PropertyWriteBinary(const Brx& aName, const Brx& aValue);
+    TBool SupportsEncodedProperties() const;
+    void PropertyWriteEncoded(const Brx& aProperties);
 private:
     void WriteVariable(const Brx& aName, const Brx& aValue);
 private:
     IWriter* iWriter;
 };
 
+/**
+ * Immutable, reference counted set of <e:property> elements describing every property of a
+ * service whose sequence number differs from a given snapshot.
+ *
+ * Created (and cached) by DviService so that subscribers with identical pending changes can
+ * share a single encoding.  Only the SID/SEQ headers then need to be written per subscriber.
+ */
+class EncodedPropertySet : private INonCopyable
+{
+    friend class DviService;
+public:
+    void AddRef();
+    void RemoveRef();
+    const Brx& Properties() const;
+private:
+    EncodedPropertySet(const std::vector<Property*>& aProperties, const std::vector<TUint>& aSequenceNumbers);
+    ~EncodedPropertySet();
+    TBool Matches(const std::vector<TUint>& aSequenceNumbers) const;
+    TBool IsCurrent(const std::vector<Property*>& aProperties) const;
+private:
+    static const TUint kWriteBufGranularity = 1024;
+    AtomicInt iRefCount;
+    std::vector<TUint> iFrom;
+    std::vector<TUint> iTo;
+    Brh iProperties;
+};
+
 class Publisher : public Thread
 {
 public:
@@ -112,12 +143,22 @@ public:
     static void RemoveSubscription(DviSubscription& aSubscription);
     static DviSubscription* Find(const Brx& aSid);
     static void QueueUpdate(DviSubscription& aSubscription);
+private:
+    class PendingUpdate
+    {
+    public:
+        PendingUpdate(DviSubscription& aSubscription, TUint aDueTime)
+            : iSubscription(&aSubscription), iDueTime(aDueTime) {}
+        DviSubscription* iSubscription;
+        TUint iDueTime;
+    };
 private:
     static DviSubscriptionManager& Self();
     void Run();
 private:
     Mutex iLock;
-    std::list<DviSubscription*> iList;
+    std::list<PendingUpdate> iList;
+    TUint iCoalesceMs;
     Fifo<Publisher*> iFree;
     Publisher** iPublishers;
     typedef std::map<Brn,DviSubscription*,BufferCmp> Map;
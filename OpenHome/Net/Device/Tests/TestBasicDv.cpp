@@ -245,3 +245,8 @@ const Brx& DeviceBasic::Udn() const
 {
     return iDevice->Udn();
 }
+
+ProviderTestBasic& DeviceBasic::Provider()
+{
+    return *iTestBasic;
+}
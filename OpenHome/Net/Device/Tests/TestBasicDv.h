@@ -41,6 +41,7 @@ public:
     DeviceBasic();
     ~DeviceBasic();
     const Brx& Udn() const;
+    ProviderTestBasic& Provider();
 private:
     DvDeviceStandard* iDevice;
     ProviderTestBasic* iTestBasic;
@@ -12,7 +12,12 @@
 #include <OpenHome/Private/Maths.h>
 #include <OpenHome/Net/Private/Stack.h>
 #include <OpenHome/Net/Private/DviStack.h>
+#include <OpenHome/Private/Network.h>
+#include <OpenHome/Private/Http.h>
+#include <OpenHome/Private/Stream.h>
+#include <OpenHome/Private/Uri.h>
 
+#include <stdio.h>
 #include <vector>
 
 using namespace OpenHome;
@@ -22,20 +27,111 @@ using namespace OpenHome::TestFramework;
 namespace OpenHome {
 namespace TestDvInvocation {
 
+class HeaderValue : public HttpHeader
+{
+public:
+    HeaderValue(const Brx& aName) : iName(aName) {}
+    const Brx& Value() const { return iValue; }
+private:
+    TBool Recognise(const Brx& aHeader) { return Ascii::CaseInsensitiveEquals(aHeader, iName); }
+    void Process(const Brx& aValue) { SetReceived(); iValue.Replace(aValue); }
+private:
+    Brn iName;
+    Bws<128> iValue;
+};
+
+/**
+ * Raw GET of a service description or device resource, allowing tests to control the request headers
+ */
+class HttpGetRequest
+{
+    static const TUint kMaxHeaders = 4;
+public:
+    HttpGetRequest(const Uri& aUri);
+    void AddHeader(const Brx& aField, const Brx& aValue);
+    TUint Get(); // returns the response status
+    const Brx& EntityTag() const { return iEntityTag; }
+    const Brx& ContentEncoding() const { return iContentEncoding; }
+    const Brx& LastModified() const { return iLastModified; }
+    TUint ContentLength() const { return iContentLength; }
+    const Brx& Body() const { return iBody; }
+private:
+    const Uri& iUri;
+    TUint iNumHeaders;
+    Brn iFields[kMaxHeaders];
+    Brn iValues[kMaxHeaders];
+    Bws<128> iEntityTag;
+    Bws<32> iContentEncoding;
+    Bws<Http::kMaxDateBytes> iLastModified;
+    TUint iContentLength;
+    Bwh iBody;
+};
+
+/**
+ * Serves the same block of pseudo-random data as "region", written from memory, and as
+ * "file", sent from a temporary file.  Both are written in two parts, the first small,
+ * and have the same entity tag and last modified time.
+ */
+class ResourceManagerRegions : public IResourceManager
+{
+public:
+    static const TUint kResourceBytes = 64 * 1024;
+    static const TUint kFirstPartBytes = 1000;
+    static const TUint kLastModified = 784111777; // Sun, 06 Nov 1994 08:49:37 GMT
+    static const TChar* kEntityTag;
+public:
+    ResourceManagerRegions();
+    ~ResourceManagerRegions();
+    const Brx& Data() const { return iData; }
+private:
+    void WriteResource(const Brx& aUriTail, TIpAddress aInterface, std::vector<char*>& aLanguageList, IResourceWriter& aResourceWriter);
+    static TBool WriteValidators(IResourceWriter& aResourceWriter);
+    void WriteFile(IResourceWriter& aResourceWriter, TUint aOffset, TUint aBytes);
+private:
+    Bwh iData;
+    FILE* iFile;
+};
+
+/**
+ * Only supports Increment, which can be made to take a long time to respond
+ */
+class ProviderSlow : public DvProviderOpenhomeOrgTestBasic1
+{
+public:
+    ProviderSlow(DvDevice& aDevice);
+    void SetDelay(TUint aDelayMs);
+    TUint Calls();
+private:
+    void Increment(IDvInvocation& aInvocation, TUint aValue, IDvInvocationResponseUint& aResult);
+private:
+    Mutex iLock;
+    TUint iDelayMs;
+    TUint iCalls;
+};
+
 class CpDevices
 {
     static const TUint kTestIterations = 10;
+    static const TUint kConcurrentInvocations = 40;
+    static const TUint kSlowTimeoutMs = 500;
 public:
     CpDevices(Semaphore& aAddedSem, const Brx& aTargetUdn);
     ~CpDevices();
     void Test();
+    void TestSlowResponse(ProviderSlow& aProvider);
+    void TestResources(const ResourceManagerRegions& aResourceManager);
     void Added(CpDevice& aDevice);
     void Removed(CpDevice& aDevice);
+private:
+    void IncrementCompleted(IAsync& aAsync);
 private:
     Mutex iLock;
     std::vector<CpDevice*> iList;
     Semaphore& iAddedSem;
     const Brx& iTargetUdn;
+    CpProxyOpenhomeOrgTestBasic1* iProxy;
+    Semaphore iCompletedSem;
+    TUint iResultSum;
 };
 
 } // namespace TestDvInvocation
@@ -43,10 +139,168 @@ private:
 
 using namespace OpenHome::TestDvInvocation;
 
+HttpGetRequest::HttpGetRequest(const Uri& aUri)
+    : iUri(aUri)
+    , iNumHeaders(0)
+    , iContentLength(0)
+{
+}
+
+void HttpGetRequest::AddHeader(const Brx& aField, const Brx& aValue)
+{
+    ASSERT(iNumHeaders < kMaxHeaders);
+    iFields[iNumHeaders].Set(aField);
+    iValues[iNumHeaders].Set(aValue);
+    iNumHeaders++;
+}
+
+TUint HttpGetRequest::Get()
+{
+    SocketTcpClient socket;
+    socket.Open();
+    AutoSocket a(socket);
+    Endpoint endpoint(iUri.Port(), iUri.Host());
+    socket.Connect(endpoint, 5 * 1000);
+
+    Sws<1024> writeBuffer(socket);
+    WriterHttpRequest writerRequest(writeBuffer);
+    writerRequest.WriteMethod(Http::kMethodGet, iUri.PathAndQuery(), Http::eHttp11);
+    Http::WriteHeaderHost(writerRequest, iUri);
+    for (TUint i=0; i<iNumHeaders; i++) {
+        writerRequest.WriteHeader(iFields[i], iValues[i]);
+    }
+    Http::WriteHeaderConnectionClose(writerRequest);
+    writerRequest.WriteFlush();
+
+    static const TUint kReadBufferBytes = 1024;
+    Srs<kReadBufferBytes> readBuffer(socket);
+    ReaderHttpResponse readerResponse(readBuffer);
+    HeaderValue headerETag(Http::kHeaderETag);
+    readerResponse.AddHeader(headerETag);
+    HeaderValue headerContentEncoding(Http::kHeaderContentEncoding);
+    readerResponse.AddHeader(headerContentEncoding);
+    HeaderValue headerLastModified(Http::kHeaderLastModified);
+    readerResponse.AddHeader(headerLastModified);
+    HttpHeaderContentLength headerContentLength;
+    readerResponse.AddHeader(headerContentLength);
+    readerResponse.Read(5 * 1000);
+    iEntityTag.Replace(headerETag.Value());
+    iContentEncoding.Replace(headerContentEncoding.Value());
+    iLastModified.Replace(headerLastModified.Value());
+    iContentLength = headerContentLength.ContentLength();
+    iBody.SetBytes(0);
+    iBody.Grow(iContentLength);
+    while (iBody.Bytes() < iContentLength) {
+        const TUint remaining = iContentLength - iBody.Bytes();
+        iBody.Append(readBuffer.Read(remaining < kReadBufferBytes? remaining : kReadBufferBytes));
+    }
+    return readerResponse.Status().Code();
+}
+
+
+const TChar* ResourceManagerRegions::kEntityTag = "\"regions-1\"";
+
+ResourceManagerRegions::ResourceManagerRegions()
+    : iData(kResourceBytes)
+{
+    TUint seed = 1;
+    for (TUint i=0; i<kResourceBytes; i++) {
+        seed = seed * 1103515245 + 12345;
+        iData.Append((TByte)(seed >> 16));
+    }
+    iFile = tmpfile();
+    ASSERT(iFile != NULL);
+    ASSERT(fwrite(iData.Ptr(), 1, iData.Bytes(), iFile) == iData.Bytes());
+    ASSERT(fflush(iFile) == 0);
+}
+
+ResourceManagerRegions::~ResourceManagerRegions()
+{
+    (void)fclose(iFile);
+}
+
+void ResourceManagerRegions::WriteResource(const Brx& aUriTail, TIpAddress /*aInterface*/, std::vector<char*>& /*aLanguageList*/, IResourceWriter& aResourceWriter)
+{
+    if (aUriTail == Brn("region")) {
+        if (WriteValidators(aResourceWriter)) {
+            return;
+        }
+        aResourceWriter.WriteResourceBegin(kResourceBytes, "application/octet-stream");
+        aResourceWriter.WriteResourceRegion(iData.Ptr(), kFirstPartBytes);
+        aResourceWriter.WriteResourceRegion(iData.Ptr() + kFirstPartBytes, kResourceBytes - kFirstPartBytes);
+        aResourceWriter.WriteResourceEnd();
+    }
+    else if (aUriTail == Brn("file")) {
+        if (WriteValidators(aResourceWriter)) {
+            return;
+        }
+        aResourceWriter.WriteResourceBegin(kResourceBytes, "application/octet-stream");
+        WriteFile(aResourceWriter, 0, kFirstPartBytes);
+        WriteFile(aResourceWriter, kFirstPartBytes, kResourceBytes - kFirstPartBytes);
+        aResourceWriter.WriteResourceEnd();
+    }
+}
+
+TBool ResourceManagerRegions::WriteValidators(IResourceWriter& aResourceWriter)
+{ // returns true if a 'not modified' response has been sent
+    return (aResourceWriter.WriteResourceEntityTag(kEntityTag) ||
+            aResourceWriter.WriteResourceLastModified(kLastModified));
+}
+
+void ResourceManagerRegions::WriteFile(IResourceWriter& aResourceWriter, TUint aOffset, TUint aBytes)
+{
+    if (!aResourceWriter.WriteResourceFile(fileno(iFile), aOffset, aBytes)) {
+        aResourceWriter.WriteResource(iData.Ptr() + aOffset, aBytes);
+    }
+}
+
+
+ProviderSlow::ProviderSlow(DvDevice& aDevice)
+    : DvProviderOpenhomeOrgTestBasic1(aDevice)
+    , iLock("PSLW")
+    , iDelayMs(0)
+    , iCalls(0)
+{
+    EnableActionIncrement();
+}
+
+void ProviderSlow::SetDelay(TUint aDelayMs)
+{
+    iLock.Wait();
+    iDelayMs = aDelayMs;
+    iLock.Signal();
+}
+
+TUint ProviderSlow::Calls()
+{
+    iLock.Wait();
+    TUint calls = iCalls;
+    iLock.Signal();
+    return calls;
+}
+
+void ProviderSlow::Increment(IDvInvocation& aInvocation, TUint aValue, IDvInvocationResponseUint& aResult)
+{
+    iLock.Wait();
+    iCalls++;
+    TUint delayMs = iDelayMs;
+    iLock.Signal();
+    if (delayMs > 0) {
+        Thread::Sleep(delayMs);
+    }
+    aInvocation.StartResponse();
+    aResult.Write(aValue + 1);
+    aInvocation.EndResponse();
+}
+
+
 CpDevices::CpDevices(Semaphore& aAddedSem, const Brx& aTargetUdn)
     : iLock("DLMX")
     , iAddedSem(aAddedSem)
     , iTargetUdn(aTargetUdn)
+    , iProxy(NULL)
+    , iCompletedSem("DLCS", 0)
+    , iResultSum(0)
 {
 }
 
@@ -104,6 +358,23 @@ void CpDevices::Test()
         ASSERT(result == valStr);
     }
 
+    Print("Concurrent invocations...\n");
+    iProxy = proxy;
+    FunctorAsync completed = MakeFunctorAsync(*this, &CpDevices::IncrementCompleted);
+    TUint expectedSum = 0;
+    for (i=0; i<kConcurrentInvocations; i++) {
+        proxy->BeginIncrement(i, completed);
+        expectedSum += i + 1;
+    }
+    for (i=0; i<kConcurrentInvocations; i++) {
+        iCompletedSem.Wait();
+    }
+    ASSERT(iResultSum == expectedSum);
+    TUint queued, inFlight;
+    iList[0]->GetInvocationCounts(queued, inFlight);
+    ASSERT(queued == 0);
+    ASSERT(inFlight == 0);
+
     Print("Binary arguments...\n");
     char bin[256];
     for (i=0; i<256; i++) {
@@ -116,9 +387,216 @@ void CpDevices::Test()
         ASSERT(result == valBin);
     }
 
+    Print("Service description caching...\n");
+    Brh location;
+    ASSERT(iList[0]->GetAttribute("Upnp.Location", location));
+    TUint bytes = location.Bytes(); // service xml is relative to device xml
+    while (bytes > 0 && location[bytes-1] != '/') {
+        bytes--;
+    }
+    Bws<Uri::kMaxUriBytes> scpdUri(location.Split(0, bytes));
+    scpdUri.Append("openhome.org-TestBasic-1/service.xml");
+    Uri uri(scpdUri);
+    HttpGetRequest full(uri);
+    ASSERT(full.Get() == HttpStatus::kOk.Code());
+    const Brx& entityTag = full.EntityTag();
+    const TUint totalBytes = full.ContentLength();
+    ASSERT(entityTag.Bytes() > 0);
+    ASSERT(totalBytes > 10);
+    ASSERT(full.ContentEncoding().Bytes() == 0);
+    HttpGetRequest repeat(uri);
+    ASSERT(repeat.Get() == HttpStatus::kOk.Code());
+    ASSERT(repeat.EntityTag() == entityTag);
+    HttpGetRequest notModified(uri);
+    notModified.AddHeader(Http::kHeaderIfNoneMatch, entityTag);
+    ASSERT(notModified.Get() == HttpStatus::kNotModified.Code());
+    ASSERT(notModified.EntityTag() == entityTag);
+    HttpGetRequest stale(uri);
+    stale.AddHeader(Http::kHeaderIfNoneMatch, Brn("\"stale\""));
+    ASSERT(stale.Get() == HttpStatus::kOk.Code());
+
+    Print("Service description ranges...\n");
+    HttpGetRequest first(uri);
+    first.AddHeader(Http::kHeaderRange, Brn("bytes=0-9"));
+    ASSERT(first.Get() == HttpStatus::kPartialContent.Code());
+    ASSERT(first.ContentLength() == 10);
+    ASSERT(first.Body() == full.Body().Split(0, 10));
+    HttpGetRequest suffix(uri);
+    suffix.AddHeader(Http::kHeaderRange, Brn("bytes=-5"));
+    ASSERT(suffix.Get() == HttpStatus::kPartialContent.Code());
+    ASSERT(suffix.Body() == full.Body().Split(totalBytes - 5));
+    HttpGetRequest ifRange(uri);
+    ifRange.AddHeader(Http::kHeaderRange, Brn("bytes=10-"));
+    ifRange.AddHeader(Http::kHeaderIfRange, entityTag);
+    ASSERT(ifRange.Get() == HttpStatus::kPartialContent.Code());
+    ASSERT(ifRange.ContentLength() == totalBytes - 10);
+    HttpGetRequest ifRangeStale(uri);
+    ifRangeStale.AddHeader(Http::kHeaderRange, Brn("bytes=10-"));
+    ifRangeStale.AddHeader(Http::kHeaderIfRange, Brn("\"stale\""));
+    ASSERT(ifRangeStale.Get() == HttpStatus::kOk.Code());
+    ASSERT(ifRangeStale.ContentLength() == totalBytes);
+    HttpGetRequest multiRange(uri);
+    multiRange.AddHeader(Http::kHeaderRange, Brn("bytes=0-1,5-6"));
+    ASSERT(multiRange.Get() == HttpStatus::kOk.Code());
+    HttpGetRequest unsatisfiable(uri);
+    unsatisfiable.AddHeader(Http::kHeaderRange, Brn("bytes=1000000-"));
+    ASSERT(unsatisfiable.Get() == HttpStatus::kRequestedRangeNotSatisfiable.Code());
+
+    Print("Service description compression...\n");
+    HttpGetRequest gzip(uri);
+    gzip.AddHeader(Http::kHeaderAcceptEncoding, Brn("deflate, gzip"));
+    ASSERT(gzip.Get() == HttpStatus::kOk.Code());
+    ASSERT(gzip.ContentEncoding() == Http::kContentEncodingGzip);
+    ASSERT(gzip.ContentLength() < totalBytes);
+    ASSERT(gzip.Body().Bytes() > 2 && gzip.Body()[0] == 0x1f && gzip.Body()[1] == 0x8b);
+    ASSERT(gzip.EntityTag() != entityTag);
+    HttpGetRequest gzipNotModified(uri);
+    gzipNotModified.AddHeader(Http::kHeaderAcceptEncoding, Brn("gzip"));
+    gzipNotModified.AddHeader(Http::kHeaderIfNoneMatch, gzip.EntityTag());
+    ASSERT(gzipNotModified.Get() == HttpStatus::kNotModified.Code());
+    HttpGetRequest deflate(uri);
+    deflate.AddHeader(Http::kHeaderAcceptEncoding, Brn("gzip;q=0, deflate"));
+    ASSERT(deflate.Get() == HttpStatus::kOk.Code());
+    ASSERT(deflate.ContentEncoding() == Http::kContentEncodingDeflate);
+    HttpGetRequest identity(uri);
+    identity.AddHeader(Http::kHeaderAcceptEncoding, Brn("br"));
+    ASSERT(identity.Get() == HttpStatus::kOk.Code());
+    ASSERT(identity.ContentEncoding().Bytes() == 0);
+    ASSERT(identity.Body() == full.Body());
+
+    delete proxy;
+}
+
+void CpDevices::TestSlowResponse(ProviderSlow& aProvider)
+{
+    ASSERT(iList.size() != 0);
+    Print("Slow response on a kept-alive connection...\n");
+    CpProxyOpenhomeOrgTestBasic1* proxy = new CpProxyOpenhomeOrgTestBasic1(*(iList[0]));
+    TUint result;
+    proxy->SyncIncrement(1, result); // leaves an idle keep-alive connection to the device
+    ASSERT(result == 2);
+    ASSERT(aProvider.Calls() == 1);
+
+    InitialisationParams& initParams = Stack::InitParams();
+    const TUint oldTimeoutMs = initParams.InvocationTimeoutMs();
+    initParams.SetInvocationTimeout(kSlowTimeoutMs);
+    aProvider.SetDelay(3 * kSlowTimeoutMs);
+    TBool timedOut = false;
+    try {
+        proxy->SyncIncrement(1, result);
+    }
+    catch (ProxyError&) {
+        timedOut = true;
+    }
+    ASSERT(timedOut);
+    // the device may have acted on the request so it mustn't have been sent a second time
+    Thread::Sleep(4 * kSlowTimeoutMs);
+    ASSERT(aProvider.Calls() == 2);
+    aProvider.SetDelay(0);
+    initParams.SetInvocationTimeout(oldTimeoutMs);
+
     delete proxy;
 }
 
+void CpDevices::TestResources(const ResourceManagerRegions& aResourceManager)
+{
+    ASSERT(iList.size() != 0);
+    Brh location;
+    ASSERT(iList[0]->GetAttribute("Upnp.Location", location));
+    TUint bytes = location.Bytes(); // resources are under <udn>/resource/, alongside <udn>/Upnp/device.xml
+    TUint slashes = 0;
+    while (bytes > 0 && slashes < 2) {
+        if (location[--bytes] == '/') {
+            slashes++;
+        }
+    }
+    Print("Http dates...\n");
+    const Brn kLastModified("Sun, 06 Nov 1994 08:49:37 GMT");
+    Bws<Http::kMaxDateBytes> date;
+    Http::AppendDate(date, ResourceManagerRegions::kLastModified);
+    ASSERT(date == kLastModified);
+    TUint64 seconds;
+    ASSERT(Http::ParseDate(kLastModified, seconds));
+    ASSERT(seconds == ResourceManagerRegions::kLastModified);
+    ASSERT(!Http::ParseDate(Brn("Sunday, 06-Nov-94 08:49:37 GMT"), seconds));
+
+    const Brx& data = aResourceManager.Data();
+    const TChar* kResources[] = { "region", "file" };
+    for (TUint i=0; i<sizeof(kResources)/sizeof(kResources[0]); i++) {
+        Print("Resource written by WriteResource%s...\n", (i==0? "Region" : "File"));
+        Bws<Uri::kMaxUriBytes> resourceUri(location.Split(0, bytes + 1));
+        resourceUri.Append("resource/");
+        resourceUri.Append(kResources[i]);
+        Uri uri(resourceUri);
+        HttpGetRequest full(uri);
+        ASSERT(full.Get() == HttpStatus::kOk.Code());
+        ASSERT(full.ContentLength() == ResourceManagerRegions::kResourceBytes);
+        ASSERT(full.Body() == data);
+        ASSERT(full.LastModified() == kLastModified);
+        HttpGetRequest sameDate(uri);
+        sameDate.AddHeader(Http::kHeaderIfModifiedSince, kLastModified);
+        ASSERT(sameDate.Get() == HttpStatus::kNotModified.Code());
+        HttpGetRequest laterDate(uri);
+        laterDate.AddHeader(Http::kHeaderIfModifiedSince, Brn("Sun, 06 Nov 1994 08:49:38 GMT"));
+        ASSERT(laterDate.Get() == HttpStatus::kNotModified.Code());
+        HttpGetRequest earlierDate(uri);
+        earlierDate.AddHeader(Http::kHeaderIfModifiedSince, Brn("Sun, 06 Nov 1994 08:49:36 GMT"));
+        ASSERT(earlierDate.Get() == HttpStatus::kOk.Code());
+        ASSERT(earlierDate.Body() == data);
+        HttpGetRequest staleTag(uri); // If-None-Match takes precedence over If-Modified-Since
+        staleTag.AddHeader(Http::kHeaderIfNoneMatch, Brn("\"stale\""));
+        staleTag.AddHeader(Http::kHeaderIfModifiedSince, kLastModified);
+        ASSERT(staleTag.Get() == HttpStatus::kOk.Code());
+        ASSERT(staleTag.Body() == data);
+        HttpGetRequest currentTag(uri);
+        currentTag.AddHeader(Http::kHeaderIfNoneMatch, full.EntityTag());
+        currentTag.AddHeader(Http::kHeaderIfModifiedSince, Brn("Sun, 06 Nov 1994 08:49:36 GMT"));
+        ASSERT(currentTag.Get() == HttpStatus::kNotModified.Code());
+        HttpGetRequest ifRangeDate(uri);
+        ifRangeDate.AddHeader(Http::kHeaderRange, Brn("bytes=10-19"));
+        ifRangeDate.AddHeader(Http::kHeaderIfRange, kLastModified);
+        ASSERT(ifRangeDate.Get() == HttpStatus::kPartialContent.Code());
+        HttpGetRequest ifRangeOldDate(uri);
+        ifRangeOldDate.AddHeader(Http::kHeaderRange, Brn("bytes=10-19"));
+        ifRangeOldDate.AddHeader(Http::kHeaderIfRange, Brn("Sun, 06 Nov 1994 08:49:36 GMT"));
+        ASSERT(ifRangeOldDate.Get() == HttpStatus::kOk.Code());
+        ASSERT(ifRangeOldDate.Body() == data);
+        HttpGetRequest inFirstPart(uri);
+        inFirstPart.AddHeader(Http::kHeaderRange, Brn("bytes=10-19"));
+        ASSERT(inFirstPart.Get() == HttpStatus::kPartialContent.Code());
+        ASSERT(inFirstPart.Body() == data.Split(10, 10));
+        HttpGetRequest spanning(uri);
+        spanning.AddHeader(Http::kHeaderRange, Brn("bytes=900-40000"));
+        ASSERT(spanning.Get() == HttpStatus::kPartialContent.Code());
+        ASSERT(spanning.ContentLength() == 40000 - 900 + 1);
+        ASSERT(spanning.Body() == data.Split(900, 40000 - 900 + 1));
+        HttpGetRequest inSecondPart(uri);
+        inSecondPart.AddHeader(Http::kHeaderRange, Brn("bytes=5000-5999"));
+        ASSERT(inSecondPart.Get() == HttpStatus::kPartialContent.Code());
+        ASSERT(inSecondPart.Body() == data.Split(5000, 1000));
+        HttpGetRequest suffix(uri);
+        suffix.AddHeader(Http::kHeaderRange, Brn("bytes=-100"));
+        ASSERT(suffix.Get() == HttpStatus::kPartialContent.Code());
+        ASSERT(suffix.Body() == data.Split(ResourceManagerRegions::kResourceBytes - 100));
+    }
+}
+
+void CpDevices::IncrementCompleted(IAsync& aAsync)
+{
+    TUint result;
+    iProxy->EndIncrement(aAsync, result);
+    const TUint maxInFlight = Stack::InitParams().MaxInvocationsPerDevice();
+    if (maxInFlight != 0) {
+        TUint queued, inFlight;
+        iList[0]->GetInvocationCounts(queued, inFlight);
+        ASSERT(inFlight <= maxInFlight);
+    }
+    iLock.Wait();
+    iResultSum += result;
+    iLock.Signal();
+    iCompletedSem.Signal();
+}
+
 void CpDevices::Added(CpDevice& aDevice)
 {
     iLock.Wait();
@@ -153,10 +631,36 @@ void TestDvInvocation()
     CpDeviceListUpnpServiceType* list =
                 new CpDeviceListUpnpServiceType(domainName, serviceType, ver, added, removed);
     sem->Wait(30*1000); // allow up to 30 seconds to find our one device
-    delete sem;
     deviceList->Test();
     delete list;
     delete deviceList;
+
+    Bwh udnSlow(device->Udn().Bytes() + 5);
+    udnSlow.Replace(device->Udn());
+    udnSlow.Append("-slow");
+    ResourceManagerRegions* resourceManager = new ResourceManagerRegions;
+    DvDeviceStandard* deviceSlow = new DvDeviceStandard(udnSlow, *resourceManager);
+    deviceSlow->SetAttribute("Upnp.Domain", "openhome.org");
+    deviceSlow->SetAttribute("Upnp.Type", "Test");
+    deviceSlow->SetAttribute("Upnp.Version", "1");
+    deviceSlow->SetAttribute("Upnp.FriendlyName", "ohNetTestDeviceSlow");
+    deviceSlow->SetAttribute("Upnp.Manufacturer", "None");
+    deviceSlow->SetAttribute("Upnp.ModelName", "ohNet slow test device");
+    ProviderSlow* providerSlow = new ProviderSlow(*deviceSlow);
+    deviceSlow->SetEnabled();
+    deviceList = new CpDevices(*sem, deviceSlow->Udn());
+    added = MakeFunctorCpDevice(*deviceList, &CpDevices::Added);
+    removed = MakeFunctorCpDevice(*deviceList, &CpDevices::Removed);
+    list = new CpDeviceListUpnpServiceType(domainName, serviceType, ver, added, removed);
+    sem->Wait(30*1000);
+    deviceList->TestSlowResponse(*providerSlow);
+    deviceList->TestResources(*resourceManager);
+    delete list;
+    delete deviceList;
+    delete providerSlow;
+    delete deviceSlow;
+    delete resourceManager;
+    delete sem;
     delete device;
 
     Print("TestDvInvocation - completed\n");
@@ -15,13 +15,19 @@ void OpenHome::TestFramework::Runner::Main(TInt aArgc, TChar* aArgv[], Net::Init
     OptionParser parser;
     OptionBool loopback("-l", "--loopback", "Use the loopback adapter only");
     parser.AddOption(&loopback);
+    OptionBool threaded("-t", "--threaded", "Run each invocation on its own thread rather than the invocation reactor");
+    parser.AddOption(&threaded);
     if (!parser.Parse(aArgc, aArgv) || parser.HelpDisplayed()) {
         return;
     }
     if (loopback.Value()) {
         aInitParams->SetUseLoopbackNetworkAdapter();
     }
+    if (threaded.Value()) {
+        aInitParams->SetCpEnableInvocationReactor(false);
+    }
     aInitParams->SetDvUpnpServerPort(0);
+    aInitParams->SetMaxInvocationsPerDevice(2);
     UpnpLibrary::Initialise(aInitParams);
     std::vector<NetworkAdapter*>* subnetList = UpnpLibrary::CreateSubnetList();
     TIpAddress subnet = (*subnetList)[0]->Subnet();
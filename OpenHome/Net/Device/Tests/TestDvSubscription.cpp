@@ -12,6 +12,12 @@
 #include <OpenHome/Private/Maths.h>
 #include <OpenHome/Net/Private/Stack.h>
 #include <OpenHome/Net/Private/DviStack.h>
+#include <OpenHome/Net/Private/DviServerUpnp.h>
+#include <OpenHome/Net/Private/Subscription.h>
+#include <OpenHome/Private/Network.h>
+#include <OpenHome/Private/Http.h>
+#include <OpenHome/Private/Stream.h>
+#include <OpenHome/Private/Uri.h>
 
 #include <vector>
 
@@ -22,21 +28,55 @@ using namespace OpenHome::TestFramework;
 namespace OpenHome {
 namespace TestDvSubscription {
 
+/**
+ * Event subscriber which accepts NOTIFYs but never responds to them
+ */
+class SessionStalled : public SocketTcpSession
+{
+public:
+    SessionStalled();
+    void WaitForRequest(TUint aTimeoutMs);
+private:
+    void Run();
+private:
+    Semaphore iRequestSem;
+};
+
+/**
+ * Subscription made without a control point stack so that the subscriber can misbehave
+ */
+class SubscriptionRaw
+{
+public:
+    SubscriptionRaw(const Uri& aEventUri, const Endpoint& aSubscriber);
+    TUint Subscribe(); // returns the http status code; subsequent calls renew the subscription
+    TUint Unsubscribe();
+    const Brx& Sid() const;
+private:
+    TUint Send(const Brx& aMethod);
+private:
+    const Uri& iEventUri;
+    Bws<Uri::kMaxUriBytes> iCallback;
+    Brh iSid;
+};
+
 class CpDevices
 {
 public:
     CpDevices(Semaphore& aAddedSem, const Brx& aTargetUdn);
     ~CpDevices();
-    void Test();
+    void Test(DeviceBasic& aDevice);
     void Added(CpDevice& aDevice);
     void Removed(CpDevice& aDevice);
 private:
+    void TestUnresponsiveSubscribers(DeviceBasic& aDevice, CpProxyOpenhomeOrgTestBasic1& aProxy);
     void UpdatesComplete();
 private:
     Mutex iLock;
     std::vector<CpDevice*> iList;
     Semaphore& iAddedSem;
     Semaphore iUpdatesComplete;
+    TUint iUpdateCount; // protected by iLock
     const Brx& iTargetUdn;
 };
 
@@ -45,10 +85,109 @@ private:
 
 using namespace OpenHome::TestDvSubscription;
 
+SessionStalled::SessionStalled()
+    : iRequestSem("DSB3", 0)
+{
+}
+
+void SessionStalled::WaitForRequest(TUint aTimeoutMs)
+{
+    iRequestSem.Wait(aTimeoutMs);
+}
+
+void SessionStalled::Run()
+{
+    iRequestSem.Signal();
+    // read (and ignore) the request without ever responding, leaving the publisher to time out
+    Bws<1024> buf;
+    try {
+        do {
+            Read(buf);
+        } while (buf.Bytes() > 0);
+    }
+    catch (ReaderError&) {
+    }
+    catch (NetworkError&) {
+    }
+}
+
+
+SubscriptionRaw::SubscriptionRaw(const Uri& aEventUri, const Endpoint& aSubscriber)
+    : iEventUri(aEventUri)
+{
+    iCallback.Append("http://");
+    aSubscriber.AppendEndpoint(iCallback);
+    iCallback.Append("/stalled");
+}
+
+TUint SubscriptionRaw::Subscribe()
+{
+    return Send(Brn("SUBSCRIBE"));
+}
+
+TUint SubscriptionRaw::Unsubscribe()
+{
+    return Send(Brn("UNSUBSCRIBE"));
+}
+
+const Brx& SubscriptionRaw::Sid() const
+{
+    return iSid;
+}
+
+TUint SubscriptionRaw::Send(const Brx& aMethod)
+{
+    SocketTcpClient socket;
+    socket.Open();
+    AutoSocket a(socket);
+    Endpoint endpoint(iEventUri.Port(), iEventUri.Host());
+    socket.Connect(endpoint, 5 * 1000);
+
+    Sws<1024> writeBuffer(socket);
+    WriterHttpRequest writerRequest(writeBuffer);
+    writerRequest.WriteMethod(aMethod, iEventUri.PathAndQuery(), Http::eHttp11);
+    Http::WriteHeaderHostAndPort(writerRequest, iEventUri);
+    if (iSid.Bytes() == 0) {
+        IWriterAscii& writerCallback = writerRequest.WriteHeaderField(Brn("CALLBACK"));
+        writerCallback.Write('<');
+        writerCallback.Write(iCallback);
+        writerCallback.Write('>');
+        writerCallback.WriteFlush();
+        writerRequest.WriteHeader(Brn("NT"), Brn("upnp:event"));
+    }
+    else {
+        IWriterAscii& writerSid = writerRequest.WriteHeaderField(HeaderSid::kHeaderSid);
+        writerSid.Write(HeaderSid::kFieldSidPrefix);
+        writerSid.Write(iSid);
+        writerSid.WriteFlush();
+    }
+    if (aMethod != Brn("UNSUBSCRIBE")) {
+        IWriterAscii& writerTimeout = writerRequest.WriteHeaderField(HeaderTimeout::kHeaderTimeout);
+        writerTimeout.Write(HeaderTimeout::kFieldTimeoutPrefix);
+        writerTimeout.WriteUint(300);
+        writerTimeout.WriteFlush();
+    }
+    Http::WriteHeaderConnectionClose(writerRequest);
+    writerRequest.WriteFlush();
+
+    Srs<1024> readBuffer(socket);
+    ReaderHttpResponse readerResponse(readBuffer);
+    HeaderSid headerSid;
+    readerResponse.AddHeader(headerSid);
+    readerResponse.Read(5 * 1000);
+    const HttpStatus& status = readerResponse.Status();
+    if (iSid.Bytes() == 0 && status == HttpStatus::kOk) {
+        headerSid.Sid().TransferTo(iSid);
+    }
+    return status.Code();
+}
+
+
 CpDevices::CpDevices(Semaphore& aAddedSem, const Brx& aTargetUdn)
     : iLock("DLMX")
     , iAddedSem(aAddedSem)
     , iUpdatesComplete("DSB2", 0)
+    , iUpdateCount(0)
     , iTargetUdn(aTargetUdn)
 {
 }
@@ -62,7 +201,7 @@ CpDevices::~CpDevices()
     iList.clear();
 }
 
-void CpDevices::Test()
+void CpDevices::Test(DeviceBasic& aDevice)
 {
     ASSERT(iList.size() == 1);
     CpProxyOpenhomeOrgTestBasic1* proxy = new CpProxyOpenhomeOrgTestBasic1(*(iList[0]));
@@ -160,9 +299,114 @@ void CpDevices::Test()
     proxy->SyncGetBool(valBool);
     ASSERT(!valBool);
 
+    Print("Coalesced...\n");
+    // a burst of changes should be published in a single update with the final value
+    const TUint kBurst = 10;
+    iLock.Wait();
+    const TUint updatesBefore = iUpdateCount;
+    iLock.Signal();
+    for (TUint i=1; i<=kBurst; i++) {
+        (void)aDevice.Provider().SetPropertyVarUint(1000 + i);
+    }
+    iUpdatesComplete.Wait();
+    Thread::Sleep(2000); // allow time for any further updates to arrive
+    proxy->PropertyVarUint(propUint);
+    ASSERT(propUint == 1000 + kBurst);
+    iLock.Wait();
+    const TUint updates = iUpdateCount - updatesBefore;
+    iLock.Signal();
+    // a heavily loaded machine may spread the burst over more than one coalescing window
+    ASSERT(updates > 0 && updates < kBurst);
+    (void)iUpdatesComplete.Clear();
+
+    TestUnresponsiveSubscribers(aDevice, *proxy);
+
     delete proxy; // automatically unsubscribes
 }
 
+void CpDevices::TestUnresponsiveSubscribers(DeviceBasic& aDevice, CpProxyOpenhomeOrgTestBasic1& aProxy)
+{
+    EventDispatcherUpnp* dispatcher = DviStack::EventDispatcher();
+    if (dispatcher == NULL) {
+        return; // no reactor support; each event ties up a publisher thread instead
+    }
+    // event urls are /<udn>/<service>/event; the device's location is /<udn>/Upnp/device.xml
+    Brh location;
+    ASSERT(iList[0]->GetAttribute("Upnp.Location", location));
+    TUint bytes = location.Bytes();
+    for (TUint i=0; i<2; i++) {
+        ASSERT(bytes > 0);
+        bytes--;
+        while (bytes > 0 && location[bytes-1] != '/') {
+            bytes--;
+        }
+    }
+    Bws<Uri::kMaxUriBytes> eventUriBuf(location.Split(0, bytes));
+    eventUriBuf.Append("openhome.org-TestBasic-1/event");
+    Uri eventUri(eventUriBuf);
+    const TIpAddress iface = Endpoint(eventUri.Port(), eventUri.Host()).Address();
+    TUint propUint;
+
+    Print("Stalled subscriber...\n");
+    SocketTcpServer* server = new SocketTcpServer("TSSS", 0, iface);
+    SessionStalled* session = new SessionStalled();
+    server->Add("TSS1", session);
+    SubscriptionRaw stalled(eventUri, Endpoint(server->Port(), iface));
+    ASSERT(stalled.Subscribe() == HttpStatus::kOk.Code());
+    session->WaitForRequest(5 * 1000); // initial event, which is never answered
+    // the other subscriber should still see every change promptly (well within the stalled event's timeout)
+    for (TUint i=1; i<=5; i++) {
+        (void)aDevice.Provider().SetPropertyVarUint(2000 + i);
+        iUpdatesComplete.Wait(2 * 1000);
+        aProxy.PropertyVarUint(propUint);
+        ASSERT(propUint == 2000 + i);
+    }
+    const TUint outstanding = dispatcher->Outstanding(stalled.Sid());
+    ASSERT(outstanding > 0 && outstanding <= EventDispatcherUpnp::kMaxOutstandingEvents);
+    // a subscriber which is reachable but slow isn't removed
+    ASSERT(stalled.Subscribe() == HttpStatus::kOk.Code());
+    ASSERT(stalled.Unsubscribe() == HttpStatus::kOk.Code());
+    delete server;
+
+    Print("Unreachable subscriber...\n");
+    // nothing accepts connections to this server; once its listen queue is full, connection attempts time out
+    server = new SocketTcpServer("TSSU", 0, iface, kPriorityHigh, Thread::kDefaultStackBytes, 1);
+    const Endpoint unreachableEndpoint(server->Port(), iface);
+    std::vector<SocketTcpClient*> queued;
+    TBool full = false;
+    while (!full && queued.size() < 16) {
+        SocketTcpClient* client = new SocketTcpClient();
+        client->Open();
+        queued.push_back(client);
+        try {
+            client->Connect(unreachableEndpoint, 500);
+        }
+        catch (NetworkTimeout&) {
+            full = true;
+        }
+    }
+    ASSERT(full);
+    SubscriptionRaw unreachable(eventUri, unreachableEndpoint);
+    ASSERT(unreachable.Subscribe() == HttpStatus::kOk.Code());
+    (void)aDevice.Provider().SetPropertyVarUint(3000);
+    iUpdatesComplete.Wait(2 * 1000);
+    aProxy.PropertyVarUint(propUint);
+    ASSERT(propUint == 3000);
+    // the subscription should be removed once the initial event fails to connect,
+    // after which attempts to renew it are rejected
+    TUint status = HttpStatus::kOk.Code();
+    for (TUint i=0; i<20 && status == HttpStatus::kOk.Code(); i++) {
+        Thread::Sleep(500);
+        status = unreachable.Subscribe();
+    }
+    ASSERT(status != HttpStatus::kOk.Code());
+    for (TUint i=0; i<(TUint)queued.size(); i++) {
+        queued[i]->Close();
+        delete queued[i];
+    }
+    delete server;
+}
+
 void CpDevices::Added(CpDevice& aDevice)
 {
     iLock.Wait();
@@ -180,6 +424,9 @@ void CpDevices::Removed(CpDevice& /*aDevice*/)
 
 void CpDevices::UpdatesComplete()
 {
+    iLock.Wait();
+    iUpdateCount++;
+    iLock.Signal();
     iUpdatesComplete.Signal();
 }
 
@@ -203,7 +450,7 @@ void TestDvSubscription()
                 new CpDeviceListUpnpServiceType(domainName, serviceType, ver, added, removed);
     sem->Wait(30*1000); // allow up to 30 seconds to issue the msearch and receive a response
     delete sem;
-    deviceList->Test();
+    deviceList->Test(*device);
     delete list;
     delete deviceList;
     delete device;
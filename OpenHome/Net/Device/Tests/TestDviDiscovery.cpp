@@ -80,6 +80,27 @@ private:
     std::vector<TChar*> iServices;
 };
 
+/**
+ * Counts the msearches passed to it; doesn't respond to any
+ */
+class MsearchCounter : public ISsdpMsearchHandler
+{
+public:
+    MsearchCounter();
+    TUint DeviceTypeSearches() const;
+    TUint ServiceTypeSearches() const;
+private:
+    void SsdpSearchAll(const Endpoint& aEndpoint, TUint aMx);
+    void SsdpSearchRoot(const Endpoint& aEndpoint, TUint aMx);
+    void SsdpSearchUuid(const Endpoint& aEndpoint, TUint aMx, const Brx& aUuid);
+    void SsdpSearchDeviceType(const Endpoint& aEndpoint, TUint aMx, const Brx& aDomain, const Brx& aType, TUint aVersion);
+    void SsdpSearchServiceType(const Endpoint& aEndpoint, TUint aMx, const Brx& aDomain, const Brx& aType, TUint aVersion);
+private:
+    mutable Mutex iLock;
+    TUint iDeviceType;
+    TUint iServiceType;
+};
+
 class SuiteAlive : public Suite
 {
 public:
@@ -112,11 +133,14 @@ private:
     void TestMsearchUuid();
     void TestMsearchDeviceType();
     void TestMsearchServiceType();
+    void TestMsearchReindex();
+    void Disabled();
 private:
     DviDevice* iDevices[2];
     Blocker* iBlocker;
     CpListenerMsearch* iListener;
     SsdpListenerUnicast* iListenerUnicast;
+    Semaphore iSem;
 };
 
 Bwh SuiteAlive::gNameDevice1("TestAlive");
@@ -474,10 +498,57 @@ void CpListenerMsearch::SsdpNotifyServiceTypeByeBye(const Brx& /*aUuid*/, const
 }
 
 
+// MsearchCounter
+
+MsearchCounter::MsearchCounter()
+    : iLock("MSCM")
+    , iDeviceType(0)
+    , iServiceType(0)
+{
+}
+
+TUint MsearchCounter::DeviceTypeSearches() const
+{
+    AutoMutex a(iLock);
+    return iDeviceType;
+}
+
+TUint MsearchCounter::ServiceTypeSearches() const
+{
+    AutoMutex a(iLock);
+    return iServiceType;
+}
+
+void MsearchCounter::SsdpSearchAll(const Endpoint& /*aEndpoint*/, TUint /*aMx*/)
+{
+}
+
+void MsearchCounter::SsdpSearchRoot(const Endpoint& /*aEndpoint*/, TUint /*aMx*/)
+{
+}
+
+void MsearchCounter::SsdpSearchUuid(const Endpoint& /*aEndpoint*/, TUint /*aMx*/, const Brx& /*aUuid*/)
+{
+}
+
+void MsearchCounter::SsdpSearchDeviceType(const Endpoint& /*aEndpoint*/, TUint /*aMx*/, const Brx& /*aDomain*/, const Brx& /*aType*/, TUint /*aVersion*/)
+{
+    AutoMutex a(iLock);
+    iDeviceType++;
+}
+
+void MsearchCounter::SsdpSearchServiceType(const Endpoint& /*aEndpoint*/, TUint /*aMx*/, const Brx& /*aDomain*/, const Brx& /*aType*/, TUint /*aVersion*/)
+{
+    AutoMutex a(iLock);
+    iServiceType++;
+}
+
+
 // SuiteMsearch
 
 SuiteMsearch::SuiteMsearch()
     : Suite("Msearches")
+    , iSem("SMSR", 0)
 {
     RandomiseUdn(gNameDevice1);
     RandomiseUdn(gNameDevice2);
@@ -548,6 +619,7 @@ void SuiteMsearch::Test()
     TestMsearchUuid();
     TestMsearchDeviceType();
     TestMsearchServiceType();
+    TestMsearchReindex();
 }
 
 void SuiteMsearch::Wait()
@@ -717,6 +789,73 @@ void SuiteMsearch::TestMsearchServiceType()
     TEST(0 == strcmp(iListener->Services()[0], "openhome.org:service5:1"));
 }
 
+void SuiteMsearch::TestMsearchReindex()
+{
+    // searches for targets no device advertises shouldn't reach any of them
+    iListener->Reset();
+    iListenerUnicast->MsearchDeviceType(Brn("openhome.org"), Brn("test1"), 1);
+    iListenerUnicast->MsearchServiceType(Brn("upnp.org"), Brn("service5"), 1);
+    Wait();
+    TEST(iListener->TotalMessages() == 0);
+
+    // a disabled device doesn't respond; its targets are re-indexed when it is enabled again
+    DviDevice* device = iDevices[0];
+    device->SetDisabled(MakeFunctor(*this, &SuiteMsearch::Disabled));
+    iSem.Wait();
+    iListener->Reset();
+    iListenerUnicast->MsearchDeviceType(Brn("upnp.org"), Brn("test1"), 1);
+    Wait();
+    TEST(iListener->TotalMessages() == 0);
+
+    device->SetAttribute("Upnp.Type", "test4");
+    device->SetEnabled();
+    iListener->Reset();
+    iListenerUnicast->MsearchDeviceType(Brn("upnp.org"), Brn("test1"), 1);
+    Wait();
+    TEST(iListener->TotalMessages() == 0);
+
+    iListener->Reset();
+    iListenerUnicast->MsearchDeviceType(Brn("upnp.org"), Brn("test4"), 1);
+    iListenerUnicast->MsearchServiceType(Brn("upnp.org"), Brn("service3"), 1);
+    Wait();
+    TEST(iListener->DeviceCount() == 1);
+    TEST(iListener->ServiceCount() == 1);
+    TEST(iListener->Udns() == 1);
+    TEST(iListener->TotalMessages() == 2);
+    TEST(DeviceTypeMatches(iListener->Dev1Type(), "upnp.org:test4:1"));
+
+    // a handler with its own targets is only passed searches for them
+    NetworkAdapter* nif = Stack::NetworkAdapterList().CurrentAdapter(kAdapterCookie);
+    const TIpAddress addr = nif->Address();
+    nif->RemoveRef(kAdapterCookie);
+    SsdpListenerMulticast& listener = Stack::MulticastListenerClaim(addr);
+    MsearchCounter counter;
+    const TInt id = listener.AddMsearchHandler(&counter);
+    SsdpMsearchTargets targets;
+    targets.AddDeviceType(Brn("openhome.org"), Brn("counted"));
+    targets.AddServiceType(Brn("openhome.org"), Brn("countedService"));
+    listener.SetMsearchTargets(id, targets);
+    iListener->Reset();
+    iListenerUnicast->MsearchDeviceType(Brn("upnp.org"), Brn("test4"), 1);
+    iListenerUnicast->MsearchServiceType(Brn("upnp.org"), Brn("service3"), 1);
+    Wait();
+    TEST(iListener->TotalMessages() == 2);
+    TEST(counter.DeviceTypeSearches() == 0);
+    TEST(counter.ServiceTypeSearches() == 0);
+    iListenerUnicast->MsearchDeviceType(Brn("openhome.org"), Brn("counted"), 1);
+    iListenerUnicast->MsearchServiceType(Brn("openhome.org"), Brn("countedService"), 1);
+    Wait();
+    TEST(counter.DeviceTypeSearches() == 1);
+    TEST(counter.ServiceTypeSearches() == 1);
+    listener.RemoveMsearchHandler(id);
+    Stack::MulticastListenerRelease(addr);
+}
+
+void SuiteMsearch::Disabled()
+{
+    iSem.Signal();
+}
+
 
 void TestDviDiscovery()
 {
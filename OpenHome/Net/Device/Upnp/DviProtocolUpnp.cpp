@@ -13,6 +13,7 @@
 #include <OpenHome/Net/Private/DviServerUpnp.h>
 #include <OpenHome/Net/Private/Ssdp.h>
 #include <OpenHome/Private/Converter.h>
+#include <OpenHome/Private/Deflate.h>
 #include <OpenHome/Private/Parser.h>
 #include <OpenHome/Private/Debug.h>
 #include <OpenHome/MimeTypes.h>
@@ -30,6 +31,21 @@ const Brn DviProtocolUpnp::kEventUrlTail("event");
 static const TChar kAttributeKeyVersionMajor[] = "Version.Major";
 static const TChar kAttributeKeyVersionMinor[] = "Version.Minor";
 
+namespace OpenHome {
+namespace Net {
+
+class AutoXmlRef : private INonCopyable
+{
+public:
+    AutoXmlRef(DviProtocolUpnpXml& aXml) : iXml(aXml) {}
+    ~AutoXmlRef() { iXml.RemoveRef(); }
+private:
+    DviProtocolUpnpXml& iXml;
+};
+
+} // namespace Net
+} // namespace OpenHome
+
 DviProtocolUpnp::DviProtocolUpnp(DviDevice& aDevice)
     : iDevice(aDevice)
     , iLock("DMUP")
@@ -71,6 +87,7 @@ DviProtocolUpnp::~DviProtocolUpnp()
         delete iAdapters[i];
     }
     iSuppressScheduledEvents = true;
+    ClearServiceXml();
     iLock.Signal();
     for (TUint i=0; i<iMsgSchedulers.size(); i++) {
         delete iMsgSchedulers[i];
@@ -156,6 +173,9 @@ void DviProtocolUpnp::AddInterface(const NetworkAdapter& aAdapter)
     DviDevice* root = (iDevice.IsRoot()? &iDevice : iDevice.Root());
     root->GetUriBase(uriBase, addr, port, *this);
     DviProtocolUpnpAdapterSpecificData* adapter = new DviProtocolUpnpAdapterSpecificData(*this, aAdapter, uriBase, port);
+    if (iDevice.Enabled()) {
+        adapter->SetMsearchTargets(iMsearchTargets);
+    }
     iAdapters.push_back(adapter);
 }
 
@@ -270,32 +290,31 @@ void DviProtocolUpnp::WriteResource(const Brx& aUriTail, TIpAddress aAdapter, st
 {
     if (aUriTail == kDeviceXmlName) {
         Brh xml;
-        Brn xmlBuf;
         iLock.Wait();
         const TInt index = FindListenerForInterface(aAdapter);
         if (index == -1) {
+            iLock.Signal();
             return;
         }
         if (iDevice.IsRoot()) {
-            const Brx& cachedXml = iAdapters[index]->DeviceXml();
-            if (cachedXml.Bytes() > 0) {
-                xmlBuf.Set(cachedXml);
+            DviProtocolUpnpAdapterSpecificData& adapter = *iAdapters[index];
+            DviProtocolUpnpXml* cachedXml = adapter.DeviceXml();
+            if (cachedXml == NULL) {
+                GetDeviceXml(xml, aAdapter);
+                adapter.SetDeviceXml(xml);
+                cachedXml = adapter.DeviceXml();
             }
+            iLock.Signal();
+            AutoXmlRef a(*cachedXml);
+            cachedXml->Write(aResourceWriter);
         }
-        if (xmlBuf.Bytes() == 0) {
+        else {
             GetDeviceXml(xml, aAdapter);
-            if (iDevice.IsRoot()) {
-                iAdapters[index]->SetDeviceXml(xml);
-                xmlBuf.Set(iAdapters[index]->DeviceXml());
-            }
-            else {
-                xmlBuf.Set(xml);
-            }
+            iLock.Signal();
+            aResourceWriter.WriteResourceBegin(xml.Bytes(), kOhNetMimeTypeXml);
+            aResourceWriter.WriteResource(xml.Ptr(), xml.Bytes());
+            aResourceWriter.WriteResourceEnd();
         }
-        iLock.Signal();
-        aResourceWriter.WriteResourceBegin(xmlBuf.Bytes(), kOhNetMimeTypeXml);
-        aResourceWriter.WriteResource(xmlBuf.Ptr(), xmlBuf.Bytes());
-        aResourceWriter.WriteResourceEnd();
     }
     else {
         Parser parser(aUriTail);
@@ -322,7 +341,9 @@ void DviProtocolUpnp::WriteResource(const Brx& aUriTail, TIpAddress aAdapter, st
             if (service == 0) {
                 THROW(ReaderError);
             }
-            DviProtocolUpnpServiceXmlWriter::Write(*service, *this, aResourceWriter);
+            DviProtocolUpnpXml* serviceXml = ServiceXml(*service);
+            AutoXmlRef a(*serviceXml);
+            serviceXml->Write(aResourceWriter);
         }
     }
 }
@@ -335,14 +356,29 @@ const Brx& DviProtocolUpnp::ProtocolName() const
 void DviProtocolUpnp::Enable()
 {
     iLock.Wait();
+    ClearServiceXml(); // services may have been added since we were last enabled
     
     // check we have at least the basic attributes requried for advertisement
     ASSERT(Domain().Bytes() > 0);
     ASSERT(Type().Bytes() > 0);
     ASSERT(Version() > 0);
+
+    // let multicast listeners pass us only the searches we might respond to
+    iMsearchTargets.Clear();
+    if (iDevice.IsRoot()) {
+        iMsearchTargets.AddRoot();
+    }
+    iMsearchTargets.AddUuid(iDevice.Udn());
+    iMsearchTargets.AddDeviceType(Domain(), Type());
+    const TUint serviceCount = iDevice.ServiceCount();
+    for (TUint i=0; i<serviceCount; i++) {
+        const OpenHome::Net::ServiceType& serviceType = iDevice.Service(i).ServiceType();
+        iMsearchTargets.AddServiceType(serviceType.Domain(), serviceType.Name());
+    }
     
     for (TUint i=0; i<iAdapters.size(); i++) {
         DviProtocolUpnpAdapterSpecificData* adapter = iAdapters[i];
+        adapter->SetMsearchTargets(iMsearchTargets);
         Bws<Uri::kMaxUriBytes> uriBase;
         DviDevice* root = (iDevice.IsRoot()? &iDevice : iDevice.Root());
         adapter->UpdateServerPort(*iServer);
@@ -527,22 +563,57 @@ void DviProtocolUpnp::GetDeviceXml(Brh& aXml, TIpAddress aAdapter)
     LOG(kDvDevice, "< DviProtocolUpnp::GetDeviceXml\n");
 }
 
+DviProtocolUpnpXml* DviProtocolUpnp::ServiceXml(DviService& aService)
+{
+    iLock.Wait();
+    for (TUint i=0; i<(TUint)iServiceXml.size(); i++) {
+        if (&iServiceXml[i]->Service() == &aService) {
+            DviProtocolUpnpXml& xml = iServiceXml[i]->Xml();
+            xml.AddRef();
+            iLock.Signal();
+            return &xml;
+        }
+    }
+    iLock.Signal();
+
+    // build the xml without holding iLock; another session may do the same so check again before caching
+    Brh xml;
+    DviProtocolUpnpServiceXmlWriter::Write(aService, *this, xml);
+    DviProtocolUpnpServiceXml* serviceXml = new DviProtocolUpnpServiceXml(aService, xml);
+    AutoMutex a(iLock);
+    for (TUint i=0; i<(TUint)iServiceXml.size(); i++) {
+        if (&iServiceXml[i]->Service() == &aService) {
+            delete serviceXml;
+            DviProtocolUpnpXml& cachedXml = iServiceXml[i]->Xml();
+            cachedXml.AddRef();
+            return &cachedXml;
+        }
+    }
+    iServiceXml.push_back(serviceXml);
+    serviceXml->Xml().AddRef();
+    return &serviceXml->Xml();
+}
+
+void DviProtocolUpnp::ClearServiceXml()
+{
+    for (TUint i=0; i<(TUint)iServiceXml.size(); i++) {
+        delete iServiceXml[i];
+    }
+    iServiceXml.clear();
+}
+
 void DviProtocolUpnp::LogUnicastNotification(const char* aType)
 {
-    Stack::Mutex().Wait();
     LOG(kDvDevice, "Device ");
     LOG(kDvDevice, iDevice.Udn());
     LOG(kDvDevice, " starting response to msearch type \'%s\'\n", aType);
-    Stack::Mutex().Signal();
 }
 
 void DviProtocolUpnp::LogMulticastNotification(const char* aType)
 {
-    Stack::Mutex().Wait();
     LOG(kDvDevice, "Device ");
     LOG(kDvDevice, iDevice.Udn());
     LOG(kDvDevice, " starting to send %s notifications.\n", aType);
-    Stack::Mutex().Signal();
 }
 
 void DviProtocolUpnp::SsdpSearchAll(const Endpoint& aEndpoint, TUint aMx, TIpAddress aAdapter)
@@ -632,6 +703,7 @@ DviProtocolUpnpAdapterSpecificData::DviProtocolUpnpAdapterSpecificData(IUpnpMsea
     , iAdapter(aAdapter.Address())
     , iUriBase(aUriBase)
     , iServerPort(aServerPort)
+    , iDeviceXml(NULL)
     , iBonjourWebPage(0)
 {
     iListener = &Stack::MulticastListenerClaim(aAdapter.Address());
@@ -646,6 +718,7 @@ DviProtocolUpnpAdapterSpecificData::~DviProtocolUpnpAdapterSpecificData()
     }
     iListener->RemoveMsearchHandler(iId);
     Stack::MulticastListenerRelease(iAdapter);
+    ClearDeviceXml();
 }
 
 TIpAddress DviProtocolUpnpAdapterSpecificData::Interface() const
@@ -679,20 +752,31 @@ TUint DviProtocolUpnpAdapterSpecificData::ServerPort() const
     return iServerPort;
 }
 
-const Brx& DviProtocolUpnpAdapterSpecificData::DeviceXml() const
+DviProtocolUpnpXml* DviProtocolUpnpAdapterSpecificData::DeviceXml()
 {
+    if (iDeviceXml != NULL) {
+        iDeviceXml->AddRef();
+    }
     return iDeviceXml;
 }
 
 void DviProtocolUpnpAdapterSpecificData::SetDeviceXml(Brh& aXml)
 {
-    aXml.TransferTo(iDeviceXml);
+    ClearDeviceXml();
+    iDeviceXml = new DviProtocolUpnpXml(aXml);
 }
 
 void DviProtocolUpnpAdapterSpecificData::ClearDeviceXml()
 {
-    Brh tmp;
-    iDeviceXml.TransferTo(tmp);
+    if (iDeviceXml != NULL) {
+        iDeviceXml->RemoveRef();
+        iDeviceXml = NULL;
+    }
+}
+
+void DviProtocolUpnpAdapterSpecificData::SetMsearchTargets(const SsdpMsearchTargets& aTargets)
+{
+    iListener->SetMsearchTargets(iId, aTargets);
 }
 
 void DviProtocolUpnpAdapterSpecificData::SetPendingDelete()
@@ -1013,17 +1097,117 @@ void DviProtocolUpnpDeviceXmlWriter::WriteResourceEnd()
 }
 
 
+// DviProtocolUpnpXml
+
+static void CompressXml(const Brx& aXml, Deflate::EFormat aFormat, Brh& aCompressed)
+{
+    WriterBwh writer(1024);
+    Deflate::Compress(writer, aXml, aFormat);
+    if (writer.Buffer().Bytes() < aXml.Bytes()) { // not worth offering otherwise
+        writer.TransferTo(aCompressed);
+    }
+}
+
+DviProtocolUpnpXml::DviProtocolUpnpXml(Brh& aXml)
+    : iRefCount(1)
+{
+    aXml.TransferTo(iXml);
+    CompressXml(iXml, Deflate::eGzip, iXmlGzip);
+    CompressXml(iXml, Deflate::eZlib, iXmlDeflate);
+
+    // strong entity tag - FNV-1a hash of the content plus its length
+    TUint hash = 2166136261u;
+    const TByte* ptr = iXml.Ptr();
+    for (TUint i=0; i<iXml.Bytes(); i++) {
+        hash ^= ptr[i];
+        hash *= 16777619u;
+    }
+    iEntityTag.Append('\"');
+    (void)Ascii::AppendHex(iEntityTag, hash);
+    iEntityTag.Append('-');
+    (void)Ascii::AppendHex(iEntityTag, iXml.Bytes());
+    iEntityTag.Append('\"');
+}
+
+void DviProtocolUpnpXml::AddRef()
+{
+    (void)iRefCount.Inc();
+}
+
+void DviProtocolUpnpXml::RemoveRef()
+{
+    if (iRefCount.Dec() == 0) {
+        delete this;
+    }
+}
+
+const Brx& DviProtocolUpnpXml::Xml() const
+{
+    return iXml;
+}
+
+void DviProtocolUpnpXml::Write(IResourceWriter& aResourceWriter) const
+{
+    const Brx* xml = &iXml;
+    const TChar* encoding = NULL;
+    if (iXmlGzip.Bytes() > 0 && aResourceWriter.WriteResourceContentEncoding("gzip")) {
+        xml = &iXmlGzip;
+        encoding = "gzip";
+    }
+    else if (iXmlDeflate.Bytes() > 0 && aResourceWriter.WriteResourceContentEncoding("deflate")) {
+        xml = &iXmlDeflate;
+        encoding = "deflate";
+    }
+    // each encoding is a different representation so needs its own entity tag
+    Bws<kMaxEncodedEntityTagBytes> entityTag(iEntityTag);
+    if (encoding != NULL) {
+        entityTag.SetBytes(entityTag.Bytes() - 1);
+        entityTag.Append('-');
+        entityTag.Append(encoding);
+        entityTag.Append('\"');
+    }
+    if (aResourceWriter.WriteResourceEntityTag((const TChar*)entityTag.PtrZ())) {
+        return;
+    }
+    aResourceWriter.WriteResourceBegin(xml->Bytes(), kOhNetMimeTypeXml);
+    aResourceWriter.WriteResource(xml->Ptr(), xml->Bytes());
+    aResourceWriter.WriteResourceEnd();
+}
+
+
+// DviProtocolUpnpServiceXml
+
+DviProtocolUpnpServiceXml::DviProtocolUpnpServiceXml(DviService& aService, Brh& aXml)
+    : iService(aService)
+{
+    iService.AddRef();
+    iXml = new DviProtocolUpnpXml(aXml);
+}
+
+DviProtocolUpnpServiceXml::~DviProtocolUpnpServiceXml()
+{
+    iXml->RemoveRef();
+    iService.RemoveRef();
+}
+
+const DviService& DviProtocolUpnpServiceXml::Service() const
+{
+    return iService;
+}
+
+DviProtocolUpnpXml& DviProtocolUpnpServiceXml::Xml() const
+{
+    return *iXml;
+}
+
+
 // DviProtocolUpnpServiceXmlWriter
 
-void DviProtocolUpnpServiceXmlWriter::Write(const DviService& aService, const DviProtocolUpnp& aDevice, IResourceWriter& aResourceWriter)
+void DviProtocolUpnpServiceXmlWriter::Write(const DviService& aService, const DviProtocolUpnp& aDevice, Brh& aXml)
 {
     WriterBwh writer(1024);
     WriteServiceXml(writer, aService, aDevice);
-    Brh xml;
-    writer.TransferTo(xml);
-    aResourceWriter.WriteResourceBegin(xml.Bytes(), kOhNetMimeTypeXml);
-    aResourceWriter.WriteResource(xml.Ptr(), xml.Bytes());
-    aResourceWriter.WriteResourceEnd();
+    writer.TransferTo(aXml);
 }
 
 void DviProtocolUpnpServiceXmlWriter::WriteServiceXml(WriterBwh& aWriter, const DviService& aService, const DviProtocolUpnp& aDevice)
@@ -7,6 +7,7 @@
 #include <OpenHome/Net/Private/DviDevice.h>
 #include <OpenHome/Net/Private/Discovery.h>
 #include <OpenHome/Private/Thread.h>
+#include <OpenHome/Private/Ascii.h>
 #include <OpenHome/Net/Core/OhNet.h>
 #include <OpenHome/Private/Timer.h>
 #include <OpenHome/Net/Private/Ssdp.h>
@@ -52,6 +53,9 @@ public:
 };
 
 
+class DviProtocolUpnpServiceXml;
+class DviProtocolUpnpXml;
+
 class DviProtocolUpnp : public IDvProtocol, private IUpnpMsearchHandler, private IUpnpAnnouncementData, private IUpnpMsgListener
 {
     friend class DviProtocolUpnpDeviceXmlWriter;
@@ -86,6 +90,8 @@ private:
     void SendUpdateNotifications();
     void GetUriDeviceXml(Bwh& aUri, const Brx& aUriBase);
     void GetDeviceXml(Brh& aXml, TIpAddress aAdapter);
+    DviProtocolUpnpXml* ServiceXml(DviService& aService); // caller must RemoveRef() the returned document
+    void ClearServiceXml();
     void LogMulticastNotification(const char* aType);
     void LogUnicastNotification(const char* aType);
 public: // from IDvProtocol
@@ -117,6 +123,35 @@ private:
     TUint iUpdateCount;
     TBool iSuppressScheduledEvents;
     DviServerUpnp* iServer;
+    std::vector<DviProtocolUpnpServiceXml*> iServiceXml;
+    SsdpMsearchTargets iMsearchTargets;
+};
+
+/**
+ * Document which is served unchanged to many control points.  Compressed copies are made
+ * once so that clients which accept gzip or deflate encodings cost no more to serve.
+ *
+ * Reference counted as a document is written to clients after the lock guarding its cache
+ * is released, by which time the device may have been re-enabled and the cache cleared.
+ */
+class DviProtocolUpnpXml : private INonCopyable
+{
+public:
+    DviProtocolUpnpXml(Brh& aXml);
+    void AddRef();
+    void RemoveRef();
+    const Brx& Xml() const;
+    void Write(IResourceWriter& aResourceWriter) const;
+private:
+    ~DviProtocolUpnpXml() {}
+private:
+    static const TUint kMaxEntityTagBytes = 2 + 2*Ascii::kMaxUintHexStringBytes + 1 + 1;
+    static const TUint kMaxEncodedEntityTagBytes = kMaxEntityTagBytes + 8;
+    Brh iXml;
+    Brh iXmlGzip;
+    Brh iXmlDeflate;
+    Bws<kMaxEntityTagBytes> iEntityTag;
+    AtomicInt iRefCount;
 };
 
 class DviProtocolUpnpAdapterSpecificData : public ISsdpMsearchHandler, public INonCopyable
@@ -131,9 +166,10 @@ public:
     void UpdateServerPort(DviServerUpnp& aServer);
     void UpdateUriBase(Bwx& aUriBase);
     TUint ServerPort() const;
-    const Brx& DeviceXml() const;
+    DviProtocolUpnpXml* DeviceXml(); // NULL if not cached, otherwise the caller must RemoveRef() the document
     void SetDeviceXml(Brh& aXml);
     void ClearDeviceXml();
+    void SetMsearchTargets(const SsdpMsearchTargets& aTargets);
     void SetPendingDelete();
     void BonjourRegister(const TChar* aName, const Brx& aUdn, const Brx& aProtocol, const Brx& aResourceDir);
     void BonjourDeregister();
@@ -153,7 +189,7 @@ private:
     TIpAddress iAdapter;
     Bws<Uri::kMaxUriBytes> iUriBase;
     TUint iServerPort;
-    Brh iDeviceXml;
+    DviProtocolUpnpXml* iDeviceXml;
     BonjourWebPage* iBonjourWebPage;
 };
 
@@ -186,10 +222,26 @@ private:
     WriterBwh iWriter;
 };
 
+/**
+ * Service description, serialised once then served to all control points until
+ * the device is next enabled.
+ */
+class DviProtocolUpnpServiceXml : private INonCopyable
+{
+public:
+    DviProtocolUpnpServiceXml(DviService& aService, Brh& aXml);
+    ~DviProtocolUpnpServiceXml();
+    const DviService& Service() const;
+    DviProtocolUpnpXml& Xml() const;
+private:
+    DviService& iService;
+    DviProtocolUpnpXml* iXml;
+};
+
 class DviProtocolUpnpServiceXmlWriter
 {
 public:
-    static void Write(const DviService& aService, const DviProtocolUpnp& aDevice, IResourceWriter& aResourceWriter);
+    static void Write(const DviService& aService, const DviProtocolUpnp& aDevice, Brh& aXml);
 private:
     static void WriteServiceXml(WriterBwh& aWriter, const DviService& aService, const DviProtocolUpnp& aDevice);
     static void WriteServiceActionParams(WriterBwh& aWriter, const Action& aAction, TBool aIn);
@@ -300,64 +300,597 @@ void SubscriptionDataUpnp::Release()
 }
 
 
-// PropertyWriterUpnp
+// EventConnectionUpnp
 
-PropertyWriterUpnp::PropertyWriterUpnp(const Endpoint& aPublisher, const Endpoint& aSubscriber, const Brx& aSubscriberPath,
-                                       const Brx& aSid, TUint aSequenceNumber)
+EventConnectionUpnp::EventConnectionUpnp(const Endpoint& aSubscriber)
+    : iSubscriber(aSubscriber)
+    , iReader(iSocket)
+    , iReadBuffer(iReader)
+    , iIdleSinceMs(0)
 {
     iSocket.Open();
-    iSocket.Connect(aSubscriber, Stack::InitParams().TcpConnectTimeoutMs());
-    iWriterChunked = new WriterHttpChunked(iSocket);
-    iWriteBuffer = new Sws<kMaxRequestBytes>(*iWriterChunked);
-    iWriterEvent = new WriterHttpRequest(*iWriteBuffer);
-    SetWriter(*iWriteBuffer);
+}
 
-    iWriterEvent->WriteMethod(kUpnpMethodNotify, aSubscriberPath, Http::eHttp11);
+EventConnectionUpnp::~EventConnectionUpnp()
+{
+    try {
+        iSocket.Close();
+    }
+    catch (NetworkError&) {
+        LOG2(kDvEvent, kError, "EventConnectionUpnp - error closing socket\n");
+    }
+}
 
-    IWriterAscii& writer = iWriterEvent->WriteHeaderField(Http::kHeaderHost);
-    Endpoint::EndpointBuf buf;
-    aPublisher.AppendEndpoint(buf);
-    writer.Write(buf);
-    writer.WriteFlush();
 
-    iWriterEvent->WriteHeader(Http::kHeaderContentType, Brn("text/xml; charset=\"utf-8\""));
-    iWriterEvent->WriteHeader(kUpnpHeaderNt, Brn("upnp:event"));
-    iWriterEvent->WriteHeader(kUpnpHeaderNts, Brn("upnp:propchange"));
+// PropertyWriterPoolUpnp
 
-    writer = iWriterEvent->WriteHeaderField(HeaderSid::kHeaderSid);
-    writer.Write(HeaderSid::kFieldSidPrefix);
-    writer.Write(aSid);
-    writer.WriteFlush();
+PropertyWriterPoolUpnp::PropertyWriterPoolUpnp()
+    : iLock("PWPL")
+{
+}
 
-    iWriterEvent->WriteHeader(Http::kHeaderTransferEncoding, Http::kTransferEncodingChunked);
+PropertyWriterPoolUpnp::~PropertyWriterPoolUpnp()
+{
+    for (TUint i=0; i<(TUint)iConnections.size(); i++) {
+        delete iConnections[i];
+    }
+    for (TUint i=0; i<(TUint)iBuffers.size(); i++) {
+        delete iBuffers[i];
+    }
+}
 
-    writer = iWriterEvent->WriteHeaderField(kUpnpHeaderSeq);
-    writer.WriteUint(aSequenceNumber);
-    writer.WriteFlush();
+EventConnectionUpnp* PropertyWriterPoolUpnp::ClaimConnection(const Endpoint& aSubscriber, TBool& aReused)
+{
+    EventConnectionUpnp* connection = ClaimConnectionNoConnect(aSubscriber, aReused);
+    if (!aReused) {
+        try {
+            connection->iSocket.Connect(aSubscriber, Stack::InitParams().TcpConnectTimeoutMs());
+        }
+        catch (NetworkError&) {
+            delete connection;
+            throw;
+        }
+    }
+    return connection;
+}
 
-    iWriterEvent->WriteHeader(Http::kHeaderConnection, Http::kConnectionClose);
-    iWriterEvent->WriteFlush();
-    iWriterChunked->SetChunked(true);
+EventConnectionUpnp* PropertyWriterPoolUpnp::ClaimConnectionNoConnect(const Endpoint& aSubscriber, TBool& aReused)
+{
+    iLock.Wait();
+    RemoveExpiredLocked(Os::TimeInMs());
+    for (TUint i=(TUint)iConnections.size(); i>0; i--) {
+        // search from the back to favour the most recently used connection
+        EventConnectionUpnp* connection = iConnections[i-1];
+        if (connection->iSubscriber.Equals(aSubscriber)) {
+            iConnections.erase(iConnections.begin() + i - 1);
+            iLock.Signal();
+            aReused = true;
+            return connection;
+        }
+    }
+    iLock.Signal();
+    aReused = false;
+    return new EventConnectionUpnp(aSubscriber);
+}
+
+void PropertyWriterPoolUpnp::ReleaseConnection(EventConnectionUpnp* aConnection, TBool aReusable)
+{
+    if (aReusable) {
+        AutoMutex a(iLock);
+        const TUint now = Os::TimeInMs();
+        RemoveExpiredLocked(now);
+        if (iConnections.size() < kMaxIdleConnections) {
+            aConnection->iIdleSinceMs = now;
+            iConnections.push_back(aConnection);
+            return;
+        }
+    }
+    delete aConnection;
+}
+
+WriterBwh* PropertyWriterPoolUpnp::ClaimBuffer()
+{
+    iLock.Wait();
+    if (iBuffers.size() > 0) {
+        WriterBwh* buffer = iBuffers.back();
+        iBuffers.pop_back();
+        iLock.Signal();
+        return buffer;
+    }
+    iLock.Signal();
+    return new WriterBwh(kBufferGranularity);
+}
+
+void PropertyWriterPoolUpnp::ReleaseBuffer(WriterBwh* aBuffer)
+{
+    if (aBuffer->Buffer().Bytes() <= kMaxPooledBufferBytes) { // don't hang on to memory used by unusually large events
+        aBuffer->Reset();
+        AutoMutex a(iLock);
+        if (iBuffers.size() < kMaxIdleBuffers) {
+            iBuffers.push_back(aBuffer);
+            return;
+        }
+    }
+    delete aBuffer;
+}
+
+void PropertyWriterPoolUpnp::RemoveExpiredLocked(TUint aTimeNowMs)
+{
+    // iConnections is ordered by release time so expired connections are all at the front
+    TUint count = 0;
+    while (count < (TUint)iConnections.size() && aTimeNowMs - iConnections[count]->iIdleSinceMs >= kIdleTimeoutMs) {
+        delete iConnections[count];
+        count++;
+    }
+    if (count > 0) {
+        iConnections.erase(iConnections.begin(), iConnections.begin() + count);
+    }
+}
+
+
+// EventDispatcherUpnp::Channel
+
+class EventDispatcherUpnp::Channel : public ReactorHttpExchange
+{
+    friend class EventDispatcherUpnp;
+public:
+    Channel(PropertyWriterPoolUpnp& aPool, PropertyWriterFactory& aFactory, const Brx& aSid, const Endpoint& aSubscriber);
+private: // ReactorHttpExchange
+    SocketTcpClient& ClaimConnection(const Endpoint& aEndpoint, TBool& aReused);
+    void ReleaseConnection(TBool aReusable);
+private:
+    PropertyWriterPoolUpnp& iPool;
+    PropertyWriterFactory& iFactory;
+    Brh iSid;
+    Endpoint iSubscriber;
+    TUint iOutstanding;             // reserved, queued or in flight.  Protected by iLock
+    TBool iDeferred;                // protected by iLock
+    TBool iUnreachable;             // protected by iLock
+    TBool iRunning;                 // protected by iLock.  Set while the reactor thread owns the channel
+    std::list<WriterBwh*> iQueued;  // protected by iLock
+    WriterBwh* iRequest;            // the remaining members are only accessed by the reactor thread
+    EventConnectionUpnp* iConnection;
+};
+
+EventDispatcherUpnp::Channel::Channel(PropertyWriterPoolUpnp& aPool, PropertyWriterFactory& aFactory, const Brx& aSid, const Endpoint& aSubscriber)
+    : iPool(aPool)
+    , iFactory(aFactory)
+    , iSid(aSid)
+    , iSubscriber(aSubscriber)
+    , iOutstanding(0)
+    , iDeferred(false)
+    , iUnreachable(false)
+    , iRunning(false)
+    , iRequest(NULL)
+    , iConnection(NULL)
+{
+}
+
+SocketTcpClient& EventDispatcherUpnp::Channel::ClaimConnection(const Endpoint& aEndpoint, TBool& aReused)
+{
+    iConnection = iPool.ClaimConnectionNoConnect(aEndpoint, aReused);
+    return iConnection->iSocket;
+}
+
+void EventDispatcherUpnp::Channel::ReleaseConnection(TBool aReusable)
+{
+    iPool.ReleaseConnection(iConnection, aReusable);
+    iConnection = NULL;
+}
+
+
+// EventDispatcherUpnp
+
+EventDispatcherUpnp::EventDispatcherUpnp(PropertyWriterPoolUpnp& aPool)
+    : ReactorHttpClient("EVDP", kMaxResponseBytes, eEndAtHeaders)
+    , iPool(aPool)
+    , iLock("EVDL")
+{
+    ReactorHttpClient::Start();
+}
+
+EventDispatcherUpnp::~EventDispatcherUpnp()
+{
+    Stop();
+    while (ActiveCount() > 0) {
+        Channel& channel = static_cast<Channel&>(Active(ActiveCount() - 1));
+        End(channel, false);
+        iPool.ReleaseBuffer(channel.iRequest);
+    }
+    for (ChannelMap::iterator it = iChannels.begin(); it != iChannels.end(); ++it) {
+        Channel* channel = it->second;
+        while (channel->iQueued.size() > 0) {
+            iPool.ReleaseBuffer(channel->iQueued.front());
+            channel->iQueued.pop_front();
+        }
+        channel->iFactory.RemoveRef();
+        delete channel;
+    }
+}
+
+TBool EventDispatcherUpnp::Reserve(PropertyWriterFactory& aFactory, const Brx& aSid, const Endpoint& aSubscriber)
+{
+    AutoMutex a(iLock);
+    Channel* channel = FindLocked(aSid);
+    if (channel == NULL) {
+        channel = new Channel(iPool, aFactory, aSid, aSubscriber);
+        aFactory.AddRef();
+        Brn sid(channel->iSid);
+        iChannels.insert(std::pair<Brn,Channel*>(sid, channel));
+    }
+    if (channel->iUnreachable) {
+        return false;
+    }
+    if (channel->iOutstanding >= kMaxOutstandingEvents) {
+        channel->iDeferred = true;
+        return false;
+    }
+    channel->iOutstanding++;
+    return true;
+}
+
+void EventDispatcherUpnp::Unreserve(const Brx& aSid)
+{
+    Brh republishSid;
+    PropertyWriterFactory* factory = NULL;
+    iLock.Wait();
+    Channel* channel = FindLocked(aSid);
+    ASSERT(channel != NULL);
+    ReleaseLocked(*channel, 1, republishSid, factory);
+    iLock.Signal();
+    Republish(republishSid, factory);
+}
+
+void EventDispatcherUpnp::Queue(const Brx& aSid, WriterBwh* aRequest)
+{
+    iLock.Wait();
+    Channel* channel = FindLocked(aSid);
+    ASSERT(channel != NULL);
+    if (channel->iUnreachable) {
+        Brh republishSid;
+        PropertyWriterFactory* factory = NULL;
+        ReleaseLocked(*channel, 1, republishSid, factory);
+        iLock.Signal();
+        iPool.ReleaseBuffer(aRequest);
+        Republish(republishSid, factory);
+        return;
+    }
+    channel->iQueued.push_back(aRequest);
+    TBool wake = false;
+    if (!channel->iRunning) {
+        channel->iRunning = true;
+        iReady.push_back(channel);
+        wake = true;
+    }
+    iLock.Signal();
+    if (wake) {
+        Wake();
+    }
+}
+
+TUint EventDispatcherUpnp::Outstanding(const Brx& aSid)
+{
+    AutoMutex a(iLock);
+    Channel* channel = FindLocked(aSid);
+    return (channel == NULL? 0 : channel->iOutstanding);
+}
+
+void EventDispatcherUpnp::Start(Channel& aChannel)
+{
+    iLock.Wait();
+    ASSERT(aChannel.iQueued.size() > 0);
+    aChannel.iRequest = aChannel.iQueued.front();
+    aChannel.iQueued.pop_front();
+    iLock.Signal();
+    Begin(aChannel, aChannel.iSubscriber, aChannel.iRequest->Buffer());
+}
+
+void EventDispatcherUpnp::Fail(Channel& aChannel, TBool aUnreachable, const TChar* aLogStr)
+{
+    (void)aLogStr; // only logged when DEFINE_TRACE is set
+    LOG2(kDvEvent, kError, "Error - %s - from SID ", aLogStr);
+    LOG2(kDvEvent, kError, aChannel.iSid);
+    LOG2(kDvEvent, kError, "\n");
+    if (aUnreachable) {
+        // discard anything else queued; the subscription is about to be removed
+        std::list<WriterBwh*> queued;
+        Brh republishSid;
+        PropertyWriterFactory* factory = NULL;
+        iLock.Wait();
+        aChannel.iUnreachable = true;
+        queued.swap(aChannel.iQueued);
+        ReleaseLocked(aChannel, (TUint)queued.size(), republishSid, factory);
+        iLock.Signal();
+        while (queued.size() > 0) {
+            iPool.ReleaseBuffer(queued.front());
+            queued.pop_front();
+        }
+        aChannel.iFactory.SubscriberUnreachable(aChannel.iSid);
+    }
+    Finish(aChannel, false);
+}
+
+void EventDispatcherUpnp::Finish(Channel& aChannel, TBool aReusable)
+{
+    End(aChannel, aReusable);
+    iPool.ReleaseBuffer(aChannel.iRequest);
+    aChannel.iRequest = NULL;
+
+    Brh republishSid;
+    PropertyWriterFactory* factory = NULL;
+    iLock.Wait();
+    const TBool more = (aChannel.iQueued.size() > 0);
+    if (!more) {
+        aChannel.iRunning = false;
+    }
+    ReleaseLocked(aChannel, 1, republishSid, factory); // deletes aChannel if it is now unused
+    iLock.Signal();
+    Republish(republishSid, factory);
+    if (more) {
+        Start(aChannel);
+    }
+}
+
+void EventDispatcherUpnp::ReleaseLocked(Channel& aChannel, TUint aCount, Brh& aRepublishSid, PropertyWriterFactory*& aFactory)
+{
+    ASSERT(aChannel.iOutstanding >= aCount);
+    aChannel.iOutstanding -= aCount;
+    if (aChannel.iDeferred && aChannel.iOutstanding < kMaxOutstandingEvents && !aChannel.iUnreachable) {
+        aChannel.iDeferred = false;
+        aRepublishSid.Set(aChannel.iSid);
+        aFactory = &aChannel.iFactory;
+        aFactory->AddRef();
+    }
+    if (aChannel.iOutstanding == 0 && !aChannel.iRunning) {
+        Brn sid(aChannel.iSid);
+        iChannels.erase(sid);
+        aChannel.iFactory.RemoveRef();
+        delete &aChannel;
+    }
+}
+
+void EventDispatcherUpnp::Republish(Brh& aSid, PropertyWriterFactory* aFactory)
+{
+    if (aFactory != NULL) {
+        aFactory->Republish(aSid);
+        aFactory->RemoveRef();
+    }
+}
+
+EventDispatcherUpnp::Channel* EventDispatcherUpnp::FindLocked(const Brx& aSid)
+{
+    Brn sid(aSid);
+    ChannelMap::iterator it = iChannels.find(sid);
+    if (it == iChannels.end()) {
+        return NULL;
+    }
+    return it->second;
+}
+
+void EventDispatcherUpnp::ProcessQueued()
+{
+    std::vector<Channel*> ready;
+    iLock.Wait();
+    ready.swap(iReady);
+    iLock.Signal();
+    for (TUint i=0; i<(TUint)ready.size(); i++) {
+        Start(*ready[i]);
+    }
+}
 
-    iWriteBuffer->Write(Brn("<?xml version=\"1.0\"?>"));
-    iWriteBuffer->Write(Brn("<e:propertyset xmlns:e=\"urn:schemas-upnp-org:event-1-0\">"));
+TUint EventDispatcherUpnp::TimeoutMs() const
+{
+    return kResponseTimeoutMs;
+}
+
+void EventDispatcherUpnp::ResponseReceived(ReactorHttpExchange& aExchange, TBool aClosed)
+{
+    Channel& channel = static_cast<Channel&>(aExchange);
+    const Brx& response = aExchange.Response();
+    if (aExchange.HeaderBytes() == 0) {
+        Fail(channel, false, "Reader");
+        return;
+    }
+
+    TBool reusable = false;
+    try {
+        ReaderBuffer reader(response.Split(0, aExchange.HeaderBytes()));
+        ReaderHttpResponse readerResponse(reader);
+        HttpHeaderContentLength headerContentLength;
+        HttpHeaderConnection headerConnection;
+        readerResponse.AddHeader(headerContentLength);
+        readerResponse.AddHeader(headerConnection);
+        readerResponse.Read();
+        const HttpStatus& status = readerResponse.Status();
+        if (status != HttpStatus::kOk) {
+            LOG2(kDvEvent, kError, "EventDispatcherUpnp, http error %u ", status.Code());
+            LOG2(kDvEvent, kError, status.Reason());
+            LOG2(kDvEvent, kError, "\n");
+        }
+        const TBool keepAlive = (readerResponse.Version() == Http::eHttp11? !headerConnection.Close() : headerConnection.KeepAlive());
+        // a response without a length may be delimited by the subscriber closing the connection
+        reusable = (!aClosed && keepAlive && headerContentLength.Received() &&
+                    response.Bytes() == aExchange.HeaderBytes() + headerContentLength.ContentLength());
+    }
+    catch (HttpError&) {
+        Fail(channel, false, "Http");
+        return;
+    }
+    catch (ReaderError&) {
+        Fail(channel, false, "Reader");
+        return;
+    }
+    Finish(channel, reusable);
+}
+
+void EventDispatcherUpnp::ExchangeFailed(ReactorHttpExchange& aExchange, EFailure aFailure)
+{
+    Channel& channel = static_cast<Channel&>(aExchange);
+    switch (aFailure)
+    {
+    case eFailConnect:
+        Fail(channel, false, "Connect");
+        break;
+    case eFailConnectTimeout:
+        Fail(channel, true, "Connect timeout");
+        break;
+    case eFailWrite:
+        Fail(channel, false, "Writer");
+        break;
+    case eFailNetwork:
+        Fail(channel, false, "Network");
+        break;
+    case eFailTimeout:
+        Fail(channel, false, "Response timeout");
+        break;
+    case eFailResponseTooLong:
+        Fail(channel, false, "Response too long");
+        break;
+    }
+}
+
+
+// PropertyWriterUpnp
+
+PropertyWriterUpnp::PropertyWriterUpnp(PropertyWriterPoolUpnp& aPool, const Endpoint& aPublisher, const Endpoint& aSubscriber,
+                                       const Brx& aSubscriberPath, const Brx& aSid, TUint aSequenceNumber)
+    : iPool(aPool)
+    , iDispatcher(NULL)
+    , iQueued(false)
+    , iPublisher(aPublisher)
+    , iSubscriber(aSubscriber)
+    , iSubscriberPath(aSubscriberPath)
+    , iSid(aSid)
+    , iSequenceNumber(aSequenceNumber)
+    , iReusable(false)
+{
+    // connect now so that an unreachable subscriber is reported before any properties are marked as published
+    iConnection = iPool.ClaimConnection(iSubscriber, iReused);
+    iBody = iPool.ClaimBuffer();
+    iRequest = iPool.ClaimBuffer();
+    SetWriter(*iBody);
+
+    iBody->Write(Brn("<?xml version=\"1.0\"?>"));
+    iBody->Write(Brn("<e:propertyset xmlns:e=\"urn:schemas-upnp-org:event-1-0\">"));
+}
+
+PropertyWriterUpnp::PropertyWriterUpnp(PropertyWriterPoolUpnp& aPool, EventDispatcherUpnp& aDispatcher, const Endpoint& aPublisher,
+                                       const Endpoint& aSubscriber, const Brx& aSubscriberPath, const Brx& aSid, TUint aSequenceNumber)
+    : iPool(aPool)
+    , iDispatcher(&aDispatcher)
+    , iQueued(false)
+    , iPublisher(aPublisher)
+    , iSubscriber(aSubscriber)
+    , iSubscriberPath(aSubscriberPath)
+    , iSid(aSid)
+    , iSequenceNumber(aSequenceNumber)
+    , iConnection(NULL)
+    , iReused(false)
+    , iReusable(false)
+{
+    iBody = iPool.ClaimBuffer();
+    iRequest = iPool.ClaimBuffer();
+    SetWriter(*iBody);
+
+    iBody->Write(Brn("<?xml version=\"1.0\"?>"));
+    iBody->Write(Brn("<e:propertyset xmlns:e=\"urn:schemas-upnp-org:event-1-0\">"));
 }
 
 PropertyWriterUpnp::~PropertyWriterUpnp()
 {
-    delete iWriterEvent;
-    delete iWriteBuffer;
-    delete iWriterChunked;
-    iSocket.Close();
+    if (iDispatcher != NULL) {
+        if (!iQueued) {
+            iDispatcher->Unreserve(iSid);
+        }
+    }
+    else {
+        iPool.ReleaseConnection(iConnection, iReusable);
+    }
+    if (iRequest != NULL) {
+        iPool.ReleaseBuffer(iRequest);
+    }
+    iPool.ReleaseBuffer(iBody);
 }
 
 void PropertyWriterUpnp::PropertyWriteEnd()
 {
-    iWriteBuffer->Write(Brn("</e:propertyset>"));
-    iWriteBuffer->WriteFlush();
+    iBody->Write(Brn("</e:propertyset>"));
+    if (iDispatcher != NULL) {
+        WriteRequest();
+        WriterBwh* request = iRequest;
+        iRequest = NULL;
+        iQueued = true;
+        iDispatcher->Queue(iSid, request);
+        return;
+    }
+    for (;;) {
+        try {
+            WriteRequest();
+            iConnection->iSocket.Write(iRequest->Buffer());
+            ReadResponse();
+            return;
+        }
+        catch (WriterError&) {
+            if (!iReused) {
+                throw;
+            }
+        }
+        catch (ReaderError&) {
+            if (!iReused || !iConnection->iReader.ClosedBeforeData()) {
+                throw;
+            }
+        }
+        /* The subscriber closed a keep-alive connection while it was idle.  Assume the
+           event wasn't processed and resend it on another connection.  After a timeout or
+           a partial response the subscriber may already have the event so resending it
+           with the same SEQ would risk a duplicate. */
+        LOG(kDvEvent, "PropertyWriterUpnp - stale connection, retrying\n");
+        EventConnectionUpnp* connection = iConnection;
+        iConnection = NULL;
+        iPool.ReleaseConnection(connection, false);
+        iConnection = iPool.ClaimConnection(iSubscriber, iReused);
+    }
+}
+
+void PropertyWriterUpnp::WriteRequest()
+{
+    // headers and body are sent with a single write to avoid nagle delays on kept-alive connections
+    iRequest->Reset();
+    WriterHttpRequest writerEvent(*iRequest);
+    writerEvent.WriteMethod(kUpnpMethodNotify, iSubscriberPath, Http::eHttp11);
 
-    Srs<kMaxResponseBytes> readBuffer(iSocket);
+    IWriterAscii& writer = writerEvent.WriteHeaderField(Http::kHeaderHost);
+    Endpoint::EndpointBuf buf;
+    iPublisher.AppendEndpoint(buf);
+    writer.Write(buf);
+    writer.WriteFlush();
+
+    writerEvent.WriteHeader(Http::kHeaderContentType, Brn("text/xml; charset=\"utf-8\""));
+    writerEvent.WriteHeader(kUpnpHeaderNt, Brn("upnp:event"));
+    writerEvent.WriteHeader(kUpnpHeaderNts, Brn("upnp:propchange"));
+
+    writer = writerEvent.WriteHeaderField(HeaderSid::kHeaderSid);
+    writer.Write(HeaderSid::kFieldSidPrefix);
+    writer.Write(iSid);
+    writer.WriteFlush();
+
+    writer = writerEvent.WriteHeaderField(kUpnpHeaderSeq);
+    writer.WriteUint(iSequenceNumber);
+    writer.WriteFlush();
+
+    Http::WriteHeaderContentLength(writerEvent, iBody->Buffer().Bytes());
+    writerEvent.WriteFlush();
+    iRequest->Write(iBody->Buffer());
+}
+
+void PropertyWriterUpnp::ReadResponse()
+{
+    Srs<EventConnectionUpnp::kMaxResponseBytes>& readBuffer = iConnection->iReadBuffer;
     ReaderHttpResponse readerResponse(readBuffer);
+    HttpHeaderContentLength headerContentLength;
+    HttpHeaderConnection headerConnection;
+    readerResponse.AddHeader(headerContentLength);
+    readerResponse.AddHeader(headerConnection);
     readerResponse.Read(kReadTimeoutMs);
     const HttpStatus& status = readerResponse.Status();
     if (status != HttpStatus::kOk) {
@@ -365,6 +898,18 @@ void PropertyWriterUpnp::PropertyWriteEnd()
         LOG2(kDvEvent, kError, status.Reason());
         LOG2(kDvEvent, kError, "\n");
     }
+
+    TBool keepAlive = (readerResponse.Version() == Http::eHttp11? !headerConnection.Close() : headerConnection.KeepAlive());
+    // a response without a length may be delimited by the subscriber closing the connection
+    if (keepAlive && headerContentLength.Received()) {
+        const TUint length = headerContentLength.ContentLength();
+        if (length <= EventConnectionUpnp::kMaxResponseBytes) {
+            if (length > 0) {
+                (void)readBuffer.Read(length);
+            }
+            iReusable = true;
+        }
+    }
 }
 
 
@@ -390,10 +935,8 @@ void PropertyWriterFactory::SubscriptionAdded(DviSubscription& aSubscription)
 
 void PropertyWriterFactory::Disable()
 {
-    Stack::Mutex().Wait();
-    iEnabled = false;
-    Stack::Mutex().Signal();
     iSubscriptionMapLock.Wait();
+    iEnabled = false;
     std::vector<DviSubscription*> subscriptions;
     SubscriptionMap::iterator it = iSubscriptionMap.begin();
     if (it != iSubscriptionMap.end()) {
@@ -414,15 +957,65 @@ void PropertyWriterFactory::Disable()
 
 IPropertyWriter* PropertyWriterFactory::CreateWriter(const IDviSubscriptionUserData* aUserData, const Brx& aSid, TUint aSequenceNumber)
 {
-    Stack::Mutex().Wait();
+    iSubscriptionMapLock.Wait();
     TBool enabled = iEnabled;
-    Stack::Mutex().Signal();
+    iSubscriptionMapLock.Signal();
     if (!enabled) {
         return NULL;
     }
     Endpoint publisher(iPort, iAdapter);
     const SubscriptionDataUpnp* data = reinterpret_cast<const SubscriptionDataUpnp*>(aUserData->Data());
-    return new PropertyWriterUpnp(publisher, data->Subscriber(), data->SubscriberPath(), aSid, aSequenceNumber);
+    EventDispatcherUpnp* dispatcher = DviStack::EventDispatcher();
+    if (dispatcher == NULL) {
+        return new PropertyWriterUpnp(DviStack::PropertyWriterPool(), publisher, data->Subscriber(), data->SubscriberPath(), aSid, aSequenceNumber);
+    }
+    if (!dispatcher->Reserve(*this, aSid, data->Subscriber())) {
+        // earlier events are still being delivered; changes stay pending until the dispatcher asks us to Republish()
+        LOG(kDvEvent, "PropertyWriterFactory - events outstanding, deferring publish for ");
+        LOG(kDvEvent, aSid);
+        LOG(kDvEvent, "\n");
+        return NULL;
+    }
+    try {
+        return new PropertyWriterUpnp(DviStack::PropertyWriterPool(), *dispatcher, publisher, data->Subscriber(),
+                                      data->SubscriberPath(), aSid, aSequenceNumber);
+    }
+    catch (...) {
+        dispatcher->Unreserve(aSid);
+        throw;
+    }
+}
+
+DviSubscription* PropertyWriterFactory::TryClaimSubscription(const Brx& aSid)
+{
+    DviSubscription* subscription = NULL;
+    iSubscriptionMapLock.Wait();
+    Brn sid(aSid);
+    SubscriptionMap::iterator it = iSubscriptionMap.find(sid);
+    if (it != iSubscriptionMap.end() && it->second->TryAddRef()) {
+        subscription = it->second;
+    }
+    iSubscriptionMapLock.Signal();
+    return subscription;
+}
+
+void PropertyWriterFactory::Republish(const Brx& aSid)
+{
+    DviSubscription* subscription = TryClaimSubscription(aSid);
+    if (subscription != NULL) {
+        DviSubscriptionManager::QueueUpdate(*subscription);
+        subscription->RemoveRef();
+    }
+}
+
+void PropertyWriterFactory::SubscriberUnreachable(const Brx& aSid)
+{
+    // as for the blocking writer, a subscriber we can't connect to is assumed to have gone away
+    DviSubscription* subscription = TryClaimSubscription(aSid);
+    if (subscription != NULL) {
+        subscription->Remove();
+        subscription->RemoveRef();
+    }
 }
 
 void PropertyWriterFactory::NotifySubscriptionDeleted(const Brx& aSid)
@@ -449,18 +1042,12 @@ PropertyWriterFactory::~PropertyWriterFactory()
 
 void PropertyWriterFactory::AddRef()
 {
-    Stack::Mutex().Wait();
-    iRefCount++;
-    Stack::Mutex().Signal();
+    (void)iRefCount.Inc();
 }
 
 void PropertyWriterFactory::RemoveRef()
 {
-    Stack::Mutex().Wait();
-    iRefCount--;
-    TBool dead = (iRefCount == 0);
-    Stack::Mutex().Signal();
-    if (dead) {
+    if (iRefCount.Dec() == 0) {
         delete this;
     }
 }
@@ -496,6 +1083,11 @@ DviSessionUpnp::DviSessionUpnp(TIpAddress aInterface, TUint aPort, IRedirector&
     iReaderRequest->AddHeader(iHeaderNt);
     iReaderRequest->AddHeader(iHeaderCallback);
     iReaderRequest->AddHeader(iHeaderAcceptLanguage);
+    iReaderRequest->AddHeader(iHeaderAcceptEncoding);
+    iReaderRequest->AddHeader(iHeaderIfNoneMatch);
+    iReaderRequest->AddHeader(iHeaderIfModifiedSince);
+    iReaderRequest->AddHeader(iHeaderIfRange);
+    iReaderRequest->AddHeader(iHeaderRange);
 
     iPropertyWriterFactory = new PropertyWriterFactory(aInterface, aPort);
 }
@@ -516,10 +1108,18 @@ void DviSessionUpnp::Run()
 {
     iShutdownSem.Wait();
     iErrorStatus = &HttpStatus::kOk;
+    iPersistConnection = false;
     iReaderRequest->Flush();
     iWriterChunked->SetChunked(false);
     iInvocationService = NULL;
     iResourceWriterHeadersOnly = false;
+    iResourceWriterChunked = false;
+    iEntityTag.SetBytes(0);
+    iContentEncoding.SetBytes(0);
+    iContentEncodingOffered = false;
+    iLastModified = 0;
+    iResourceRange = false;
+    iResourceOffset = 0;
     // check headers
     try {
         try {
@@ -534,16 +1134,26 @@ void DviSessionUpnp::Run()
         const Brx& method = iReaderRequest->Method();
         iReaderRequest->UnescapeUri();
 
-        Stack::Mutex().Wait();
         LOG(kDvDevice, "Method: ");
         LOG(kDvDevice, method);
         LOG(kDvDevice, ", uri: ");
         LOG(kDvDevice, iReaderRequest->Uri());
         LOG(kDvDevice, "\n");
-        Stack::Mutex().Signal();
 
         iResponseStarted = false;
         iResponseEnded = false;
+        if (!KeepAliveSupported() || method == Http::kMethodHead) {
+            iPersistConnection = false;
+        }
+        else if (iReaderRequest->Version() == Http::eHttp11) {
+            iPersistConnection = !iHeaderConnection.Close();
+        }
+        else {
+            iPersistConnection = iHeaderConnection.KeepAlive();
+        }
+        if (method != Http::kMethodPost && iHeaderContentLength.ContentLength() > 0) {
+            iPersistConnection = false; // we don't read request bodies for other methods
+        }
         if (method == Http::kMethodGet) {
             Get();
         }
@@ -563,11 +1173,14 @@ void DviSessionUpnp::Run()
     }
     catch (HttpError&) {
         iErrorStatus = &HttpStatus::kBadRequest;
+        iPersistConnection = false;
     }
     catch (ReaderError&) {
         iErrorStatus = &HttpStatus::kBadRequest;
+        iPersistConnection = false;
     }
     catch (WriterError&) {
+        iPersistConnection = false;
     }
     try {
         if (!iResponseStarted) {
@@ -581,6 +1194,9 @@ void DviSessionUpnp::Run()
         else if (!iResponseEnded) {
             iWriterResponse->WriteFlush();
         }
+        else if (iPersistConnection) {
+            KeepAlive(iReadBuffer->Snaffle()); // may already hold the start of a pipelined request
+        }
     }
     catch (WriterError&) {}
     iShutdownSem.Signal();
@@ -615,6 +1231,8 @@ void DviSessionUpnp::Get()
         writerLocation.Write(endptBuf);
         writerLocation.Write(redirectTo);
         writerLocation.WriteFlush();
+        iPersistConnection = false;
+        WriteHeaderConnection();
         iWriterResponse->WriteFlush();
         iResponseEnded = true;
     }
@@ -654,6 +1272,7 @@ void DviSessionUpnp::Post()
         }
     }
     else {
+        iPersistConnection = false; // request body hasn't been read
         const HttpStatus* err = &HttpStatus::kNotFound;
         InvocationReportErrorNoThrow(err->Code(), err->Reason());
     }
@@ -702,7 +1321,8 @@ void DviSessionUpnp::Subscribe()
     writerTimeout.Write(HeaderTimeout::kFieldTimeoutPrefix);
     writerTimeout.WriteUint(duration);
     writerTimeout.WriteFlush();
-    iWriterResponse->WriteHeader(Http::kHeaderConnection, Http::kConnectionClose);
+    Http::WriteHeaderContentLength(*iWriterResponse, 0);
+    WriteHeaderConnection();
     iWriterResponse->WriteFlush();
     iResponseEnded = true;
 
@@ -749,7 +1369,8 @@ void DviSessionUpnp::Unsubscribe()
     }
     iResponseStarted = true;
     iWriterResponse->WriteStatus(HttpStatus::kOk, Http::eHttp11);
-    iWriterResponse->WriteHeader(Http::kHeaderConnection, Http::kConnectionClose);
+    Http::WriteHeaderContentLength(*iWriterResponse, 0);
+    WriteHeaderConnection();
     iWriterResponse->WriteFlush();
     iResponseEnded = true;
 
@@ -793,7 +1414,8 @@ void DviSessionUpnp::Renew()
     writerTimeout.Write(HeaderTimeout::kFieldTimeoutPrefix);
     writerTimeout.WriteUint(duration);
     writerTimeout.WriteFlush();
-    iWriterResponse->WriteHeader(Http::kHeaderConnection, Http::kConnectionClose);
+    Http::WriteHeaderContentLength(*iWriterResponse, 0);
+    WriteHeaderConnection();
     iWriterResponse->WriteFlush();
     iResponseEnded = true;
 
@@ -847,18 +1469,150 @@ void DviSessionUpnp::WriteServerHeader(IWriterHttpHeader& aWriter)
     stream.WriteFlush();
 }
 
+void DviSessionUpnp::WriteHeaderConnection()
+{
+    if (!iPersistConnection) {
+        Http::WriteHeaderConnectionClose(*iWriterResponse);
+    }
+    else if (iReaderRequest->Version() == Http::eHttp10) {
+        iWriterResponse->WriteHeader(Http::kHeaderConnection, Http::kConnectionKeepAlive);
+    }
+}
+
+void DviSessionUpnp::WriteNotModified()
+{
+    iResponseStarted = true;
+    iWriterResponse->WriteStatus(HttpStatus::kNotModified, Http::eHttp11);
+    WriteValidators();
+    WriteHeaderConnection();
+    iWriterResponse->WriteFlush();
+    iResponseEnded = true;
+}
+
+void DviSessionUpnp::WriteValidators()
+{
+    if (iContentEncodingOffered) {
+        iWriterResponse->WriteHeader(Http::kHeaderVary, Http::kHeaderAcceptEncoding);
+    }
+    if (iEntityTag.Bytes() > 0) {
+        iWriterResponse->WriteHeader(Http::kHeaderETag, iEntityTag);
+    }
+    if (iLastModified != 0) {
+        Bws<Http::kMaxDateBytes> date;
+        Http::AppendDate(date, iLastModified);
+        iWriterResponse->WriteHeader(Http::kHeaderLastModified, date);
+    }
+}
+
+TUint DviSessionUpnp::ResourceRangeClip(TUint aBytes, TUint& aSkip)
+{ // returns the number of bytes, starting aSkip bytes into the next aBytes of the resource, to send
+    const TUint start = iResourceOffset;
+    iResourceOffset += aBytes;
+    aSkip = 0;
+    if (!iResourceRange) {
+        return aBytes;
+    }
+    if (iResourceOffset <= iRangeFirst || start >= iRangeEnd) {
+        return 0;
+    }
+    if (start < iRangeFirst) {
+        aSkip = iRangeFirst - start;
+    }
+    const TUint end = (iResourceOffset < iRangeEnd? iResourceOffset : iRangeEnd);
+    return end - start - aSkip;
+}
+
+TBool DviSessionUpnp::WriteResourceContentEncoding(const TChar* aContentEncoding)
+{
+    iContentEncodingOffered = true;
+    Brn encoding(aContentEncoding);
+    if (iContentEncoding.Bytes() > 0 || encoding.Bytes() > iContentEncoding.MaxBytes() || !iHeaderAcceptEncoding.Accepts(encoding)) {
+        return false;
+    }
+    iContentEncoding.Replace(encoding);
+    return true;
+}
+
+TBool DviSessionUpnp::WriteResourceEntityTag(const TChar* aEntityTag)
+{
+    Brn entityTag(aEntityTag);
+    if (entityTag.Bytes() > iEntityTag.MaxBytes()) {
+        return false; // too long to echo back; serve the resource without a validator
+    }
+    iEntityTag.Replace(entityTag);
+    if (!iHeaderIfNoneMatch.Matches(iEntityTag)) {
+        return false;
+    }
+    WriteNotModified();
+    return true;
+}
+
+TBool DviSessionUpnp::WriteResourceLastModified(TUint64 aLastModified)
+{
+    iLastModified = aLastModified;
+    if (iHeaderIfNoneMatch.Received()) {
+        return false; // If-None-Match takes precedence over If-Modified-Since (rfc7232, 3.3)
+    }
+    if (iHeaderIfModifiedSince.Modified(iLastModified)) {
+        return false;
+    }
+    WriteNotModified();
+    return true;
+}
+
 void DviSessionUpnp::WriteResourceBegin(TUint aTotalBytes, const TChar* aMimeType)
 {
     if (iHeaderExpect.Continue()) {
         iWriterResponse->WriteStatus(HttpStatus::kContinue, Http::eHttp11);
         iWriterResponse->WriteFlush();
     }
-    iWriterResponse->WriteStatus(HttpStatus::kOk, Http::eHttp11);
-    if (aTotalBytes > 0) {
-        Http::WriteHeaderContentLength(*iWriterResponse, aTotalBytes);
+    TBool rangeUnsatisfiable = false;
+    if (aTotalBytes > 0 && iHeaderRange.Valid() && iHeaderIfRange.Matches(iEntityTag, iLastModified)) {
+        TUint bytes;
+        if (iHeaderRange.Resolve(aTotalBytes, iRangeFirst, bytes)) {
+            iResourceRange = true;
+            iRangeEnd = iRangeFirst + bytes;
+        }
+        else {
+            rangeUnsatisfiable = true;
+        }
+    }
+    if (rangeUnsatisfiable) {
+        iWriterResponse->WriteStatus(HttpStatus::kRequestedRangeNotSatisfiable, Http::eHttp11);
+        IWriterAscii& writer = iWriterResponse->WriteHeaderField(Http::kHeaderContentRange);
+        writer.Write(Brn("bytes */"));
+        writer.WriteUint(aTotalBytes);
+        writer.WriteFlush();
+        Http::WriteHeaderContentLength(*iWriterResponse, 0);
+        WriteHeaderConnection();
+        iWriterResponse->WriteFlush();
+        iResourceWriterHeadersOnly = true; // discard the file data the resource manager goes on to write
+        iResponseStarted = true;
+        return;
+    }
+    if (iResourceRange) {
+        iWriterResponse->WriteStatus(HttpStatus::kPartialContent, Http::eHttp11);
+        IWriterAscii& writer = iWriterResponse->WriteHeaderField(Http::kHeaderContentRange);
+        writer.Write(Brn("bytes "));
+        writer.WriteUint(iRangeFirst);
+        writer.Write('-');
+        writer.WriteUint(iRangeEnd - 1);
+        writer.Write('/');
+        writer.WriteUint(aTotalBytes);
+        writer.WriteFlush();
+        Http::WriteHeaderContentLength(*iWriterResponse, iRangeEnd - iRangeFirst);
     }
     else {
-        iWriterResponse->WriteHeader(Http::kHeaderTransferEncoding, Http::kTransferEncodingChunked);
+        iWriterResponse->WriteStatus(HttpStatus::kOk, Http::eHttp11);
+        if (aTotalBytes > 0) {
+            Http::WriteHeaderContentLength(*iWriterResponse, aTotalBytes);
+        }
+        else {
+            iWriterResponse->WriteHeader(Http::kHeaderTransferEncoding, Http::kTransferEncodingChunked);
+        }
+    }
+    if (aTotalBytes > 0) {
+        iWriterResponse->WriteHeader(Http::kHeaderAcceptRanges, Brn("bytes"));
     }
     if (aMimeType != NULL) {
         IWriterAscii& writer = iWriterResponse->WriteHeaderField(Http::kHeaderContentType);
@@ -866,10 +1620,15 @@ void DviSessionUpnp::WriteResourceBegin(TUint aTotalBytes, const TChar* aMimeTyp
         writer.Write(Brn("; charset=\"utf-8\""));
         writer.WriteFlush();
     }
-    Http::WriteHeaderConnectionClose(*iWriterResponse);
+    if (iContentEncoding.Bytes() > 0) {
+        iWriterResponse->WriteHeader(Http::kHeaderContentEncoding, iContentEncoding);
+    }
+    WriteValidators();
+    WriteHeaderConnection();
     iWriterResponse->WriteFlush();
     if (aTotalBytes == 0) {
         iWriterChunked->SetChunked(true);
+        iResourceWriterChunked = true;
     }
     iResponseStarted = true;
 }
@@ -879,7 +1638,12 @@ void DviSessionUpnp::WriteResource(const TByte* aData, TUint aBytes)
     if (iResourceWriterHeadersOnly) {
         return;
     }
-    Brn buf(aData, aBytes);
+    TUint skip;
+    const TUint bytes = ResourceRangeClip(aBytes, skip);
+    if (bytes == 0) {
+        return;
+    }
+    Brn buf(aData + skip, bytes);
 #if 0
     Log::Print("Writing resource...\n");
     Log::Print(buf);
@@ -888,6 +1652,50 @@ void DviSessionUpnp::WriteResource(const TByte* aData, TUint aBytes)
     iWriterBuffer->Write(buf);
 }
 
+void DviSessionUpnp::WriteResourceRegion(const TByte* aData, TUint aBytes)
+{
+    if (iResourceWriterHeadersOnly) {
+        return;
+    }
+    if (iResourceWriterChunked || aBytes <= kMaxResponseBytes) {
+        WriteResource(aData, aBytes);
+        return;
+    }
+    TUint skip;
+    const TUint bytes = ResourceRangeClip(aBytes, skip);
+    if (bytes == 0) {
+        return;
+    }
+    // pass any buffered headers/data on then send the region straight from the caller's memory
+    iWriterBuffer->WriteDrain();
+    iWriterChunked->WriteDrain();
+    Write(Brn(aData + skip, bytes));
+}
+
+TBool DviSessionUpnp::WriteResourceFile(TInt aFile, TUint64 aOffset, TUint aBytes)
+{
+    if (iResourceWriterHeadersOnly) {
+        return true;
+    }
+    if (iResourceWriterChunked) {
+        return false; // chunk framing has to be interleaved with the data
+    }
+    TUint skip;
+    const TUint bytes = ResourceRangeClip(aBytes, skip);
+    if (bytes == 0) {
+        return true;
+    }
+    iWriterBuffer->WriteDrain();
+    iWriterChunked->WriteDrain();
+    try {
+        SendFile(aFile, aOffset + skip, bytes);
+    }
+    catch (NetworkError&) {
+        THROW(WriterError);
+    }
+    return true;
+}
+
 void DviSessionUpnp::WriteResourceEnd()
 {
     iResponseEnded = true;
@@ -936,7 +1744,7 @@ void DviSessionUpnp::InvocationReadStart()
         Brn envelope = XmlParserBasic::Find("Envelope", iSoapRequest);
         Brn body = XmlParserBasic::Find("Body", envelope);
         Brn args = XmlParserBasic::Find(iHeaderSoapAction.Action(), body);
-        iSoapRequest.Set(args);
+        iSoapArgs.Set(args);
     }
     catch (XmlError&) {
         InvocationReportError(501, Brn("Invalid XML"));
@@ -946,7 +1754,7 @@ void DviSessionUpnp::InvocationReadStart()
 TBool DviSessionUpnp::InvocationReadBool(const TChar* aName)
 {
     try {
-        Brn value = XmlParserBasic::Find(aName, iSoapRequest);
+        Brn value = iSoapArgs.Find(aName);
         try {
             TUint num = Ascii::Uint(value);
             return (num != 0);
@@ -970,7 +1778,7 @@ TBool DviSessionUpnp::InvocationReadBool(const TChar* aName)
 void DviSessionUpnp::InvocationReadString(const TChar* aName, Brhz& aString)
 {
     try {
-        Brn value = XmlParserBasic::Find(aName, iSoapRequest);
+        Brn value = iSoapArgs.Find(aName);
         Bwh writable(value.Bytes()+1);
         if (value.Bytes()) {
             writable.Append(value);
@@ -987,7 +1795,7 @@ void DviSessionUpnp::InvocationReadString(const TChar* aName, Brhz& aString)
 TInt DviSessionUpnp::InvocationReadInt(const TChar* aName)
 {
     try {
-        Brn value = XmlParserBasic::Find(aName, iSoapRequest);
+        Brn value = iSoapArgs.Find(aName);
         TInt num = Ascii::Int(value);
         return num;
     }
@@ -1003,7 +1811,7 @@ TInt DviSessionUpnp::InvocationReadInt(const TChar* aName)
 TUint DviSessionUpnp::InvocationReadUint(const TChar* aName)
 {
     try {
-        Brn value = XmlParserBasic::Find(aName, iSoapRequest);
+        Brn value = iSoapArgs.Find(aName);
         TUint num = Ascii::Uint(value);
         return num;
     }
@@ -1019,7 +1827,7 @@ TUint DviSessionUpnp::InvocationReadUint(const TChar* aName)
 void DviSessionUpnp::InvocationReadBinary(const TChar* aName, Brh& aData)
 {
     try {
-        Brn value = XmlParserBasic::Find(aName, iSoapRequest);
+        Brn value = iSoapArgs.Find(aName);
         if (value.Bytes()) {
             Bwh writable(value.Bytes()+1);
             writable.Append(value);
@@ -1034,6 +1842,7 @@ void DviSessionUpnp::InvocationReadBinary(const TChar* aName, Brh& aData)
 
 void DviSessionUpnp::InvocationReadEnd()
 {
+    iSoapArgs.Clear();
     iSoapRequest.Set(Brx::Empty());
 }
 
@@ -1049,7 +1858,7 @@ void DviSessionUpnp::InvocationReportErrorNoThrow(TUint aCode, const Brx& aDescr
     iWriterResponse->WriteHeader(Http::kHeaderContentType, Brn("text/xml; charset=\"utf-8\""));
     WriteServerHeader(*iWriterResponse);
     iWriterResponse->WriteHeader(Http::kHeaderTransferEncoding, Http::kTransferEncodingChunked);
-    iWriterResponse->WriteHeader(Http::kHeaderConnection, Http::kConnectionClose);
+    WriteHeaderConnection();
     iWriterResponse->WriteFlush();
 
     iWriterChunked->SetChunked(true);
@@ -1082,7 +1891,7 @@ void DviSessionUpnp::InvocationWriteStart()
     iWriterResponse->WriteHeader(Http::kHeaderContentType, Brn("text/xml; charset=\"utf-8\""));
     WriteServerHeader(*iWriterResponse);
     iWriterResponse->WriteHeader(Http::kHeaderTransferEncoding, Http::kTransferEncodingChunked);
-    iWriterResponse->WriteHeader(Http::kHeaderConnection, Http::kConnectionClose);
+    WriteHeaderConnection();
     iWriterResponse->WriteFlush();
 
     iWriterChunked->SetChunked(true);
@@ -1224,6 +2033,10 @@ void DviServerUpnp::Redirect(const Brx& aUriRequested, const Brx& aUriRedirected
 SocketTcpServer* DviServerUpnp::CreateServer(const NetworkAdapter& aNif)
 {
     SocketTcpServer* server = new SocketTcpServer("DSVU", iPort, aNif.Address());
+    const TUint maxParked = Stack::InitParams().MaxParkedConnections();
+    if (maxParked > 0) {
+        (void)server->ParkConnections(maxParked, Brn("\r\n\r\n"), kParkTimeoutMs);
+    }
     TChar thName[5];
     const TUint numWsThreads = Stack::InitParams().DvNumServerThreads();
     for (TUint i=0; i<numWsThreads; i++) {
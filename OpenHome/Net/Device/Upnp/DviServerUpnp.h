@@ -12,9 +12,12 @@
 #include <OpenHome/Net/Private/Service.h>
 #include <OpenHome/Net/Private/DviServer.h>
 #include <OpenHome/Net/Private/DviSubscription.h>
+#include <OpenHome/Net/Private/XmlParser.h>
+#include <OpenHome/Net/Private/ReactorHttp.h>
 
 #include <vector>
 #include <map>
+#include <list>
 
 namespace OpenHome {
 namespace Net {
@@ -98,29 +101,173 @@ private:
     Brh iSubscriberPath;
 };
 
+/**
+ * Socket to a subscriber's event server.
+ *
+ * Kept open between NOTIFYs if the subscriber supports http keep-alive.
+ */
+class EventConnectionUpnp : private INonCopyable
+{
+    friend class PropertyWriterUpnp;
+    friend class PropertyWriterPoolUpnp;
+    friend class EventDispatcherUpnp;
+public:
+    static const TUint kMaxResponseBytes = 128;
+private:
+    EventConnectionUpnp(const Endpoint& aSubscriber);
+    ~EventConnectionUpnp();
+private:
+    Endpoint iSubscriber;
+    SocketTcpClient iSocket;
+    SocketTcpReader iReader;
+    Srs<kMaxResponseBytes> iReadBuffer;
+    TUint iIdleSinceMs;
+};
+
+/**
+ * Idle connections to subscribers plus buffers for event bodies, shared by all
+ * PropertyWriterUpnp instances so that NOTIFYs don't each connect and allocate afresh.
+ *
+ * Connections which have been idle for kIdleTimeoutMs are closed rather than reused.
+ */
+class PropertyWriterPoolUpnp : private INonCopyable
+{
+public:
+    PropertyWriterPoolUpnp();
+    ~PropertyWriterPoolUpnp();
+    /**
+     * Returns an idle connection to aSubscriber if one is available, otherwise connects a new one.
+     * aReused is set to indicate which.  Ownership passes to the caller until ReleaseConnection() is called.
+     */
+    EventConnectionUpnp* ClaimConnection(const Endpoint& aSubscriber, TBool& aReused);
+    /**
+     * Returns an idle connection to aSubscriber if one is available, otherwise a new
+     * unconnected one.  Never blocks.  aReused is set to indicate which.
+     */
+    EventConnectionUpnp* ClaimConnectionNoConnect(const Endpoint& aSubscriber, TBool& aReused);
+    /**
+     * Return a connection claimed earlier.  aReusable indicates whether a complete response
+     * was read and the subscriber agreed to keep the connection open.
+     */
+    void ReleaseConnection(EventConnectionUpnp* aConnection, TBool aReusable);
+    WriterBwh* ClaimBuffer();
+    void ReleaseBuffer(WriterBwh* aBuffer);
+private:
+    void RemoveExpiredLocked(TUint aTimeNowMs);
+private:
+    static const TUint kMaxIdleConnections = 256;
+    static const TUint kIdleTimeoutMs = 3 * 1000; // shorter than control points are likely to keep an idle connection
+    static const TUint kMaxIdleBuffers = 16;
+    static const TUint kBufferGranularity = 4 * 1024;
+    static const TUint kMaxPooledBufferBytes = 64 * 1024;
+    Mutex iLock;
+    std::vector<EventConnectionUpnp*> iConnections;
+    std::vector<WriterBwh*> iBuffers;
+};
+
+class PropertyWriterFactory;
+
+/**
+ * Delivers NOTIFYs without tying up a publisher thread for each.
+ *
+ * Events are exchanged by a ReactorHttpClient so a slow or unreachable subscriber only
+ * delays its own events.  Events for a subscription
+ * are sent in order, one at a time.  At most kMaxOutstandingEvents can be reserved or queued
+ * per subscription; once that limit is reached further changes stay pending in the
+ * DviSubscription and are published together when the subscriber catches up.
+ * Construction throws NetworkError on platforms with no reactor support.
+ */
+class EventDispatcherUpnp : private ReactorHttpClient
+{
+public:
+    static const TUint kMaxOutstandingEvents = 2;
+public:
+    EventDispatcherUpnp(PropertyWriterPoolUpnp& aPool);
+    ~EventDispatcherUpnp();
+    /**
+     * Claim space for one event to aSid.  Returns false if kMaxOutstandingEvents are already
+     * outstanding; aFactory will then be asked to Republish() aSid once space is available.
+     * Each successful call must be matched by a call to either Queue() or Unreserve().
+     */
+    TBool Reserve(PropertyWriterFactory& aFactory, const Brx& aSid, const Endpoint& aSubscriber);
+    void Unreserve(const Brx& aSid);
+    /**
+     * Send aRequest (a complete NOTIFY) using space claimed by an earlier Reserve().
+     * Ownership of aRequest passes to this class.
+     */
+    void Queue(const Brx& aSid, WriterBwh* aRequest);
+    /**
+     * Number of events reserved, queued or being sent to aSid.  Intended for diagnostics.
+     */
+    TUint Outstanding(const Brx& aSid);
+private:
+    class Channel;
+    void Start(Channel& aChannel);
+    void Fail(Channel& aChannel, TBool aUnreachable, const TChar* aLogStr);
+    void Finish(Channel& aChannel, TBool aReusable);
+    void ReleaseLocked(Channel& aChannel, TUint aCount, Brh& aRepublishSid, PropertyWriterFactory*& aFactory);
+    void Republish(Brh& aSid, PropertyWriterFactory* aFactory);
+    Channel* FindLocked(const Brx& aSid);
+private: // ReactorHttpClient
+    void ProcessQueued();
+    TUint TimeoutMs() const;
+    void ResponseReceived(ReactorHttpExchange& aExchange, TBool aClosed);
+    void ExchangeFailed(ReactorHttpExchange& aExchange, EFailure aFailure);
+private:
+    static const TUint kMaxResponseBytes = 4 * 1024;
+    static const TUint kResponseTimeoutMs = 5 * 1000;
+    PropertyWriterPoolUpnp& iPool;
+    Mutex iLock;
+    typedef std::map<Brn,Channel*,BufferCmp> ChannelMap;
+    ChannelMap iChannels;            // protected by iLock
+    std::vector<Channel*> iReady;    // protected by iLock
+};
+
 class PropertyWriterUpnp : public PropertyWriter
 {
 public:
-    PropertyWriterUpnp(const Endpoint& aPublisher, const Endpoint& aSubscriber, const Brx& aSubscriberPath, const Brx& aSid, TUint aSequenceNumber);
+    PropertyWriterUpnp(PropertyWriterPoolUpnp& aPool, const Endpoint& aPublisher, const Endpoint& aSubscriber,
+                       const Brx& aSubscriberPath, const Brx& aSid, TUint aSequenceNumber);
+    /**
+     * Constructor for use with an EventDispatcherUpnp.  The caller must already have
+     * Reserve()d space for this event.
+     */
+    PropertyWriterUpnp(PropertyWriterPoolUpnp& aPool, EventDispatcherUpnp& aDispatcher, const Endpoint& aPublisher,
+                       const Endpoint& aSubscriber, const Brx& aSubscriberPath, const Brx& aSid, TUint aSequenceNumber);
 private: // IPropertyWriter
     ~PropertyWriterUpnp();
     void PropertyWriteEnd();
 private:
-    static const TUint kMaxRequestBytes = 12*1024;
-    static const TUint kMaxResponseBytes = 128;
+    void WriteRequest();
+    void ReadResponse();
+private:
     static const TUint kReadTimeoutMs = 5 * 1000;
-    SocketTcpClient iSocket;
-    Sws<kMaxRequestBytes>* iWriteBuffer;
-    WriterHttpRequest* iWriterEvent;
-    WriterHttpChunked* iWriterChunked;
+    PropertyWriterPoolUpnp& iPool;
+    EventDispatcherUpnp* iDispatcher;
+    TBool iQueued;
+    Endpoint iPublisher;
+    Endpoint iSubscriber;
+    Brn iSubscriberPath;
+    Brn iSid;
+    TUint iSequenceNumber;
+    EventConnectionUpnp* iConnection;
+    TBool iReused;
+    TBool iReusable;
+    WriterBwh* iBody;
+    WriterBwh* iRequest;
 };
 
 class PropertyWriterFactory : public IPropertyWriterFactory
 {
+    friend class EventDispatcherUpnp;
 public:
     PropertyWriterFactory(TIpAddress aAdapter, TUint aPort);
     void SubscriptionAdded(DviSubscription& aSubscription);
     void Disable();
+private: // called by EventDispatcherUpnp
+    void Republish(const Brx& aSid);
+    void SubscriberUnreachable(const Brx& aSid);
+    DviSubscription* TryClaimSubscription(const Brx& aSid);
 private: // IPropertyWriterFactory
     IPropertyWriter* CreateWriter(const IDviSubscriptionUserData* aUserData, const Brx& aSid, TUint aSequenceNumber);
     void NotifySubscriptionDeleted(const Brx& aSid);
@@ -130,8 +277,8 @@ private:
     void AddRef();
     void RemoveRef();
 private:
-    TUint iRefCount;
-    TBool iEnabled;
+    AtomicInt iRefCount;
+    TBool iEnabled; // protected by iSubscriptionMapLock
     TIpAddress iAdapter;
     TUint iPort;
     typedef std::map<Brn,DviSubscription*,BufferCmp> SubscriptionMap;
@@ -155,10 +302,19 @@ private:
     void Renew();
     void ParseRequestUri(const Brx& aUrlTail, DviDevice** aDevice, DviService** aService);
     void WriteServerHeader(IWriterHttpHeader& aWriter);
+    void WriteHeaderConnection();
     void InvocationReportErrorNoThrow(TUint aCode, const Brx& aDescription);
+    void WriteNotModified();
+    void WriteValidators();
+    TUint ResourceRangeClip(TUint aBytes, TUint& aSkip);
 private: // IResourceWriter
+    TBool WriteResourceContentEncoding(const TChar* aContentEncoding);
+    TBool WriteResourceEntityTag(const TChar* aEntityTag);
+    TBool WriteResourceLastModified(TUint64 aLastModified);
     void WriteResourceBegin(TUint aTotalBytes, const TChar* aMimeType);
     void WriteResource(const TByte* aData, TUint aBytes);
+    void WriteResourceRegion(const TByte* aData, TUint aBytes);
+    TBool WriteResourceFile(TInt aFile, TUint64 aOffset, TUint aBytes);
     void WriteResourceEnd();
 private: // IDviInvocation
     void Invoke();
@@ -190,6 +346,8 @@ private:
     static const TUint kMaxRequestBytes = 64*1024;
     static const TUint kMaxResponseBytes = 4*1024;
     static const TUint kReadTimeoutMs = 5 * 1000;
+    static const TUint kMaxEntityTagBytes = 128;
+    static const TUint kMaxContentEncodingBytes = 32;
 private:
     TIpAddress iInterface;
     TUint iPort;
@@ -209,14 +367,30 @@ private:
     HeaderNt iHeaderNt;
     HeaderCallback iHeaderCallback;
     HeaderAcceptLanguage iHeaderAcceptLanguage;
+    HttpHeaderAcceptEncoding iHeaderAcceptEncoding;
+    HttpHeaderIfNoneMatch iHeaderIfNoneMatch;
+    HttpHeaderIfModifiedSince iHeaderIfModifiedSince;
+    HttpHeaderIfRange iHeaderIfRange;
+    HttpHeaderRange iHeaderRange;
     const HttpStatus* iErrorStatus;
     TBool iResponseStarted;
     TBool iResponseEnded;
+    TBool iPersistConnection;   // leave the connection open for another request once this response ends
     Brn iSoapRequest;
+    XmlParserChildIndex iSoapArgs;
     DviDevice* iInvocationDevice;
     DviService* iInvocationService;
     mutable Bws<128> iResourceUriPrefix;
     TBool iResourceWriterHeadersOnly;
+    TBool iResourceWriterChunked;
+    Bws<kMaxEntityTagBytes> iEntityTag;
+    Bws<kMaxContentEncodingBytes> iContentEncoding;
+    TBool iContentEncodingOffered;  // response depends on Accept-Encoding so needs a Vary header
+    TUint64 iLastModified;      // 0 if not reported by the resource manager
+    TBool iResourceRange;       // only bytes [iRangeFirst, iRangeEnd) of the resource are sent
+    TUint iRangeFirst;
+    TUint iRangeEnd;
+    TUint iResourceOffset;      // bytes of the resource passed to us so far
     PropertyWriterFactory* iPropertyWriterFactory;
     Semaphore iShutdownSem;
 };
@@ -230,6 +404,8 @@ protected:
     virtual SocketTcpServer* CreateServer(const NetworkAdapter& aNif);
 private:
     TBool RedirectUri(const Brx& aUri, Brn& aRedirectTo);
+private:
+    static const TUint kParkTimeoutMs = 5 * 1000;
 private:
     TUint iPort;
     Brh iRedirectUriRequested;
@@ -3,6 +3,8 @@
 #include <OpenHome/Private/Debug.h>
 #include <OpenHome/Net/Private/Stack.h>
 
+#include <algorithm>
+
 using namespace OpenHome;
 using namespace OpenHome::Net;
 
@@ -40,6 +42,81 @@ void SsdpSocketReader::ReadInterrupt()
     iReader->ReadInterrupt();
 }
 
+// SsdpMsearchTargets
+
+// Keys are a one character target prefix followed by the uuid or the domain and type,
+// so a search and the handlers which can answer it share the same key.
+static const TChar kMsearchKeyRoot = 'r';
+static const TChar kMsearchKeyUuid = 'u';
+static const TChar kMsearchKeyDeviceType = 'd';
+static const TChar kMsearchKeyServiceType = 's';
+
+SsdpMsearchTargets::SsdpMsearchTargets()
+{
+}
+
+SsdpMsearchTargets::~SsdpMsearchTargets()
+{
+    Clear();
+}
+
+void SsdpMsearchTargets::Clear()
+{
+    for (TUint i=0; i<iKeys.size(); i++) {
+        delete iKeys[i];
+    }
+    iKeys.clear();
+}
+
+void SsdpMsearchTargets::AddRoot()
+{
+    AddKey(kMsearchKeyRoot, Brx::Empty(), Brx::Empty());
+}
+
+void SsdpMsearchTargets::AddUuid(const Brx& aUuid)
+{
+    AddKey(kMsearchKeyUuid, aUuid, Brx::Empty());
+}
+
+void SsdpMsearchTargets::AddDeviceType(const Brx& aDomain, const Brx& aType)
+{
+    AddKey(kMsearchKeyDeviceType, aDomain, aType);
+}
+
+void SsdpMsearchTargets::AddServiceType(const Brx& aDomain, const Brx& aType)
+{
+    AddKey(kMsearchKeyServiceType, aDomain, aType);
+}
+
+TBool SsdpMsearchTargets::Key(Bwx& aKey, TChar aPrefix, const Brx& aValue1, const Brx& aValue2)
+{
+    aKey.SetBytes(0);
+    if (3 + aValue1.Bytes() + aValue2.Bytes() > aKey.MaxBytes()) {
+        return false;
+    }
+    aKey.Append(aPrefix);
+    aKey.Append(':');
+    aKey.Append(aValue1);
+    aKey.Append(':');
+    aKey.Append(aValue2);
+    return true;
+}
+
+void SsdpMsearchTargets::AddKey(TChar aPrefix, const Brx& aValue1, const Brx& aValue2)
+{
+    Bws<kMaxKeyBytes> key;
+    if (!Key(key, aPrefix, aValue1, aValue2)) {
+        return; // longer than any target we could parse from a search
+    }
+    for (TUint i=0; i<iKeys.size(); i++) {
+        if (*(iKeys[i]) == key) {
+            return;
+        }
+    }
+    iKeys.push_back(new Brh(key));
+}
+
+
 // SsdpListener
 
 SsdpListener::SsdpListener()
@@ -53,7 +130,8 @@ SsdpListener::SsdpListener()
 //                                                                    -> aNotify
 
 SsdpListenerMulticast::SsdpListenerMulticast(TIpAddress aInterface)
-    : iLock("LMCM")
+    : iMsearchDisabledCount(0)
+    , iLock("LMCM")
     , iNextHandlerId(0)
     , iInterface(aInterface)
     , iSocket(aInterface, Endpoint(Ssdp::kMulticastPort, Ssdp::kMulticastAddress))
@@ -107,16 +185,27 @@ void SsdpListenerMulticast::Run()
                             Notify(*(callbacks[i]));
                         }
                     }
-                    else if (method == Ssdp::kMethodMsearch) {
+                    else if (method == Ssdp::kMethodMsearch && MsearchValid()) {
                         LOG(kSsdpMulticast, "SSDP Multicast      Msearch\n");
-                        iLock.Wait();
-                        EraseDisabled(iMsearchHandlers);
+                        Bws<SsdpMsearchTargets::kMaxKeyBytes> key;
+                        const TBool indexed = MsearchKey(key);
                         VectorMsearchHandler callbacks;
-                        TUint count = (TUint)iMsearchHandlers.size();
-                        for (TUint i=0; i<count; i++) {
-                            callbacks.push_back(iMsearchHandlers[i]);
+                        iLock.Wait();
+                        if (iMsearchDisabledCount > 0) {
+                            EraseDisabled(iMsearchHandlers);
+                        }
+                        if (!indexed) {
+                            callbacks = iMsearchHandlers;
+                        }
+                        else {
+                            MapMsearchBucket::iterator it = iMsearchIndex.find(Brn(key));
+                            if (it != iMsearchIndex.end()) {
+                                callbacks = it->second->Handlers();
+                            }
+                            callbacks.insert(callbacks.end(), iMsearchUnindexed.begin(), iMsearchUnindexed.end());
                         }
                         iLock.Signal();
+                        const TUint count = (TUint)callbacks.size();
                         for (TUint i = 0; i<count; i++) {
                             Msearch(*(callbacks[i]));
                         }
@@ -139,6 +228,27 @@ void SsdpListenerMulticast::Run()
     }
 }
 
+TBool SsdpListenerMulticast::MsearchValid()
+{
+    return (iHeaderMx.Mx() && iHeaderHost.Received() && iHeaderMan.Received() && iHeaderSt.Received());
+}
+
+TBool SsdpListenerMulticast::MsearchKey(Bwx& aKey)
+{ // returns false if every handler may need to see this search
+    switch (iHeaderSt.Target()) {
+    case eSsdpRoot:
+        return SsdpMsearchTargets::Key(aKey, kMsearchKeyRoot, Brx::Empty(), Brx::Empty());
+    case eSsdpUuid:
+        return SsdpMsearchTargets::Key(aKey, kMsearchKeyUuid, iHeaderSt.Uuid(), Brx::Empty());
+    case eSsdpDeviceType:
+        return SsdpMsearchTargets::Key(aKey, kMsearchKeyDeviceType, iHeaderSt.Domain(), iHeaderSt.Type());
+    case eSsdpServiceType:
+        return SsdpMsearchTargets::Key(aKey, kMsearchKeyServiceType, iHeaderSt.Domain(), iHeaderSt.Type());
+    default:
+        return false;
+    }
+}
+
 void SsdpListenerMulticast::Msearch(MsearchHandler& aHandler)
 {
     AutoMutex a(aHandler.Mutex());
@@ -151,7 +261,7 @@ void SsdpListenerMulticast::Msearch(ISsdpMsearchHandler& aMsearchHandler)
 {
     TUint mx = iHeaderMx.Mx();
 
-    if (mx && iHeaderHost.Received() && iHeaderMan.Received() && iHeaderSt.Received()) {
+    if (MsearchValid()) {
         switch(iHeaderSt.Target()) {
         case eSsdpRoot:
             LOG(kSsdpMulticast, "SSDP Multicast      Msearch Root\n");
@@ -324,6 +434,7 @@ TInt SsdpListenerMulticast::AddMsearchHandler(ISsdpMsearchHandler* aMsearchHandl
     TInt id = iNextHandlerId;
     MsearchHandler* handler = new MsearchHandler(aMsearchHandler, iNextHandlerId);
     iMsearchHandlers.push_back(handler);
+    iMsearchUnindexed.push_back(handler);
     iNextHandlerId++;
     iLock.Signal();
     return id;
@@ -355,12 +466,69 @@ void SsdpListenerMulticast::RemoveMsearchHandler(TInt aHandlerId)
             mh->Lock();
             mh->Disable();
             mh->Unlock();
+            iMsearchDisabledCount++;
             break;
         }
     }
     iLock.Signal();
 }
 
+void SsdpListenerMulticast::SetMsearchTargets(TInt aHandlerId, const SsdpMsearchTargets& aTargets)
+{
+    AutoMutex a(iLock);
+    MsearchHandler* handler = NULL;
+    for (TUint i=0; i<iMsearchHandlers.size(); i++) {
+        if (iMsearchHandlers[i]->Id() == aHandlerId) {
+            handler = iMsearchHandlers[i];
+            break;
+        }
+    }
+    if (handler == NULL) {
+        return;
+    }
+    Unindex(*handler);
+    std::vector<Brh*>& keys = handler->Keys();
+    for (TUint i=0; i<aTargets.iKeys.size(); i++) {
+        const Brh& key = *(aTargets.iKeys[i]);
+        MsearchBucket* bucket;
+        MapMsearchBucket::iterator it = iMsearchIndex.find(Brn(key));
+        if (it != iMsearchIndex.end()) {
+            bucket = it->second;
+        }
+        else {
+            bucket = new MsearchBucket(key);
+            iMsearchIndex.insert(std::pair<Brn, MsearchBucket*>(Brn(bucket->Key()), bucket));
+        }
+        bucket->Handlers().push_back(handler);
+        keys.push_back(new Brh(bucket->Key()));
+    }
+    handler->SetIndexed(true);
+}
+
+void SsdpListenerMulticast::Unindex(MsearchHandler& aHandler)
+{ // called with iLock held
+    std::vector<Brh*>& keys = aHandler.Keys();
+    for (TUint i=0; i<keys.size(); i++) {
+        MapMsearchBucket::iterator it = iMsearchIndex.find(Brn(*(keys[i])));
+        ASSERT(it != iMsearchIndex.end());
+        MsearchBucket* bucket = it->second;
+        VectorMsearchHandler& handlers = bucket->Handlers();
+        handlers.erase(std::find(handlers.begin(), handlers.end(), &aHandler));
+        if (handlers.size() == 0) {
+            iMsearchIndex.erase(it);
+            delete bucket;
+        }
+        delete keys[i];
+    }
+    keys.clear();
+    if (!aHandler.Indexed()) {
+        VectorMsearchHandler::iterator it = std::find(iMsearchUnindexed.begin(), iMsearchUnindexed.end(), &aHandler);
+        if (it != iMsearchUnindexed.end()) {
+            iMsearchUnindexed.erase(it);
+        }
+    }
+}
+
 TIpAddress SsdpListenerMulticast::Interface() const
 {
     return iInterface;
@@ -386,12 +554,14 @@ void SsdpListenerMulticast::EraseDisabled(VectorNotifyHandler& aVector)
 
 void SsdpListenerMulticast::EraseDisabled(VectorMsearchHandler& aVector)
 {
+    iMsearchDisabledCount = 0;
     VectorMsearchHandler::iterator it = aVector.begin();
     while (it != aVector.end()) {
         MsearchHandler* handler = reinterpret_cast<MsearchHandler*>(*it);
         handler->Lock();
         if (handler->IsDisabled()) {
             handler->Unlock();
+            Unindex(*handler);
             delete handler;
             it = aVector.erase(it);
         }
@@ -9,6 +9,7 @@
 #include <OpenHome/Private/Network.h>
 
 #include <vector>
+#include <map>
 
 namespace OpenHome {
 namespace Net {
@@ -40,6 +41,27 @@ public:
     virtual ~ISsdpMsearchHandler() {}
 };
 
+// SsdpMsearchTargets - search targets (other than ssdp:all) which an ISsdpMsearchHandler responds to
+//                    - versions aren't indexed; handlers still check that they support the version searched for
+class SsdpMsearchTargets : private INonCopyable
+{
+    friend class SsdpListenerMulticast;
+public:
+    SsdpMsearchTargets();
+    ~SsdpMsearchTargets();
+    void Clear();
+    void AddRoot();
+    void AddUuid(const Brx& aUuid);
+    void AddDeviceType(const Brx& aDomain, const Brx& aType);
+    void AddServiceType(const Brx& aDomain, const Brx& aType);
+private:
+    static TBool Key(Bwx& aKey, TChar aPrefix, const Brx& aDomain, const Brx& aType);
+    void AddKey(TChar aPrefix, const Brx& aValue1, const Brx& aValue2);
+private:
+    static const TUint kMaxKeyBytes = 256;
+    std::vector<Brh*> iKeys;
+};
+
 class SsdpSocketReader : public SocketUdpMulticast, public IReaderSource
 {
 public:
@@ -101,13 +123,29 @@ class SsdpListenerMulticast : public SsdpListener
     class MsearchHandler : public Handler
     {
     public:
-        MsearchHandler(ISsdpMsearchHandler* aHandler, TInt aId) : SsdpListenerMulticast::Handler(aId), iHandler(aHandler) {}
+        MsearchHandler(ISsdpMsearchHandler* aHandler, TInt aId) : SsdpListenerMulticast::Handler(aId), iHandler(aHandler), iIndexed(false) {}
         ISsdpMsearchHandler* Handler() { return iHandler; }
+        TBool Indexed() const { return iIndexed; }
+        void SetIndexed(TBool aIndexed) { iIndexed = aIndexed; }
+        std::vector<Brh*>& Keys() { return iKeys; }
     private:
         ISsdpMsearchHandler* iHandler;
+        TBool iIndexed;
+        std::vector<Brh*> iKeys; // index entries this handler is listed under
     };
     typedef std::vector<NotifyHandler*> VectorNotifyHandler;
     typedef std::vector<MsearchHandler*> VectorMsearchHandler;
+    class MsearchBucket
+    {
+    public:
+        MsearchBucket(const Brx& aKey) : iKey(aKey) {}
+        const Brx& Key() const { return iKey; }
+        VectorMsearchHandler& Handlers() { return iHandlers; }
+    private:
+        Brh iKey;
+        VectorMsearchHandler iHandlers;
+    };
+    typedef std::map<Brn, MsearchBucket*, BufferCmp> MapMsearchBucket;
 public:
     SsdpListenerMulticast(TIpAddress aInterface);
     virtual ~SsdpListenerMulticast();
@@ -115,19 +153,30 @@ public:
     TInt AddMsearchHandler(ISsdpMsearchHandler* aMsearchHandler);
     void RemoveNotifyHandler(TInt aHandlerId);
     void RemoveMsearchHandler(TInt aHandlerId);
+    /**
+     * Limit the searches passed to a handler to ssdp:all plus aTargets.
+     * Handlers which haven't set any targets are passed every search.
+     */
+    void SetMsearchTargets(TInt aHandlerId, const SsdpMsearchTargets& aTargets);
     TIpAddress Interface() const;
 private:
     void Run();
     void Terminated();
     void Notify(NotifyHandler& aHandler);
     void Notify(ISsdpNotifyHandler& aNotifyHandler);
+    TBool MsearchValid();
+    TBool MsearchKey(Bwx& aKey);
     void Msearch(MsearchHandler& aHandler);
     void Msearch(ISsdpMsearchHandler& aMsearchHandler);
+    void Unindex(MsearchHandler& aHandler);
     void EraseDisabled(VectorNotifyHandler& aVector);
     void EraseDisabled(VectorMsearchHandler& aVector);
 private:
     VectorNotifyHandler iNotifyHandlers;
     VectorMsearchHandler iMsearchHandlers;
+    VectorMsearchHandler iMsearchUnindexed;     // handlers which haven't set targets; passed every search
+    MapMsearchBucket iMsearchIndex;             // search target key -> handlers which respond to it
+    TUint iMsearchDisabledCount;
     OpenHome::Mutex iLock;
     TInt iNextHandlerId;
     TIpAddress iInterface;
@@ -264,7 +264,7 @@ void InitialisationParams::SetNumEventSessionThreads(uint32_t aNumThreads)
 
 void InitialisationParams::SetNumXmlFetcherThreads(uint32_t aNumThreads)
 {
-    ASSERT(aNumThreads > 0 && aNumThreads < 10);
+    ASSERT(aNumThreads > 0);
     iNumXmlFetcherThreads = aNumThreads;
 }
 
@@ -274,18 +274,35 @@ void InitialisationParams::SetNumActionInvokerThreads(uint32_t aNumThreads)
     iNumActionInvokerThreads = aNumThreads;
 }
 
+void InitialisationParams::SetMaxInvocationsPerDevice(uint32_t aMaxInvocations)
+{
+    iMaxInvocationsPerDevice = aMaxInvocations;
+}
+
 void InitialisationParams::SetNumInvocations(uint32_t aNumInvocations)
 {
     ASSERT(aNumInvocations > 0);
     iNumInvocations = aNumInvocations;
 }
 
+void InitialisationParams::SetInvocationTimeout(uint32_t aTimeoutMs)
+{
+    ASSERT(aTimeoutMs > 0);
+    iInvocationTimeoutMs = aTimeoutMs;
+}
+
 void InitialisationParams::SetNumSubscriberThreads(uint32_t aNumThreads)
 {
     ASSERT(aNumThreads > 0 && aNumThreads < 10);
     iNumSubscriberThreads = aNumThreads;
 }
 
+void InitialisationParams::SetNumTimerThreads(uint32_t aNumThreads)
+{
+    ASSERT(aNumThreads < 100);
+    iNumTimerThreads = aNumThreads;
+}
+
 void InitialisationParams::SetSubscriptionDuration(uint32_t aDurationSecs)
 {
     ASSERT(aDurationSecs > 0);
@@ -324,12 +341,27 @@ void InitialisationParams::SetDvNumServerThreads(uint32_t aNumThreads)
     iDvNumServerThreads = aNumThreads;
 }
 
+void InitialisationParams::SetMaxParkedConnections(uint32_t aMaxConnections)
+{
+    iMaxParkedConnections = aMaxConnections;
+}
+
 void InitialisationParams::SetDvNumPublisherThreads(uint32_t aNumThreads)
 {
     ASSERT(aNumThreads > 0 && aNumThreads < 100);
     iDvNumPublisherThreads = aNumThreads;
 }
 
+void InitialisationParams::SetDvPublisherCoalesceMs(uint32_t aMs)
+{
+    iDvPublisherCoalesceMs = aMs;
+}
+
+void InitialisationParams::SetDvEnableEventReactor(bool aEnable)
+{
+    iDvEnableEventReactor = aEnable;
+}
+
 void InitialisationParams::SetDvNumWebSocketThreads(uint32_t aNumThreads)
 {
     ASSERT(aNumThreads < 100);
@@ -341,6 +373,11 @@ void InitialisationParams::SetCpUpnpEventServerPort(TUint aPort)
     iCpUpnpEventServerPort = aPort;
 }
 
+void InitialisationParams::SetCpEnableInvocationReactor(bool aEnable)
+{
+    iCpEnableInvocationReactor = aEnable;
+}
+
 void InitialisationParams::SetDvUpnpServerPort(TUint aPort)
 {
     iDvUpnpWebServerPort = aPort;
@@ -431,16 +468,31 @@ uint32_t InitialisationParams::NumActionInvokerThreads() const
     return iNumActionInvokerThreads;
 }
 
+uint32_t InitialisationParams::MaxInvocationsPerDevice() const
+{
+    return iMaxInvocationsPerDevice;
+}
+
 uint32_t InitialisationParams::NumInvocations() const
 {
     return iNumInvocations;
 }
 
+uint32_t InitialisationParams::InvocationTimeoutMs() const
+{
+    return iInvocationTimeoutMs;
+}
+
 uint32_t InitialisationParams::NumSubscriberThreads() const
 {
     return iNumSubscriberThreads;
 }
 
+uint32_t InitialisationParams::NumTimerThreads() const
+{
+    return iNumTimerThreads;
+}
+
 uint32_t InitialisationParams::SubscriptionDurationSecs() const
 {
     return iSubscriptionDurationSecs;
@@ -471,11 +523,26 @@ uint32_t InitialisationParams::DvNumServerThreads() const
     return iDvNumServerThreads;
 }
 
+uint32_t InitialisationParams::MaxParkedConnections() const
+{
+    return iMaxParkedConnections;
+}
+
 uint32_t InitialisationParams::DvNumPublisherThreads() const
 {
     return iDvNumPublisherThreads;
 }
 
+uint32_t InitialisationParams::DvPublisherCoalesceMs() const
+{
+    return iDvPublisherCoalesceMs;
+}
+
+bool InitialisationParams::DvIsEventReactorEnabled() const
+{
+    return iDvEnableEventReactor;
+}
+
 uint32_t InitialisationParams::DvNumWebSocketThreads() const
 {
     return iDvNumWebSocketThreads;
@@ -486,6 +553,11 @@ uint32_t InitialisationParams::CpUpnpEventServerPort() const
     return iCpUpnpEventServerPort;
 }
 
+bool InitialisationParams::CpIsInvocationReactorEnabled() const
+{
+    return iCpEnableInvocationReactor;
+}
+
 uint32_t InitialisationParams::DvUpnpServerPort() const
 {
     if (iEnableBonjour) {
@@ -511,17 +583,24 @@ InitialisationParams::InitialisationParams()
     , iNumEventSessionThreads(4)
     , iNumXmlFetcherThreads(4)
     , iNumActionInvokerThreads(4)
+    , iMaxInvocationsPerDevice(0)
     , iNumInvocations(20)
+    , iInvocationTimeoutMs(60 * 1000)
     , iNumSubscriberThreads(4)
+    , iNumTimerThreads(0)
     , iSubscriptionDurationSecs(30 * 60)
     , iPendingSubscriptionTimeoutMs(2000)
     , iFreeExternal(NULL)
     , iUseLoopbackNetworkAdapter(ELoopbackExclude)
     , iDvMaxUpdateTimeSecs(1800)
     , iDvNumServerThreads(4)
+    , iMaxParkedConnections(256)
     , iDvNumPublisherThreads(4)
+    , iDvPublisherCoalesceMs(20)
+    , iDvEnableEventReactor(true)
     , iDvNumWebSocketThreads(0)
     , iCpUpnpEventServerPort(0)
+    , iCpEnableInvocationReactor(true)
     , iDvUpnpWebServerPort(0)
     , iDvWebSocketPort(0)
     , iEnableBonjour(false)
@@ -204,6 +204,8 @@ public:
      * device/service XML.
      * A higher number of threads will allow faster population of device lists
      * but will also require more system resources.
+     * At most two fetches run concurrently against any one host, reusing
+     * connections where the host supports http keep-alive.
      * Must be greater than zero.
      */
     void SetNumXmlFetcherThreads(uint32_t aNumThreads);
@@ -223,6 +225,21 @@ public:
      * Must be greater than zero.
      */
     void SetNumInvocations(uint32_t aNumInvocations);
+    /**
+     * Set how long a control point waits for a device to respond to an invocation.
+     * The default value is 60 seconds.  Must be greater than zero.
+     */
+    void SetInvocationTimeout(uint32_t aTimeoutMs);
+    /**
+     * Set the maximum number of invocations which may be in progress on any one device.
+     * Further invocations for that device wait in a per-device queue; devices with
+     * queued invocations are served in turn so that one slow device cannot occupy
+     * every invoker thread.
+     * The default value is zero, which means no limit; a device may then have as many
+     * invocations in progress as there are invoker threads (or as NumInvocations() when
+     * the invocation reactor is enabled).
+     */
+    void SetMaxInvocationsPerDevice(uint32_t aMaxInvocations);
     /**
      * Set the number of threads which should be dedicated to (un)subscribing
      * to state variables on a service + device.
@@ -230,6 +247,13 @@ public:
      * but will also require more system resources.
      */
     void SetNumSubscriberThreads(uint32_t aNumThreads);
+    /**
+     * Set the number of threads which should be dedicated to running timer callbacks.
+     * Zero (the default) runs all callbacks on a single timer thread so a slow callback
+     * delays all later timers.  A higher number bounds timer latency under load but
+     * allows callbacks for different timers to run concurrently.  Must be less than 100.
+     */
+    void SetNumTimerThreads(uint32_t aNumThreads);
     /**
      * Set the duration control point subscriptions will request.
      */
@@ -266,6 +290,14 @@ public:
      * making concurrent requests but will also require more system resources.
      */
     void SetDvNumServerThreads(uint32_t aNumThreads);
+    /**
+     * Set the maximum number of connections each tcp server (device control/eventing/presentation
+     * and control point eventing) will hold open while waiting for a complete request.
+     * Server threads are only assigned to connections once a full request header has arrived
+     * so this can be much higher than the number of server/event session threads.
+     * Set to 0 to dedicate a server thread to each connection for its whole lifetime.
+     */
+    void SetMaxParkedConnections(uint32_t aMaxConnections);
     /**
      * Set the number of threads which should be dedicated to publishing
      * changes to state variables on a service + device.
@@ -273,6 +305,19 @@ public:
      * but will also require more system resources.
      */
     void SetDvNumPublisherThreads(uint32_t aNumThreads);
+    /**
+     * Set the time to wait after a state variable changes before publishing it.
+     * Further changes made to a service during this window are sent to each subscriber
+     * in the same update.  0 publishes each change as soon as a publisher thread is free.
+     */
+    void SetDvPublisherCoalesceMs(uint32_t aMs);
+    /**
+     * Set whether the device stack should deliver UPnP events from a single reactor
+     * thread, which can have events to many subscribers in flight at once.  Publisher
+     * threads then only prepare events and never wait on the network.
+     * Enabled by default.  Ignored on platforms with no reactor support.
+     */
+    void SetDvEnableEventReactor(bool aEnable);
     /**
      * Set the number of threads which will be dedicated to published
      * changes to state variables via WebSockets
@@ -288,6 +333,13 @@ public:
      * requirements) running on a device.
      */ 
     void SetCpUpnpEventServerPort(TUint aPort);
+    /**
+     * Set whether the control point stack should run UPnP invocations on a single reactor
+     * thread, which can hold many in flight at once.  Action invoker threads then only
+     * run invocation completed callbacks.
+     * Enabled by default.  Ignored on platforms with no reactor support.
+     */
+    void SetCpEnableInvocationReactor(bool aEnable);
     /**
      * Set the tcp port number the device stack's UPnP web server will run on.
      * The default value is 0 (OS-assigned).
@@ -324,17 +376,24 @@ public:
     uint32_t NumEventSessionThreads() const;
     uint32_t NumXmlFetcherThreads() const;
     uint32_t NumActionInvokerThreads() const;
+    uint32_t MaxInvocationsPerDevice() const;
     uint32_t NumInvocations() const;
+    uint32_t InvocationTimeoutMs() const;
     uint32_t NumSubscriberThreads() const;
+    uint32_t NumTimerThreads() const;
     uint32_t SubscriptionDurationSecs() const;
     uint32_t PendingSubscriptionTimeoutMs() const;
     OhNetCallbackFreeExternal FreeExternal() const;
     ELoopback LoopbackNetworkAdapter() const;
     uint32_t DvMaxUpdateTimeSecs() const;
     uint32_t DvNumServerThreads() const;
+    uint32_t MaxParkedConnections() const;
     uint32_t DvNumPublisherThreads() const;
+    uint32_t DvPublisherCoalesceMs() const;
+    bool DvIsEventReactorEnabled() const;
     uint32_t DvNumWebSocketThreads() const;
     uint32_t CpUpnpEventServerPort() const;
+    bool CpIsInvocationReactorEnabled() const;
     uint32_t DvUpnpServerPort() const;
     uint32_t DvWebSocketPort() const;
     bool DvIsBonjourEnabled() const;
@@ -359,17 +418,24 @@ private:
     uint32_t iNumEventSessionThreads;
     uint32_t iNumXmlFetcherThreads;
     uint32_t iNumActionInvokerThreads;
+    uint32_t iMaxInvocationsPerDevice;
     uint32_t iNumInvocations;
+    uint32_t iInvocationTimeoutMs;
     uint32_t iNumSubscriberThreads;
+    uint32_t iNumTimerThreads;
     uint32_t iSubscriptionDurationSecs;
     uint32_t iPendingSubscriptionTimeoutMs;
     OhNetCallbackFreeExternal iFreeExternal;
     ELoopback iUseLoopbackNetworkAdapter;
     uint32_t iDvMaxUpdateTimeSecs;
     uint32_t iDvNumServerThreads;
+    uint32_t iMaxParkedConnections;
     uint32_t iDvNumPublisherThreads;
+    uint32_t iDvPublisherCoalesceMs;
+    bool iDvEnableEventReactor;
     uint32_t iDvNumWebSocketThreads;
     uint32_t iCpUpnpEventServerPort;
+    bool iCpEnableInvocationReactor;
     uint32_t iDvUpnpWebServerPort;
     uint32_t iDvWebSocketPort;
     bool iEnableBonjour;
@@ -0,0 +1,432 @@
+#include <OpenHome/Net/Private/ReactorHttp.h>
+#include <OpenHome/Private/Http.h>
+#include <OpenHome/Private/Ascii.h>
+#include <OpenHome/Private/Parser.h>
+#include <OpenHome/Private/Stream.h>
+#include <OpenHome/Net/Private/Stack.h>
+#include <OpenHome/Private/Debug.h>
+
+using namespace OpenHome;
+using namespace OpenHome::Net;
+
+// ReactorHttpExchange
+
+ReactorHttpExchange::ReactorHttpExchange()
+    : iSocket(NULL)
+    , iState(eIdle)
+    , iRegistered(false)
+    , iReused(false)
+    , iSent(0)
+    , iHeaderBytes(0)
+    , iChunked(false)
+    , iChunkOffset(0)
+    , iLastChunkRead(false)
+    , iContentLengthReceived(false)
+    , iContentLength(0)
+    , iDeadlineMs(0)
+{
+}
+
+ReactorHttpExchange::~ReactorHttpExchange()
+{
+}
+
+const Brx& ReactorHttpExchange::Response() const
+{
+    return iResponse;
+}
+
+TUint ReactorHttpExchange::HeaderBytes() const
+{
+    return iHeaderBytes;
+}
+
+TBool ReactorHttpExchange::Chunked() const
+{
+    return iChunked;
+}
+
+void ReactorHttpExchange::Connected()
+{
+}
+
+TBool ReactorHttpExchange::Retryable() const
+{
+    return true;
+}
+
+
+// ReactorHttpClient
+
+ReactorHttpClient::ReactorHttpClient(const TChar* aThreadName, TUint aMaxResponseBytes, EUnsizedResponse aUnsizedResponse)
+    : iThreadName(aThreadName)
+    , iMaxResponseBytes(aMaxResponseBytes)
+    , iUnsizedResponse(aUnsizedResponse)
+    , iThread(NULL)
+    , iLock("RHCL")
+    , iQuit(false)
+{
+}
+
+ReactorHttpClient::~ReactorHttpClient()
+{
+    ASSERT(iThread == NULL);
+}
+
+void ReactorHttpClient::Start()
+{
+    iThread = new ThreadFunctor(iThreadName, MakeFunctor(*this, &ReactorHttpClient::Run));
+    iThread->Start();
+}
+
+void ReactorHttpClient::Stop()
+{
+    iLock.Wait();
+    iQuit = true;
+    iLock.Signal();
+    iReactor.Interrupt();
+    delete iThread;
+    iThread = NULL;
+}
+
+void ReactorHttpClient::Wake()
+{
+    iReactor.Interrupt();
+}
+
+void ReactorHttpClient::Begin(ReactorHttpExchange& aExchange, const Endpoint& aEndpoint, const Brx& aRequest)
+{
+    aExchange.iEndpoint.Replace(aEndpoint);
+    aExchange.iRequest.Set(aRequest);
+    iActive.push_back(&aExchange);
+    Connect(aExchange);
+}
+
+void ReactorHttpClient::ContinueReceiving(ReactorHttpExchange& aExchange)
+{
+    Arm(aExchange, NetworkReactor::kReadable);
+}
+
+void ReactorHttpClient::End(ReactorHttpExchange& aExchange, TBool aReusable)
+{
+    if (aExchange.iRegistered) {
+        iReactor.Remove(*aExchange.iSocket);
+        aExchange.iRegistered = false;
+    }
+    if (aExchange.iSocket != NULL) {
+        aExchange.ReleaseConnection(aReusable);
+        aExchange.iSocket = NULL;
+    }
+    aExchange.iState = ReactorHttpExchange::eIdle;
+    for (TUint i=(TUint)iActive.size(); i>0; i--) {
+        if (iActive[i-1] == &aExchange) {
+            iActive.erase(iActive.begin() + i - 1);
+            break;
+        }
+    }
+}
+
+TUint ReactorHttpClient::ActiveCount() const
+{
+    return (TUint)iActive.size();
+}
+
+ReactorHttpExchange& ReactorHttpClient::Active(TUint aIndex) const
+{
+    return *iActive[aIndex];
+}
+
+void ReactorHttpClient::Run()
+{
+    NetworkReactor::Event events[kMaxEvents];
+    for (;;) {
+        iLock.Wait();
+        const TBool quit = iQuit;
+        iLock.Signal();
+        if (quit) {
+            break;
+        }
+
+        ProcessQueued();
+
+        const TUint now = Os::TimeInMs();
+        for (TUint i=(TUint)iActive.size(); i>0; i--) {
+            // iterate backwards as failed exchanges are removed from iActive
+            ReactorHttpExchange& exchange = *iActive[i-1];
+            if ((TInt)(now - exchange.iDeadlineMs) >= 0) {
+                ExchangeFailed(exchange, (exchange.iState == ReactorHttpExchange::eConnecting? eFailConnectTimeout : eFailTimeout));
+            }
+        }
+
+        TUint count = 0;
+        try {
+            count = iReactor.Wait(events, kMaxEvents, WaitTimeoutMs(now));
+        }
+        catch (NetworkError&) {
+            LOG2(kNetwork, kError, "ReactorHttpClient::Run - reactor wait failed\n");
+        }
+        for (TUint i=0; i<count; i++) {
+            ReactorHttpExchange& exchange = *(ReactorHttpExchange*)events[i].iArg;
+            if (exchange.iState == ReactorHttpExchange::eConnecting) {
+                try {
+                    exchange.iSocket->ConnectComplete();
+                }
+                catch (NetworkError&) {
+                    ExchangeFailed(exchange, eFailConnect);
+                    continue;
+                }
+                exchange.Connected();
+                Send(exchange);
+            }
+            else if (exchange.iState == ReactorHttpExchange::eSending) {
+                SendContinue(exchange);
+            }
+            else {
+                Receive(exchange);
+            }
+        }
+    }
+}
+
+void ReactorHttpClient::Connect(ReactorHttpExchange& aExchange)
+{
+    aExchange.iSocket = &aExchange.ClaimConnection(aExchange.iEndpoint, aExchange.iReused);
+    if (aExchange.iReused) {
+        Send(aExchange);
+        return;
+    }
+    TBool connected;
+    try {
+        connected = aExchange.iSocket->ConnectStart(aExchange.iEndpoint);
+    }
+    catch (NetworkError&) {
+        ExchangeFailed(aExchange, eFailConnect);
+        return;
+    }
+    if (connected) {
+        aExchange.Connected();
+        Send(aExchange);
+        return;
+    }
+    aExchange.iState = ReactorHttpExchange::eConnecting;
+    aExchange.iDeadlineMs = Os::TimeInMs() + Stack::InitParams().TcpConnectTimeoutMs();
+    Arm(aExchange, NetworkReactor::kWritable);
+}
+
+void ReactorHttpClient::Send(ReactorHttpExchange& aExchange)
+{
+    aExchange.iSent = 0;
+    aExchange.iDeadlineMs = Os::TimeInMs() + TimeoutMs();
+    SendContinue(aExchange);
+}
+
+void ReactorHttpClient::SendContinue(ReactorHttpExchange& aExchange)
+{
+    // never block the reactor thread; anything the socket can't take now is sent once it is writable again
+    try {
+        aExchange.iSent += aExchange.iSocket->WriteNonBlocking(aExchange.iRequest.Split(aExchange.iSent));
+    }
+    catch (WriterError&) {
+        if (aExchange.iReused && aExchange.Retryable()) {
+            Retry(aExchange);
+        }
+        else {
+            ExchangeFailed(aExchange, eFailWrite);
+        }
+        return;
+    }
+    if (aExchange.iSent < aExchange.iRequest.Bytes()) {
+        aExchange.iState = ReactorHttpExchange::eSending;
+        Arm(aExchange, NetworkReactor::kWritable);
+        return;
+    }
+    aExchange.iState = ReactorHttpExchange::eReceiving;
+    aExchange.iResponse.SetBytes(0);
+    aExchange.iHeaderBytes = 0;
+    aExchange.iChunked = false;
+    aExchange.iChunkOffset = 0;
+    aExchange.iLastChunkRead = false;
+    aExchange.iContentLengthReceived = false;
+    aExchange.iContentLength = 0;
+    aExchange.iDeadlineMs = Os::TimeInMs() + TimeoutMs();
+    Arm(aExchange, NetworkReactor::kReadable);
+}
+
+void ReactorHttpClient::Receive(ReactorHttpExchange& aExchange)
+{
+    TBool closed = false;
+    try {
+        aExchange.iSocket->Read(iReadBuffer);
+        Bwh& response = aExchange.iResponse;
+        const TUint bytes = response.Bytes() + iReadBuffer.Bytes();
+        if (iMaxResponseBytes != 0 && bytes > iMaxResponseBytes) {
+            ExchangeFailed(aExchange, eFailResponseTooLong);
+            return;
+        }
+        if (bytes > response.MaxBytes()) {
+            TUint maxBytes = 2 * response.MaxBytes();
+            if (maxBytes < bytes) {
+                maxBytes = bytes;
+            }
+            if (iMaxResponseBytes != 0 && maxBytes > iMaxResponseBytes) {
+                maxBytes = iMaxResponseBytes;
+            }
+            response.Grow(maxBytes);
+        }
+        response.Append(iReadBuffer);
+    }
+    catch (ReaderError&) {
+        closed = true;
+    }
+    if (closed && aExchange.iReused && aExchange.iResponse.Bytes() == 0 && aExchange.Retryable()) {
+        /* The peer closed a keep-alive connection while it was idle.  Nothing has been
+           read back so assume the request wasn't processed and retry on another connection. */
+        LOG(kNetwork, "ReactorHttpClient - stale connection, retrying\n");
+        Retry(aExchange);
+        return;
+    }
+    if (!ResponseComplete(aExchange, closed)) {
+        Arm(aExchange, NetworkReactor::kReadable);
+        return;
+    }
+    ResponseReceived(aExchange, closed);
+}
+
+TBool ReactorHttpClient::ResponseComplete(ReactorHttpExchange& aExchange, TBool aClosed) const
+{
+    const Brx& response = aExchange.iResponse;
+    if (aExchange.iHeaderBytes == 0) {
+        const TUint bytes = response.Bytes();
+        for (TUint i=0; i<bytes; i++) {
+            if (response[i] != Ascii::kLf) {
+                continue;
+            }
+            if (i+1 < bytes && response[i+1] == Ascii::kLf) {
+                aExchange.iHeaderBytes = i + 2;
+                break;
+            }
+            if (i+2 < bytes && response[i+1] == Ascii::kCr && response[i+2] == Ascii::kLf) {
+                aExchange.iHeaderBytes = i + 3;
+                break;
+            }
+        }
+        if (aExchange.iHeaderBytes == 0) {
+            return aClosed;
+        }
+        ReaderBuffer reader(response.Split(0, aExchange.iHeaderBytes));
+        ReaderHttpResponse readerResponse(reader);
+        HttpHeaderContentLength headerContentLength;
+        HttpHeaderTransferEncoding headerTransferEncoding;
+        readerResponse.AddHeader(headerContentLength);
+        readerResponse.AddHeader(headerTransferEncoding);
+        try {
+            readerResponse.Read();
+        }
+        catch (Exception&) {
+            return true; // malformed; let ResponseReceived() report the error
+        }
+        aExchange.iChunked = headerTransferEncoding.IsChunked();
+        aExchange.iChunkOffset = aExchange.iHeaderBytes;
+        aExchange.iContentLengthReceived = headerContentLength.Received();
+        aExchange.iContentLength = headerContentLength.ContentLength();
+    }
+    if (aClosed) {
+        return true;
+    }
+    if (aExchange.iChunked) {
+        return ChunkedBodyComplete(aExchange);
+    }
+    if (aExchange.iContentLengthReceived) {
+        return (response.Bytes() - aExchange.iHeaderBytes >= aExchange.iContentLength);
+    }
+    return (iUnsizedResponse == eEndAtHeaders);
+}
+
+TBool ReactorHttpClient::ChunkedBodyComplete(ReactorHttpExchange& aExchange)
+{
+    // Walk the chunks received so far, remembering where we got to so that each byte of a
+    // long response is only looked at once.  The body ends with a zero length chunk,
+    // optionally followed by trailers, then a blank line.
+    const Brx& response = aExchange.iResponse;
+    const TUint bytes = response.Bytes();
+    for (;;) {
+        TUint lineEnd = aExchange.iChunkOffset;
+        while (lineEnd < bytes && response[lineEnd] != Ascii::kLf) {
+            lineEnd++;
+        }
+        if (lineEnd == bytes) {
+            return false;
+        }
+        Parser parser(response.Split(aExchange.iChunkOffset, lineEnd - aExchange.iChunkOffset));
+        Brn line = parser.Next(Ascii::kCr);
+        if (aExchange.iLastChunkRead) {
+            if (line.Bytes() == 0) {
+                return true;
+            }
+            aExchange.iChunkOffset = lineEnd + 1; // skip trailer
+            continue;
+        }
+        Parser lineParser(line);
+        Brn size = lineParser.Next(';'); // ignore any chunk extensions
+        TUint chunkBytes;
+        try {
+            chunkBytes = Ascii::UintHex(size);
+        }
+        catch (AsciiError&) {
+            return true; // malformed; let ResponseReceived() report the error
+        }
+        if (chunkBytes == 0) {
+            aExchange.iLastChunkRead = true;
+            aExchange.iChunkOffset = lineEnd + 1;
+            continue;
+        }
+        const TUint dataStart = lineEnd + 1;
+        const TUint kChunkTerminatorBytes = 2; // CRLF following the chunk's data
+        if (chunkBytes > bytes - dataStart || bytes - dataStart - chunkBytes < kChunkTerminatorBytes) {
+            return false;
+        }
+        aExchange.iChunkOffset = dataStart + chunkBytes + kChunkTerminatorBytes;
+    }
+}
+
+void ReactorHttpClient::Retry(ReactorHttpExchange& aExchange)
+{
+    if (aExchange.iRegistered) {
+        iReactor.Remove(*aExchange.iSocket);
+        aExchange.iRegistered = false;
+    }
+    aExchange.ReleaseConnection(false);
+    aExchange.iSocket = NULL;
+    Connect(aExchange);
+}
+
+void ReactorHttpClient::Arm(ReactorHttpExchange& aExchange, TUint aReadiness)
+{
+    try {
+        if (aExchange.iRegistered) {
+            iReactor.Rearm(*aExchange.iSocket, aReadiness, &aExchange);
+        }
+        else {
+            iReactor.Add(*aExchange.iSocket, aReadiness, &aExchange);
+            aExchange.iRegistered = true;
+        }
+    }
+    catch (NetworkError&) {
+        ExchangeFailed(aExchange, eFailNetwork);
+    }
+}
+
+TUint ReactorHttpClient::WaitTimeoutMs(TUint aTimeNowMs) const
+{
+    TUint timeoutMs = 0; // wait indefinitely
+    for (TUint i=0; i<(TUint)iActive.size(); i++) {
+        TUint remaining = iActive[i]->iDeadlineMs - aTimeNowMs;
+        if (remaining == 0) {
+            remaining = 1;
+        }
+        if (timeoutMs == 0 || remaining < timeoutMs) {
+            timeoutMs = remaining;
+        }
+    }
+    return timeoutMs;
+}
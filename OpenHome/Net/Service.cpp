@@ -606,20 +606,73 @@ OpenHome::Net::ServiceType::ServiceType(const TChar* aDomain, const TChar* aName
     , iName(aName)
     , iVersion(aVersion)
 {
+    Construct();
 }
 
 OpenHome::Net::ServiceType::ServiceType(const ServiceType& aServiceType)
     : iVersion(aServiceType.iVersion)
-    , iFullName(aServiceType.FullName())
 {
     iDomain.Set(aServiceType.iDomain);
     iName.Set(aServiceType.iName);
+    Construct();
 }
 
 OpenHome::Net::ServiceType::~ServiceType()
 {
 }
 
+void OpenHome::Net::ServiceType::Construct()
+{
+    // All derived names are built up front so that the (const) accessors, some of which
+    // are called for every incoming request, can be used from any thread without locking
+    TInt len = kUrn.Bytes() + iDomain.Bytes() + kService.Bytes() +
+                   iName.Bytes() + 1 + Ascii::kMaxUintStringBytes + 1;
+    iFullName.Grow(len);
+    iFullName.Append(kUrn);
+    iFullName.Append(iDomain);
+    iFullName.Append(kService);
+    iFullName.Append(iName);
+    iFullName.Append(':');
+    Ascii::AppendDec(iFullName, iVersion);
+    iFullName.PtrZ();
+
+    Bwh upnpDomain(iDomain.Bytes() + 10);
+    Ssdp::CanonicalDomainToUpnp(iDomain, upnpDomain);
+    len = kUrn.Bytes() + upnpDomain.Bytes() + kService.Bytes() +
+              iName.Bytes() + 1 + Ascii::kMaxUintStringBytes + 1;
+    iServiceType.Grow(len);
+    iServiceType.Append(kUrn);
+    iServiceType.Append(upnpDomain);
+    iServiceType.Append(kService);
+    iServiceType.Append(iName);
+    iServiceType.Append(':');
+    Ascii::AppendDec(iServiceType, iVersion);
+    iServiceType.PtrZ();
+
+    len = iDomain.Bytes() + 1 + iName.Bytes() + 1 + Ascii::kMaxUintStringBytes + 1;
+    iPathUpnp.Grow(len);
+    iPathUpnp.Append(iDomain);
+    iPathUpnp.Append('-');
+    iPathUpnp.Append(iName);
+    iPathUpnp.Append('-');
+    Ascii::AppendDec(iPathUpnp, iVersion);
+    iPathUpnp.PtrZ();
+
+    Bwh domain(iDomain);
+    for (TUint i=0; i<domain.Bytes(); i++) {
+        if (domain[i] == '.') {
+            domain[i] = '-';
+        }
+    }
+    len = kUrn.Bytes() + domain.Bytes() + kServiceId.Bytes() + iName.Bytes() + 1;
+    iServiceId.Grow(len);
+    iServiceId.Append(kUrn);
+    iServiceId.Append(domain);
+    iServiceId.Append(kServiceId);
+    iServiceId.Append(iName);
+    iServiceId.PtrZ();
+}
+
 const Brx& OpenHome::Net::ServiceType::Domain() const
 {
     return iDomain;
@@ -637,80 +690,21 @@ TUint OpenHome::Net::ServiceType::Version() const
 
 const Brx& OpenHome::Net::ServiceType::FullName() const
 {
-    Stack::Mutex().Wait();
-    if (iFullName.Bytes() == 0) {
-        const TInt len = kUrn.Bytes() + iDomain.Bytes() + kService.Bytes() +
-                             iName.Bytes() + 1 + Ascii::kMaxUintStringBytes + 1;
-        iFullName.Grow(len);
-        iFullName.Append(kUrn);
-        iFullName.Append(iDomain);
-        iFullName.Append(kService);
-        iFullName.Append(iName);
-        iFullName.Append(':');
-        Ascii::AppendDec(iFullName, iVersion);
-        iFullName.PtrZ();
-    }
-    Stack::Mutex().Signal();
     return iFullName;
 }
 
 const Brx& OpenHome::Net::ServiceType::FullNameUpnp() const
 {
-    Stack::Mutex().Wait();
-    if (iServiceType.Bytes() == 0) {
-        Bwh upnpDomain(iDomain.Bytes() + 10);
-        Ssdp::CanonicalDomainToUpnp(iDomain, upnpDomain);
-        const TInt len = kUrn.Bytes() + upnpDomain.Bytes() + kService.Bytes() +
-                            iName.Bytes() + 1 + Ascii::kMaxUintStringBytes + 1;
-        iServiceType.Grow(len);
-        iServiceType.Append(kUrn);
-        iServiceType.Append(upnpDomain);
-        iServiceType.Append(kService);
-        iServiceType.Append(iName);
-        iServiceType.Append(':');
-        Ascii::AppendDec(iServiceType, iVersion);
-        iServiceType.PtrZ();
-    }
-    Stack::Mutex().Signal();
     return iServiceType;
 }
 
 const Brx& OpenHome::Net::ServiceType::PathUpnp() const
 {
-    Stack::Mutex().Wait();
-    if (iPathUpnp.Bytes() == 0) {
-        const TInt len = iDomain.Bytes() + 1 + iName.Bytes() + 1 + Ascii::kMaxUintStringBytes + 1;
-        iPathUpnp.Grow(len);
-        iPathUpnp.Append(iDomain);
-        iPathUpnp.Append('-');
-        iPathUpnp.Append(iName);
-        iPathUpnp.Append('-');
-        Ascii::AppendDec(iPathUpnp, iVersion);
-        iPathUpnp.PtrZ();
-    }
-    Stack::Mutex().Signal();
     return iPathUpnp;
 }
 
 const Brx& OpenHome::Net::ServiceType::ServiceId() const
 {
-    Stack::Mutex().Wait();
-    if (iServiceId.Bytes() == 0) {
-        Bwh domain(iDomain);
-        for (TUint i=0; i<domain.Bytes(); i++) {
-            if (domain[i] == '.') {
-                domain[i] = '-';
-            }
-        }
-        const TInt len = kUrn.Bytes() + domain.Bytes() + kServiceId.Bytes() + iName.Bytes() + 1;
-        iServiceId.Grow(len);
-        iServiceId.Append(kUrn);
-        iServiceId.Append(domain);
-        iServiceId.Append(kServiceId);
-        iServiceId.Append(iName);
-        iServiceId.PtrZ();
-    }
-    Stack::Mutex().Signal();
     return iServiceId;
 }
 
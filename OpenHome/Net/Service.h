@@ -178,6 +178,13 @@ public:
     virtual void PropertyWriteBool(const Brx& aName, TBool aValue) = 0;
     virtual void PropertyWriteBinary(const Brx& aName, const Brx& aValue) = 0;
     virtual void PropertyWriteEnd() = 0;
+    /**
+     * Writers which can accept a set of <e:property> elements that has already been
+     * encoded (and is shared between all subscribers with the same pending changes)
+     * return true.  Others are only passed values via the PropertyWrite* functions above.
+     */
+    virtual TBool SupportsEncodedProperties() const = 0;
+    virtual void PropertyWriteEncoded(const Brx& aProperties) = 0;
     virtual ~IPropertyWriter() {}
 };
 
@@ -349,6 +356,7 @@ public:
     const Brx& ServiceId() const; // serviceId tag from device xml
 private:
     void operator=(const ServiceType &);
+    void Construct();
     static const Brn kUrn;
     static const Brn kService;
     static const Brn kServiceId;
@@ -356,10 +364,10 @@ private:
     Brh iDomain;
     Brh iName;
     TUint iVersion;
-    mutable Bwh iFullName;
-    mutable Bwh iServiceType;
-    mutable Bwh iPathUpnp;
-    mutable Bwh iServiceId;
+    Bwh iFullName;
+    Bwh iServiceType;
+    Bwh iPathUpnp;
+    Bwh iServiceId;
 };
 
 /**
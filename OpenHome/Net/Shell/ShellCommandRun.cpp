@@ -19,6 +19,9 @@ static void RunTestQueue(const std::vector<Brn>& /*aArgs*/) { TestQueue(); }
 extern void TestTextUtils();
 static void RunTestTextUtils(const std::vector<Brn>& /*aArgs*/) { TestTextUtils(); }
 
+extern void TestDeflate();
+static void RunTestDeflate(const std::vector<Brn>& /*aArgs*/) { TestDeflate(); }
+
 extern void TestNetwork(const std::vector<Brn>& aArgs);
 static void RunTestNetwork(const std::vector<Brn>& aArgs) { TestNetwork(aArgs); }
 
@@ -70,6 +73,7 @@ ShellCommandRun::ShellCommandRun(Shell& aShell)
     AddTest("TestFifo", RunTestFifo);
     AddTest("TestQueue", RunTestQueue);
     AddTest("TestTextUtils", RunTestTextUtils);
+    AddTest("TestDeflate", RunTestDeflate);
     AddTest("TestNetwork", RunTestNetwork, true);
     AddTest("TestTimer", RunTestTimer);
     AddTest("TestSsdpMListen", RunTestSsdpMListen, true);
@@ -62,7 +62,7 @@ Stack::Stack(InitialisationParams* aInitParams)
     gStack = this;
     gStackInitCount++;
     SetRandomSeed((TUint)(time(NULL) % UINT32_MAX));
-    iTimerManager = new OpenHome::TimerManager();
+    iTimerManager = new OpenHome::TimerManager(iInitParams->NumTimerThreads());
     iNetworkAdapterList = new OpenHome::NetworkAdapterList(0);
     Functor& subnetListChangeListener = iInitParams->SubnetListChangedListener();
     if (subnetListChangeListener) {
@@ -170,12 +170,7 @@ void Stack::MulticastListenerRelease(TIpAddress aInterface)
 
 TUint Stack::SequenceNumber()
 {
-    TUint seq;
-    OpenHome::Mutex& lock = Stack::Mutex();
-    lock.Wait();
-    seq = gStack->iSequenceNumber++;
-    lock.Signal();
-    return seq;
+    return (TUint)(gStack->iSequenceNumber.Inc() - 1);
 }
 
 InitialisationParams& Stack::InitParams()
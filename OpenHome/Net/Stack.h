@@ -81,7 +81,7 @@ private:
     OpenHome::NetworkAdapterList* iNetworkAdapterList;
     typedef std::vector<MListener*> MulticastListeners;
     MulticastListeners iMulticastListeners;
-    TUint iSequenceNumber;
+    AtomicInt iSequenceNumber;
     IStack* iCpStack;
     IStack* iDvStack;
     typedef std::map<IStackObject*,IStackObject*> ObjectMap;
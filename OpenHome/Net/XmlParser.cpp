@@ -190,3 +190,97 @@ Brn XmlParserBasic::FindAttribute(const Brx& aTag, const Brx& aAttribute, const
         doc.Set(remaining);
     }
 }
+
+
+// XmlParserChildIndex
+
+XmlParserChildIndex::Child::Child(const Brx& aName, const Brx& aValue)
+    : iName(aName)
+    , iValue(aValue)
+{
+}
+
+XmlParserChildIndex::XmlParserChildIndex()
+    : iNext(0)
+{
+}
+
+void XmlParserChildIndex::Set(const Brx& aDocument)
+{
+    Clear();
+    Brn name;
+    Brn attributes;
+    Brn ns;
+    TUint index;
+    Brn childName;
+    Brn childNs;
+    Brn childStart;
+    TInt depth = 0;
+    XmlParserBasic::ETagType tagType;
+    Brn doc(Ascii::Trim(aDocument));
+    Brn remaining;
+    while (doc.Bytes() > 0) {
+        XmlParserBasic::NextTag(doc, name, attributes, ns, index, remaining, tagType);
+        if (tagType == XmlParserBasic::eTagOpen) {
+            if (depth++ == 0) {
+                childName.Set(name);
+                childNs.Set(ns);
+                childStart.Set(remaining);
+            }
+        }
+        else if (tagType == XmlParserBasic::eTagClose) {
+            if (--depth < 0) {
+                THROW(XmlError);
+            }
+            if (depth == 0) {
+                if (name != childName || ns != childNs) {
+                    THROW(XmlError);
+                }
+                const TUint valueBytes = (TUint)(doc.Ptr() - childStart.Ptr()) + index;
+                iChildren.push_back(Child(childName, Brn(childStart.Ptr(), valueBytes)));
+            }
+        }
+        else if (depth == 0) { // eTagOpenClose
+            iChildren.push_back(Child(name, Brx::Empty()));
+        }
+        doc.Set(Ascii::Trim(remaining));
+    }
+    if (depth != 0) {
+        THROW(XmlError);
+    }
+}
+
+void XmlParserChildIndex::Clear()
+{
+    iChildren.clear();
+    iNext = 0;
+}
+
+TUint XmlParserChildIndex::Count() const
+{
+    return (TUint)iChildren.size();
+}
+
+Brn XmlParserChildIndex::Find(const TChar* aTag)
+{
+    Brn tag(aTag);
+    return Find(tag);
+}
+
+Brn XmlParserChildIndex::Find(const Brx& aTag)
+{
+    // start looking after the last child found so that in-order lookups match first time
+    const TUint count = (TUint)iChildren.size();
+    TUint i = iNext;
+    for (TUint checked=0; checked<count; checked++) {
+        if (i >= count) {
+            i = 0;
+        }
+        if (Ascii::CaseInsensitiveEquals(iChildren[i].iName, aTag)) {
+            iNext = i + 1;
+            return iChildren[i].iValue;
+        }
+        i++;
+    }
+    THROW(XmlError);
+}
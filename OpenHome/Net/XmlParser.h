@@ -5,6 +5,8 @@
 #include <OpenHome/OhNetTypes.h>
 #include <OpenHome/Exception.h>
 
+#include <vector>
+
 EXCEPTION(XmlError);
 
 namespace OpenHome {
@@ -17,6 +19,7 @@ namespace Net {
  */
 class XmlParserBasic
 {
+    friend class XmlParserChildIndex;
 public:
     static Brn Find(const TChar* aTag, const Brx& aDocument);
     static Brn Find(const Brx& aTag, const Brx& aDocument);
@@ -41,6 +44,37 @@ private:
     static void NextTag(const Brx& aDocument, Brn& aName, Brn& aAttributes, Brn& aNamespace, TUint& aIndex, Brn& aRemaining, ETagType& aType);
 };
 
+/**
+ * Indexes the direct child elements of a document (e.g. the arguments inside a soap action
+ * element) in a single pass.
+ *
+ * Each child's name and contents can then be looked up without rescanning the document.
+ * Lookups in document order (the order generated code reads arguments in) are O(1).
+ * Returned values point into the indexed document, which must outlive any use of them.
+ */
+class XmlParserChildIndex
+{
+public:
+    XmlParserChildIndex();
+    void Set(const Brx& aDocument); // throws XmlError
+    void Clear();
+    TUint Count() const;
+    Brn Find(const TChar* aTag); // throws XmlError if aTag isn't a child
+    Brn Find(const Brx& aTag);
+private:
+    class Child
+    {
+    public:
+        Child(const Brx& aName, const Brx& aValue);
+    public:
+        Brn iName;
+        Brn iValue;
+    };
+private:
+    std::vector<Child> iChildren;
+    TUint iNext;
+};
+
 } // namespace Net
 } // namespace OpenHome
 
@@ -8,6 +8,7 @@
 #include <OpenHome/Private/Ascii.h>
 
 #include <errno.h>
+#include <string.h>
 
 using namespace OpenHome;
 
@@ -232,6 +233,28 @@ void Socket::Send(const Brx& aBuffer)
     }
 }
 
+TUint Socket::SendNonBlocking(const Brx& aBuffer)
+{
+    LOGF(kNetwork, "Socket::SendNonBlocking  H = %d, BC = %d\n", iHandle, aBuffer.Bytes());
+    TUint sent = OpenHome::Os::NetworkSendNonBlocking(iHandle, aBuffer);
+    Log("Socket::SendNonBlocking, sent\n", aBuffer.Split(0, sent));
+    return sent;
+}
+
+void Socket::SendFile(TInt aFile, TUint64 aOffset, TUint aBytes)
+{
+    LOGF(kNetwork, "Socket::SendFile  H = %d, F = %d, BC = %u\n", iHandle, aFile, aBytes);
+    TInt sent = OpenHome::Os::NetworkSendFile(iHandle, aFile, aOffset, aBytes);
+    if(sent < 0) {
+        LOG2F(kNetwork, kError, "Socket::SendFile H = %d, RETURN VALUE = %d\n", iHandle, sent);
+        THROW(NetworkError);
+    }
+    if((TUint)sent != aBytes) {
+        LOG2F(kNetwork, kError, "Socket::SendFile H = %d, RETURN VALUE = %d, INCOMPLETE\n", iHandle, sent);
+        THROW(NetworkError);
+    }
+}
+
 void Socket::SendTo(const Brx& aBuffer, const Endpoint& aEndpoint)
 {
     LOGF(kNetwork, "Socket::SendTo  H = %d, BC = %d, E = %x:%d\n", iHandle, aBuffer.Bytes(), aEndpoint.Address(), aEndpoint.Port());
@@ -350,6 +373,14 @@ THandle Socket::Accept()
     return handle;
 }
 
+THandle Socket::AcceptNonBlocking()
+{
+    LOGF(kNetwork, "Socket::AcceptNonBlocking H = %d\n", iHandle);
+    THandle handle = OpenHome::Os::NetworkAcceptNonBlocking(iHandle);
+    LOGF(kNetwork,"Socket::AcceptNonBlocking Accepted Handle = %d\n", handle);
+    return handle;
+}
+
 void Socket::Log(const char* aPrefix, const Brx& aBuffer)
 {
     if (iLog == kLogNone) {
@@ -432,6 +463,17 @@ void SocketTcp::WriteFlush()
     // all writes go directly to the socket so nothing to flush
 }
 
+TUint SocketTcp::WriteNonBlocking(const Brx& aBuffer)
+{
+    LOGF(kNetwork, "SocketTcp::WriteNonBlocking\n");
+    try {
+        return SendNonBlocking(aBuffer);
+    }
+    catch(NetworkError&) {
+        THROW(WriterError);
+    }
+}
+
 void SocketTcp::Read(Bwx& aBuffer)
 {
     LOGF(kNetwork, ">SocketTcp::Read\n");
@@ -488,6 +530,51 @@ static void TryNetworkTcpSetNoDelay(THandle aHandle)
     }
 }
 
+// NetworkReactor
+
+NetworkReactor::NetworkReactor()
+{
+    iHandle = OpenHome::Os::NetworkReactorCreate();
+    if (iHandle == kHandleNull) {
+        THROW(NetworkError);
+    }
+}
+
+NetworkReactor::~NetworkReactor()
+{
+    OpenHome::Os::NetworkReactorDestroy(iHandle);
+}
+
+void NetworkReactor::Add(Socket& aSocket, TUint aReadiness, void* aArg)
+{
+    LOGF(kNetwork, "NetworkReactor::Add H = %d\n", aSocket.iHandle);
+    OpenHome::Os::NetworkReactorAdd(iHandle, aSocket.iHandle, aReadiness, aArg);
+}
+
+void NetworkReactor::Rearm(Socket& aSocket, TUint aReadiness, void* aArg)
+{
+    OpenHome::Os::NetworkReactorRearm(iHandle, aSocket.iHandle, aReadiness, aArg);
+}
+
+void NetworkReactor::Remove(Socket& aSocket)
+{
+    LOGF(kNetwork, "NetworkReactor::Remove H = %d\n", aSocket.iHandle);
+    (void)OpenHome::Os::NetworkReactorRemove(iHandle, aSocket.iHandle);
+}
+
+TUint NetworkReactor::Wait(Event* aEvents, TUint aMaxEvents, TUint aTimeoutMs)
+{
+    return OpenHome::Os::NetworkReactorWait(iHandle, aEvents, aMaxEvents, aTimeoutMs);
+}
+
+void NetworkReactor::Interrupt()
+{
+    TInt err = OpenHome::Os::NetworkReactorInterrupt(iHandle);
+    if (err != 0) {
+        LOG2F(kNetwork, kError, "NetworkReactor::Interrupt RETURN VALUE = %d\n", err);
+    }
+}
+
 // Tcp client
 
 void SocketTcpClient::Open()
@@ -503,6 +590,200 @@ void SocketTcpClient::Connect(const Endpoint& aEndpoint, TUint aTimeout)
     OpenHome::Os::NetworkConnect(iHandle, aEndpoint, aTimeout);
 }
 
+TBool SocketTcpClient::ConnectStart(const Endpoint& aEndpoint)
+{
+    LOGF(kNetwork, "SocketTcpClient::ConnectStart\n");
+    return OpenHome::Os::NetworkConnectStart(iHandle, aEndpoint);
+}
+
+void SocketTcpClient::ConnectComplete()
+{
+    LOGF(kNetwork, "SocketTcpClient::ConnectComplete\n");
+    OpenHome::Os::NetworkConnectComplete(iHandle);
+}
+
+// SocketTcpReader
+
+SocketTcpReader::SocketTcpReader(SocketTcp& aSocket)
+    : iSocket(aSocket)
+    , iReceived(false)
+    , iClosed(false)
+    , iInterrupted(false)
+{
+}
+
+TBool SocketTcpReader::ClosedBeforeData() const
+{
+    return (iClosed && !iReceived && !iInterrupted);
+}
+
+void SocketTcpReader::Read(Bwx& aBuffer)
+{
+    try {
+        iSocket.Read(aBuffer);
+    }
+    catch (ReaderError&) {
+        iClosed = true;
+        throw;
+    }
+    iReceived = true;
+}
+
+void SocketTcpReader::ReadFlush()
+{
+    iReceived = false;
+    iClosed = false;
+    iInterrupted = false;
+    iSocket.ReadFlush();
+}
+
+void SocketTcpReader::ReadInterrupt()
+{
+    iInterrupted = true; // set before interrupting so a reader failing as a result will see it
+    iSocket.ReadInterrupt();
+}
+
+// SocketTcpParked
+
+namespace OpenHome {
+
+// Connection accepted by a parking SocketTcpServer but not yet passed to a session
+class SocketTcpParked : public Socket
+{
+public:
+    enum EState
+    {
+        eFree
+       ,eReturned // kept alive by a session, not yet added to the reactor
+       ,eParked
+       ,eReady
+    };
+    enum EReadResult
+    {
+        eReadIncomplete
+       ,eReadComplete
+       ,eReadClosed
+    };
+public:
+    SocketTcpParked();
+    ~SocketTcpParked();
+    void Open(THandle aHandle, TUint aTimeMs);
+    void Resume(THandle aHandle, const Brx& aPending); // take back a connection kept alive by a session
+    void SetParked(TUint aTimeMs);
+    EReadResult Read(const Brx& aRequestTerminator);
+    TBool RequestComplete(const Brx& aRequestTerminator) const;
+    void Release(); // close the connection
+    THandle TransferTo(Bwx& aPrefetch); // pass ownership of the connection on
+    const Brx& Prefetched() const { return iBuffer; }
+    EState State() const { return iState; }
+    void SetState(EState aState) { iState = aState; }
+    TUint ParkedTimeMs() const { return iParkedTimeMs; }
+private:
+    TBool Contains(const Brx& aRequestTerminator, TUint aFrom) const;
+private:
+    Bwh iBuffer;
+    EState iState;
+    TUint iParkedTimeMs;
+};
+
+} // namespace OpenHome
+
+SocketTcpParked::SocketTcpParked()
+    : iBuffer(SocketTcpServer::kMaxPrefetchBytes)
+    , iState(eFree)
+    , iParkedTimeMs(0)
+{
+}
+
+SocketTcpParked::~SocketTcpParked()
+{
+    Release();
+}
+
+void SocketTcpParked::Open(THandle aHandle, TUint aTimeMs)
+{
+    iHandle = aHandle;
+    iParkedTimeMs = aTimeMs;
+    iBuffer.SetBytes(0);
+    iState = eParked;
+}
+
+void SocketTcpParked::Resume(THandle aHandle, const Brx& aPending)
+{
+    iHandle = aHandle;
+    iBuffer.Replace(aPending);
+    iState = eReturned;
+}
+
+void SocketTcpParked::SetParked(TUint aTimeMs)
+{
+    iParkedTimeMs = aTimeMs;
+    iState = eParked;
+}
+
+SocketTcpParked::EReadResult SocketTcpParked::Read(const Brx& aRequestTerminator)
+{
+    const TUint prevBytes = iBuffer.Bytes();
+    Bwn space(iBuffer.Ptr() + prevBytes, iBuffer.MaxBytes() - prevBytes);
+    try {
+        Socket::Receive(space);
+    }
+    catch (NetworkError&) {
+        return eReadClosed;
+    }
+    if (space.Bytes() == 0) {
+        return eReadClosed;
+    }
+    iBuffer.SetBytes(prevBytes + space.Bytes());
+    if (iBuffer.Bytes() == iBuffer.MaxBytes()) {
+        return eReadComplete; // let the session decide what to do with an over-long request
+    }
+
+    // only search the bytes just received, plus enough earlier ones to catch a terminator split across reads
+    const TUint termBytes = aRequestTerminator.Bytes();
+    return (Contains(aRequestTerminator, prevBytes >= termBytes? prevBytes - termBytes + 1 : 0)? eReadComplete : eReadIncomplete);
+}
+
+TBool SocketTcpParked::RequestComplete(const Brx& aRequestTerminator) const
+{
+    return (iBuffer.Bytes() == iBuffer.MaxBytes() || Contains(aRequestTerminator, 0));
+}
+
+TBool SocketTcpParked::Contains(const Brx& aRequestTerminator, TUint aFrom) const
+{
+    const TUint termBytes = aRequestTerminator.Bytes();
+    const TByte* ptr = iBuffer.Ptr();
+    const TUint bytes = iBuffer.Bytes();
+    for (TUint start = aFrom; start + termBytes <= bytes; start++) {
+        if (Brn(ptr + start, termBytes) == aRequestTerminator) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SocketTcpParked::Release()
+{
+    if (iHandle != kHandleNull) {
+        try {
+            Close();
+        }
+        catch (NetworkError&) {
+            LOG2F(kNetwork, kError, "SocketTcpParked::Release Exception on close\n");
+        }
+    }
+    iState = eFree;
+}
+
+THandle SocketTcpParked::TransferTo(Bwx& aPrefetch)
+{
+    THandle handle = iHandle;
+    iHandle = kHandleNull;
+    aPrefetch.Replace(iBuffer);
+    iState = eFree;
+    return handle;
+}
+
 // Tcp Server
 
 SocketTcpServer::SocketTcpServer(const TChar* aName, TUint aPort, TIpAddress aInterface,
@@ -511,6 +792,14 @@ SocketTcpServer::SocketTcpServer(const TChar* aName, TUint aPort, TIpAddress aIn
     , iSessionPriority(aSessionPriority)
     , iSessionStackBytes(aSessionStackBytes)
     , iTerminating(false)
+    , iReactor(NULL)
+    , iReactorThread(NULL)
+    , iParkTimeoutMs(0)
+    , iMaxConnections(0)
+    , iListening(false)
+    , iAcceptFailed(false)
+    , iConnectionsReady(NULL)
+    , iSemReady("TSRS", 0)
 {
     LOGF(kNetwork, "SocketTcpServer::SocketTcpServer\n");
     iHandle = SocketCreate(eSocketTypeStream);
@@ -522,6 +811,29 @@ SocketTcpServer::SocketTcpServer(const TChar* aName, TUint aPort, TIpAddress aIn
     Listen(aSlots);
 }
 
+TBool SocketTcpServer::ParkConnections(TUint aMaxConnections, const Brx& aRequestTerminator, TUint aTimeoutMs)
+{
+    ASSERT(iVector.size() == 0);
+    ASSERT(iReactor == NULL);
+    ASSERT(aMaxConnections > 0);
+    ASSERT(aRequestTerminator.Bytes() > 0);
+    try {
+        iReactor = new NetworkReactor();
+    }
+    catch (NetworkError&) {
+        LOG2F(kNetwork, kError, "SocketTcpServer::ParkConnections - no reactor support, using a session per connection\n");
+        return false;
+    }
+    iRequestTerminator.Grow(aRequestTerminator.Bytes());
+    iRequestTerminator.Replace(aRequestTerminator);
+    iParkTimeoutMs = aTimeoutMs;
+    iMaxConnections = aMaxConnections;
+    iConnectionsReady = new FifoLiteDynamic<SocketTcpParked*>(aMaxConnections);
+    iReactorThread = new ThreadFunctor("TSRA", MakeFunctor(*this, &SocketTcpServer::ReactorRun), iSessionPriority);
+    iReactorThread->Start();
+    return true;
+}
+
 void SocketTcpServer::Add(const TChar* aName, SocketTcpSession* aSession, TInt aPriorityOffset)
 {
     LOGF(kNetwork, "SocketTcpServer::Add\n");
@@ -537,9 +849,12 @@ void SocketTcpServer::Add(const TChar* aName, SocketTcpSession* aSession, TInt a
     }
 }
 
-THandle SocketTcpServer::Accept()
+THandle SocketTcpServer::Accept(Bwx& aPrefetch)
 {
     LOGF(kNetwork, "SocketTcpServer::Accept\n");
+    if (iReactor != NULL) {
+        return AcceptParked(aPrefetch);
+    }
     iMutex.Wait();                                    // wait to become the single accepting thread
     if (iTerminating) {
         iMutex.Signal();                              // signal for next session thread to become the accepting thread
@@ -550,6 +865,7 @@ THandle SocketTcpServer::Accept()
     try {
         handle = Socket::Accept();    // accept the connection
         iMutex.Signal();
+        aPrefetch.SetBytes(0);
         return (handle);
     }
     catch (NetworkError&) {  // server handle closed by destructor
@@ -559,6 +875,226 @@ THandle SocketTcpServer::Accept()
     THROW(NetworkError);
 }
 
+THandle SocketTcpServer::AcceptParked(Bwx& aPrefetch)
+{
+    iSemReady.Wait();
+    AutoMutex a(iMutex);
+    if (iTerminating) {
+        THROW(NetworkError);
+    }
+    SocketTcpParked* connection = iConnectionsReady->Read();
+    THandle handle = connection->TransferTo(aPrefetch);
+    iConnectionsFree.push_back(connection);
+    if (!iListening) {
+        iReactor->Interrupt(); // reactor thread will start accepting again
+    }
+    return handle;
+}
+
+TBool SocketTcpServer::Park(THandle aHandle, const Brx& aPending)
+{
+    iMutex.Wait();
+    SocketTcpParked* connection = (iTerminating? NULL : ClaimConnectionLocked());
+    if (connection == NULL) {
+        iMutex.Signal();
+        return false;
+    }
+    connection->Resume(aHandle, aPending);
+    iConnectionsReturned.push_back(connection);
+    iMutex.Signal();
+    iReactor->Interrupt(); // reactor thread will add the connection to its set
+    return true;
+}
+
+SocketTcpParked* SocketTcpServer::ClaimConnectionLocked()
+{
+    SocketTcpParked* connection = NULL;
+    if (iConnectionsFree.size() > 0) {
+        connection = iConnectionsFree.back();
+        iConnectionsFree.pop_back();
+    }
+    else if (iConnections.size() < iMaxConnections) {
+        connection = new SocketTcpParked();
+        iConnections.push_back(connection);
+    }
+    return connection;
+}
+
+void SocketTcpServer::ReactorRun()
+{
+    LOGF(kNetwork, ">SocketTcpServer::ReactorRun\n");
+    NetworkReactor::Event events[kMaxReactorEvents];
+    TUint lastSweep = OpenHome::Os::TimeInMs();
+    try {
+        iReactor->Add(*this, NetworkReactor::kReadable, NULL); // NULL arg identifies the listening socket
+        iListening = true;
+        while (!iTerminating) {
+            TUint count = iReactor->Wait(events, kMaxReactorEvents, kReactorSweepMs);
+            for (TUint i=0; i<count && !iTerminating; i++) {
+                if (events[i].iArg == NULL) {
+                    ReactorAccept();
+                }
+                else {
+                    ReactorRead((SocketTcpParked*)events[i].iArg);
+                }
+            }
+            if (iTerminating) {
+                break;
+            }
+            ReactorResume();
+            TUint now = OpenHome::Os::TimeInMs();
+            if (now - lastSweep >= kReactorSweepMs) {
+                lastSweep = now;
+                ReactorSweep();
+                iAcceptFailed = false;
+            }
+            iMutex.Wait();
+            if (!iListening && !iAcceptFailed && (iConnectionsFree.size() > 0 || iConnections.size() < iMaxConnections)) {
+                iReactor->Rearm(*this, NetworkReactor::kReadable, NULL);
+                iListening = true;
+            }
+            iMutex.Signal();
+        }
+    }
+    catch (NetworkError&) {
+        LOG2F(kNetwork, kError, "SocketTcpServer::ReactorRun NetworkError\n");
+    }
+    LOGF(kNetwork, "<SocketTcpServer::ReactorRun\n");
+}
+
+void SocketTcpServer::ReactorAccept()
+{
+    iMutex.Wait();
+    SocketTcpParked* connection = ClaimConnectionLocked();
+    iListening = (connection != NULL); // stop accepting until a parked connection is released
+    iMutex.Signal();
+    if (connection == NULL) {
+        LOGF(kNetwork, "SocketTcpServer::ReactorAccept - all %u connections in use\n", iMaxConnections);
+        return;
+    }
+
+    THandle handle = kHandleNull;
+    try {
+        handle = Socket::AcceptNonBlocking();
+    }
+    catch (NetworkError&) {
+        // The connection stays queued so we'd be woken for it again immediately.
+        // Stop listening until the next sweep in case the error persists (e.g. no free file descriptors)
+        LOG2F(kNetwork, kError, "SocketTcpServer::ReactorAccept NetworkError\n");
+        ReactorFree(connection);
+        iMutex.Wait();
+        iListening = false;
+        iMutex.Signal();
+        iAcceptFailed = true;
+        return;
+    }
+    if (handle == kHandleNull) { // connection was reset before we got to it
+        ReactorFree(connection);
+    }
+    else {
+        TryNetworkTcpSetNoDelay(handle);
+        connection->Open(handle, OpenHome::Os::TimeInMs());
+        try {
+            iReactor->Add(*connection, NetworkReactor::kReadable, connection);
+        }
+        catch (NetworkError&) {
+            LOG2F(kNetwork, kError, "SocketTcpServer::ReactorAccept NetworkError adding connection\n");
+            ReactorFree(connection);
+        }
+    }
+    iReactor->Rearm(*this, NetworkReactor::kReadable, NULL);
+}
+
+void SocketTcpServer::ReactorRead(SocketTcpParked* aConnection)
+{
+    switch (aConnection->Read(iRequestTerminator))
+    {
+    case SocketTcpParked::eReadIncomplete:
+        iReactor->Rearm(*aConnection, NetworkReactor::kReadable, aConnection);
+        break;
+    case SocketTcpParked::eReadComplete:
+        iReactor->Remove(*aConnection);
+        ReactorReady(aConnection);
+        break;
+    case SocketTcpParked::eReadClosed:
+        ReactorRelease(aConnection);
+        break;
+    }
+}
+
+void SocketTcpServer::ReactorReady(SocketTcpParked* aConnection)
+{
+    iMutex.Wait();
+    aConnection->SetState(SocketTcpParked::eReady);
+    iConnectionsReady->Write(aConnection);
+    iMutex.Signal();
+    iSemReady.Signal();
+}
+
+void SocketTcpServer::ReactorResume()
+{
+    iMutex.Wait();
+    iConnectionsPending.swap(iConnectionsReturned);
+    iMutex.Signal();
+    if (iConnectionsPending.size() == 0) {
+        return;
+    }
+    const TUint now = OpenHome::Os::TimeInMs();
+    for (TUint i=0; i<(TUint)iConnectionsPending.size(); i++) {
+        SocketTcpParked* connection = iConnectionsPending[i];
+        connection->SetParked(now);
+        if (connection->RequestComplete(iRequestTerminator)) { // client pipelined its next request
+            ReactorReady(connection);
+            continue;
+        }
+        try {
+            iReactor->Add(*connection, NetworkReactor::kReadable, connection);
+        }
+        catch (NetworkError&) {
+            LOG2F(kNetwork, kError, "SocketTcpServer::ReactorResume NetworkError\n");
+            iMutex.Wait();
+            connection->Release();
+            iConnectionsFree.push_back(connection);
+            iMutex.Signal();
+        }
+    }
+    iConnectionsPending.clear();
+}
+
+void SocketTcpServer::ReactorSweep()
+{
+    // iState only changes to/from eParked in the reactor thread but sessions may add to iConnections
+    const TUint now = OpenHome::Os::TimeInMs();
+    iMutex.Wait();
+    for (TUint i=0; i<(TUint)iConnections.size(); i++) {
+        SocketTcpParked* connection = iConnections[i];
+        if (connection->State() == SocketTcpParked::eParked && now - connection->ParkedTimeMs() >= iParkTimeoutMs) {
+            iConnectionsPending.push_back(connection);
+        }
+    }
+    iMutex.Signal();
+    for (TUint i=0; i<(TUint)iConnectionsPending.size(); i++) {
+        LOGF(kNetwork, "SocketTcpServer::ReactorSweep - closing idle connection\n");
+        ReactorRelease(iConnectionsPending[i]);
+    }
+    iConnectionsPending.clear();
+}
+
+void SocketTcpServer::ReactorRelease(SocketTcpParked* aConnection)
+{
+    iReactor->Remove(*aConnection);
+    ReactorFree(aConnection);
+}
+
+void SocketTcpServer::ReactorFree(SocketTcpParked* aConnection)
+{
+    // closes aConnection if it was opened but doesn't assume it is registered with iReactor
+    iMutex.Wait();
+    aConnection->Release();
+    iConnectionsFree.push_back(aConnection);
+    iMutex.Signal();
+}
+
 TBool SocketTcpServer::Terminating()
 {
     LOGF(kNetwork, "SocketTcpServer::Terminating %d\n", iTerminating);
@@ -573,9 +1109,23 @@ SocketTcpServer::~SocketTcpServer()
     // cause exception in pending AND subsequent accept attempts in session threads.
     Interrupt(true);
     TUint count = (TUint)iVector.size();
+    if (iReactor != NULL) {
+        iReactor->Interrupt();
+        delete iReactorThread;
+        for (TUint i = 0; i < count; i++) {         // wake each session waiting for a parked connection
+            iSemReady.Signal();
+        }
+    }
     for (TUint i = 0; i < count; i++) {             // delete all sessions
         delete iVector[i];
     }
+    if (iReactor != NULL) {
+        for (TUint i = 0; i < (TUint)iConnections.size(); i++) {
+            delete iConnections[i];
+        }
+        delete iConnectionsReady;
+        delete iReactor;
+    }
 
     Close();
     LOGF(kNetwork, "<SocketTcpServer::~SocketTcpServer\n");
@@ -584,14 +1134,75 @@ SocketTcpServer::~SocketTcpServer()
 // Tcp Session
 
 SocketTcpSession::SocketTcpSession()
-    : iMutex("TCPS"), iOpen(false)
+    : iMutex("TCPS"), iOpen(false), iKeepAlive(false), iPrefetchOffset(0)
+{
+}
+
+TBool SocketTcpSession::KeepAliveSupported() const
+{
+    return (iServer->iReactor != NULL);
+}
+
+void SocketTcpSession::KeepAlive(const Brx& aUnread)
+{
+    if (!KeepAliveSupported()) {
+        return;
+    }
+    // unread bytes were taken from the socket (or prefetch) before any remaining prefetched ones
+    const TUint remaining = iPrefetch.Bytes() - iPrefetchOffset;
+    const TUint bytes = aUnread.Bytes() + remaining;
+    if (bytes > iPrefetch.MaxBytes()) {
+        return;
+    }
+    TByte* ptr = const_cast<TByte*>(iPrefetch.Ptr());
+    (void)memmove(ptr + aUnread.Bytes(), ptr + iPrefetchOffset, remaining);
+    (void)memcpy(ptr, aUnread.Ptr(), aUnread.Bytes());
+    iPrefetch.SetBytes(bytes);
+    iPrefetchOffset = 0;
+    iKeepAlive = true;
+}
+
+void SocketTcpSession::Read(Bwx& aBuffer)
+{
+    if (iPrefetchOffset < iPrefetch.Bytes()) {
+        (void)ReadPrefetched(aBuffer, aBuffer.MaxBytes());
+        return;
+    }
+    SocketTcp::Read(aBuffer);
+}
+
+void SocketTcpSession::Read(Bwx& aBuffer, TUint aBytes)
+{
+    if (iPrefetchOffset < iPrefetch.Bytes()) {
+        TUint bytes = ReadPrefetched(aBuffer, aBytes);
+        if (bytes < aBytes) {
+            Bwn remaining(aBuffer.Ptr() + bytes, aBuffer.MaxBytes() - bytes);
+            SocketTcp::Read(remaining, aBytes - bytes);
+            aBuffer.SetBytes(bytes + remaining.Bytes());
+        }
+        return;
+    }
+    SocketTcp::Read(aBuffer, aBytes);
+}
+
+TUint SocketTcpSession::ReadPrefetched(Bwx& aBuffer, TUint aBytes)
 {
+    TUint bytes = iPrefetch.Bytes() - iPrefetchOffset;
+    if (bytes > aBytes) {
+        bytes = aBytes;
+    }
+    aBuffer.Replace(iPrefetch.Ptr() + iPrefetchOffset, bytes);
+    iPrefetchOffset += bytes;
+    return bytes;
 }
 
 // Called when the session is added to a server
 void SocketTcpSession::Add(SocketTcpServer& aServer, const TChar* aName, TUint aPriority, TUint aStackBytes)
 {
     iServer = &aServer;
+    if (iServer->iReactor != NULL) {
+        iPrefetch.Grow(SocketTcpServer::kMaxPrefetchBytes);
+    }
     iThread = new ThreadFunctor(aName, MakeFunctor(*this, &SocketTcpSession::Start), aPriority, aStackBytes);
     iThread->Start();
 }
@@ -602,7 +1213,7 @@ void SocketTcpSession::Start()
     LOGF(kNetwork, ">SocketTcpSession::Start()\n");
     for (;;) {
         try {
-            Open(iServer->Accept());            // accept a connection for this session
+            Open(iServer->Accept(iPrefetch));   // accept a connection for this session
         } catch (NetworkError&) {                // server is being destroyed
             LOG2F(kNetwork, kError, "-SocketTcpSession::Start() Network Accept Exception\n");
             break;
@@ -614,6 +1225,12 @@ void SocketTcpSession::Start()
         catch (NetworkError&) {                  // session handle has been shutdown or remote client has shutdown
             LOG2F(kNetwork, kError, "-SocketTcpSession::Start() Network Exception\n");
         }
+        if (iKeepAlive) {
+            iKeepAlive = false;
+            if (Park()) {   // connection handed back to the server to wait for its next request
+                continue;
+            }
+        }
         try {
             Close();    // session complete, close session handle and continue to accept new connection
         } catch (NetworkError&) {
@@ -652,9 +1269,29 @@ void SocketTcpSession::Close()
         }
         iOpen = false;
     }
+    iPrefetch.SetBytes(0);
+    iPrefetchOffset = 0;
     iMutex.Signal();
 }
 
+TBool SocketTcpSession::Park()
+{
+    LOGF(kNetwork, "SocketTcpSession::Park %d\n", iHandle);
+    AutoMutex a(iMutex);
+    if (!iOpen) {
+        return false;
+    }
+    Interrupt(false); // clear any interrupt from a read timeout which fired late
+    if (!iServer->Park(iHandle, Brn(iPrefetch.Ptr() + iPrefetchOffset, iPrefetch.Bytes() - iPrefetchOffset))) {
+        return false;
+    }
+    iHandle = kHandleNull;
+    iOpen = false;
+    iPrefetch.SetBytes(0);
+    iPrefetchOffset = 0;
+    return true;
+}
+
 SocketTcpSession::~SocketTcpSession()
 {
     LOGF(kNetwork, ">SocketTcpSession::~SocketTcpSession\n");
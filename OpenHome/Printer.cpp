@@ -1,8 +1,13 @@
 #include <OpenHome/Private/Printer.h>
+#include <OpenHome/Private/Thread.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
 
+#ifndef va_copy // not available from older msvc
+# define va_copy(d, s) ((d) = (s))
+#endif
+
 using namespace OpenHome;
 
 static FunctorMsg gLogger;
@@ -31,11 +36,13 @@ FunctorMsg Log::SwapOutput(FunctorMsg& aLogOutput)
 #define Min(a, b) ((a)<(b)? (a) : (b))
 TInt Log::Print(const Brx& aMessage)
 {
+    FlushTrace();
     return Print(gLogger, aMessage);
 }
 
 TInt Log::PrintHex(const Brx& aBrx)
 {
+    FlushTrace();
     return Print(gLogger, aBrx);
 }
 
@@ -50,9 +57,43 @@ TInt Log::Print(const TChar* aFormat, ...)
 
 TInt Log::Print(const TChar* aFormat, va_list aArgs)
 {
+    FlushTrace();
     return Print(gLogger, aFormat, aArgs);
 }
 
+void Log::Trace(const Brx& aMessage)
+{ // static
+    LogBuffer* buf = Thread::CurrentLogBuffer();
+    if (buf == NULL) {
+        (void)Print(gLogger, aMessage);
+    }
+    else {
+        buf->Append(gLogger, aMessage);
+    }
+}
+
+void Log::Trace(const TChar* aFormat, ...)
+{ // static
+    va_list args;
+    va_start(args, aFormat);
+    LogBuffer* buf = Thread::CurrentLogBuffer();
+    if (buf == NULL) {
+        (void)Print(gLogger, aFormat, args);
+    }
+    else {
+        buf->Append(gLogger, aFormat, args);
+    }
+    va_end(args);
+}
+
+void Log::FlushTrace()
+{ // static
+    LogBuffer* buf = Thread::CurrentLogBuffer();
+    if (buf != NULL) {
+        buf->Flush(gLogger);
+    }
+}
+
 TInt Log::PrintHex(FunctorMsg& aOutput, const Brx& aBrx)
 {
     Bws<kMaxPrintBytes+1> buf(kMaxPrintBytes+1);
@@ -116,3 +157,70 @@ TInt Log::DoPrint(FunctorMsg& aOutput, const TByte* aMessage)
     }
     return (TUint)strlen((const char*)aMessage);
 }
+
+
+// LogBuffer
+
+LogBuffer::LogBuffer()
+    : iBytes(0)
+{
+}
+
+void LogBuffer::Append(FunctorMsg& aOutput, const TChar* aFormat, va_list aArgs)
+{
+    TUint space = kMaxPrintBytes - iBytes;
+    va_list args;
+    va_copy(args, aArgs);
+    TInt n = vsnprintf(iBuf + iBytes, space + 1, aFormat, args);
+    va_end(args);
+    if (n < 0) {
+        return;
+    }
+    if ((TUint)n > space && iBytes > 0) {
+        // doesn't fit after the pending fragment; pass that on then retry with the whole buffer
+        iBuf[iBytes] = 0;
+        Flush(aOutput);
+        space = kMaxPrintBytes;
+        n = vsnprintf(iBuf, space + 1, aFormat, aArgs);
+        if (n < 0) {
+            return;
+        }
+    }
+    iBytes += ((TUint)n > space? space : (TUint)n);
+    FlushIfLineComplete(aOutput);
+}
+
+void LogBuffer::Append(FunctorMsg& aOutput, const Brx& aMessage)
+{
+    const TByte* ptr = aMessage.Ptr();
+    TUint remaining = aMessage.Bytes();
+    while (remaining > 0) {
+        if (iBytes == kMaxPrintBytes) {
+            Flush(aOutput);
+        }
+        const TUint bytes = Min(remaining, kMaxPrintBytes - iBytes);
+        (void)memcpy(iBuf + iBytes, ptr, bytes);
+        iBytes += bytes;
+        ptr += bytes;
+        remaining -= bytes;
+    }
+    FlushIfLineComplete(aOutput);
+}
+
+void LogBuffer::Flush(FunctorMsg& aOutput)
+{
+    if (iBytes > 0) {
+        iBuf[iBytes] = 0;
+        iBytes = 0;
+        if (aOutput) {
+            aOutput(iBuf);
+        }
+    }
+}
+
+void LogBuffer::FlushIfLineComplete(FunctorMsg& aOutput)
+{
+    if (iBytes == kMaxPrintBytes || (iBytes > 0 && iBuf[iBytes-1] == '\n')) {
+        Flush(aOutput);
+    }
+}
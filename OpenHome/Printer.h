@@ -11,6 +11,29 @@ namespace OpenHome {
 
 const TUint kMaxPrintBytes = 1024;
     
+/**
+ * Per-thread staging area for trace output.
+ *
+ * The LOG macros append fragments here.  Each complete line (or a full buffer) is passed
+ * to the log output in a single call.  Only the owning thread touches its buffer so no
+ * lock is needed to stop lines from different threads being interleaved.
+ */
+class LogBuffer
+{
+public:
+    LogBuffer();
+    void Append(FunctorMsg& aOutput, const TChar* aFormat, va_list aArgs);
+    void Append(FunctorMsg& aOutput, const Brx& aMessage);
+    void Flush(FunctorMsg& aOutput);
+private:
+    LogBuffer(const LogBuffer&);
+    void operator=(const LogBuffer&);
+    void FlushIfLineComplete(FunctorMsg& aOutput);
+private:
+    TChar iBuf[kMaxPrintBytes+1];
+    TUint iBytes;
+};
+
 class Log
 {
 public:
@@ -24,6 +47,12 @@ public:
     static TInt PrintHex(FunctorMsg& aOutput, const Brx& aMessage);
     static TInt Print(FunctorMsg& aOutput, const Brx& aMessage);
     static TInt Print(FunctorMsg& aOutput, const TChar* aFormat, va_list aArgs);
+    // following functions are used by the LOG macros.  Output is buffered per thread and
+    // passed on a line at a time.  Calls from threads not created by this library are
+    // equivalent to Print()
+    static void Trace(const Brx& aMessage);
+    static void Trace(const TChar* aFormat, ...);
+    static void FlushTrace(); // pass on any partial line buffered by the calling thread
 private:
     static TInt DoPrint(FunctorMsg& aOutput, const TByte* aMessage);
 };
@@ -385,6 +385,16 @@ void WriterBwh::TransferTo(Brh& aDest)
     iBuf.TransferTo(aDest);
 }
 
+const Brx& WriterBwh::Buffer() const
+{
+    return iBuf;
+}
+
+void WriterBwh::Reset()
+{
+    iBuf.SetBytes(0);
+}
+
 void WriterBwh::Write(const TChar* aBuffer)
 {
     Brn buf(aBuffer);
@@ -93,8 +93,7 @@ public:
     virtual void Write(TByte aValue);
     virtual void Write(const Brx& aBuffer);
     virtual void WriteFlush();
-private:
-    void WriteDrain();
+    void WriteDrain(); // pass any buffered data on without flushing the downstream writer
 protected:
     Swx(TUint aMaxBytes, IWriter& aWriter);
 private:
@@ -174,6 +173,8 @@ public:
     WriterBwh(TInt aGranularity);
     void TransferTo(Bwh& aDest);
     void TransferTo(Brh& aDest);
+    const Brx& Buffer() const;
+    void Reset(); // discard contents but keep any memory allocated for them
     void Write(const TChar* aBuffer);
     // IWriter
     void Write(TByte aValue);
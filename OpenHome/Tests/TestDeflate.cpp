@@ -0,0 +1,347 @@
+#include <OpenHome/Private/TestFramework.h>
+#include <OpenHome/Private/Deflate.h>
+#include <OpenHome/OhNetTypes.h>
+#include <OpenHome/Buffer.h>
+#include <OpenHome/Private/Stream.h>
+
+using namespace OpenHome;
+using namespace OpenHome::TestFramework;
+
+static const TUint16 kLengthBase[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                       35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const TByte kLengthExtra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                      3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const TUint16 kDistanceBase[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                         257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                         8193, 12289, 16385, 24577 };
+static const TByte kDistanceExtra[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/**
+ * Minimal rfc1951 decoder, sufficient for the single fixed Huffman block Deflate writes
+ */
+class Inflater : private INonCopyable
+{
+public:
+    Inflater(const Brx& aCompressed);
+    void Inflate(Bwh& aOutput);
+    TUint BytesRead() const; // only valid after Inflate()
+    TUint MaxDistance() const;
+private:
+    TUint ReadBit();
+    TUint ReadBits(TUint aBits);    // least significant bit first
+    TUint ReadHuffman(TUint aBits); // most significant bit first
+    TUint ReadLiteral();
+private:
+    const Brx& iCompressed;
+    TUint iByte;
+    TUint iBit;
+    TUint iMaxDistance;
+};
+
+Inflater::Inflater(const Brx& aCompressed)
+    : iCompressed(aCompressed)
+    , iByte(0)
+    , iBit(0)
+    , iMaxDistance(0)
+{
+}
+
+void Inflater::Inflate(Bwh& aOutput)
+{
+    ASSERT(ReadBits(1) == 1); // BFINAL
+    ASSERT(ReadBits(2) == 1); // BTYPE: fixed Huffman codes
+    for (;;) {
+        const TUint literal = ReadLiteral();
+        if (literal < 256) {
+            aOutput.Grow(aOutput.Bytes() + 1);
+            aOutput.Append((TByte)literal);
+            continue;
+        }
+        if (literal == 256) {
+            break;
+        }
+        const TUint lengthCode = literal - 257;
+        ASSERT(lengthCode < sizeof(kLengthBase) / sizeof(kLengthBase[0]));
+        const TUint length = kLengthBase[lengthCode] + ReadBits(kLengthExtra[lengthCode]);
+        const TUint distanceCode = ReadHuffman(5);
+        ASSERT(distanceCode < sizeof(kDistanceBase) / sizeof(kDistanceBase[0]));
+        const TUint distance = kDistanceBase[distanceCode] + ReadBits(kDistanceExtra[distanceCode]);
+        ASSERT(distance <= aOutput.Bytes());
+        if (distance > iMaxDistance) {
+            iMaxDistance = distance;
+        }
+        aOutput.Grow(aOutput.Bytes() + length);
+        for (TUint i=0; i<length; i++) { // byte at a time as the match may overlap the bytes it produces
+            aOutput.Append(aOutput[aOutput.Bytes() - distance]);
+        }
+    }
+    if (iBit > 0) {
+        iByte++;
+        iBit = 0;
+    }
+}
+
+TUint Inflater::BytesRead() const
+{
+    return iByte;
+}
+
+TUint Inflater::MaxDistance() const
+{
+    return iMaxDistance;
+}
+
+TUint Inflater::ReadBit()
+{
+    ASSERT(iByte < iCompressed.Bytes());
+    const TUint bit = (iCompressed[iByte] >> iBit) & 1;
+    if (++iBit == 8) {
+        iByte++;
+        iBit = 0;
+    }
+    return bit;
+}
+
+TUint Inflater::ReadBits(TUint aBits)
+{
+    TUint value = 0;
+    for (TUint i=0; i<aBits; i++) {
+        value |= (ReadBit() << i);
+    }
+    return value;
+}
+
+TUint Inflater::ReadHuffman(TUint aBits)
+{
+    TUint code = 0;
+    for (TUint i=0; i<aBits; i++) {
+        code = (code << 1) | ReadBit();
+    }
+    return code;
+}
+
+TUint Inflater::ReadLiteral()
+{
+    TUint code = ReadHuffman(7);
+    if (code <= 0x17) {
+        return 256 + code;
+    }
+    code = (code << 1) | ReadBit();
+    if (code >= 0x30 && code <= 0xbf) {
+        return code - 0x30;
+    }
+    if (code >= 0xc0 && code <= 0xc7) {
+        return 280 + code - 0xc0;
+    }
+    code = (code << 1) | ReadBit();
+    ASSERT(code >= 0x190 && code <= 0x1ff);
+    return 144 + code - 0x190;
+}
+
+static void Compress(const Brx& aData, Deflate::EFormat aFormat, Bwh& aCompressed)
+{
+    WriterBwh writer(1024);
+    Deflate::Compress(writer, aData, aFormat);
+    writer.TransferTo(aCompressed);
+}
+
+static TBool RoundTrips(const Brx& aData)
+{
+    Bwh compressed;
+    Compress(aData, Deflate::eRaw, compressed);
+    Inflater inflater(compressed);
+    Bwh output(aData.Bytes() + 1);
+    inflater.Inflate(output);
+    return (output == aData && inflater.BytesRead() == compressed.Bytes());
+}
+
+static void FillPseudoRandom(Bwx& aBuf, TUint aBytes, TUint32 aSeed)
+{
+    TUint32 state = aSeed;
+    for (TUint i=0; i<aBytes; i++) {
+        state = state * 1103515245 + 12345;
+        aBuf.Append((TByte)(state >> 16));
+    }
+}
+
+
+class SuiteChecksums : public Suite
+{
+public:
+    SuiteChecksums() : Suite("Deflate checksums") {}
+    void Test();
+};
+
+void SuiteChecksums::Test()
+{
+    TEST(Deflate::Crc32(Brn("123456789")) == 0xcbf43926);
+    TEST(Deflate::Crc32(Brx::Empty()) == 0);
+    TEST(Deflate::Adler32(Brn("Wikipedia")) == 0x11e60398);
+    TEST(Deflate::Adler32(Brx::Empty()) == 1);
+    // long enough that the sums must be reduced part way through
+    Bwh ones(100000);
+    ones.SetBytes(ones.MaxBytes());
+    ones.Fill(0xff);
+    TEST(Deflate::Adler32(ones) == 0x149a302c);
+}
+
+
+class SuiteFixedOutput : public Suite
+{
+public:
+    SuiteFixedOutput() : Suite("Deflate known output") {}
+    void Test();
+private:
+    TBool Check(const Brx& aData, Deflate::EFormat aFormat, const TByte* aExpected, TUint aExpectedBytes);
+};
+
+void SuiteFixedOutput::Test()
+{
+    static const TByte kEmptyRaw[] = { 0x03, 0x00 };
+    TEST(Check(Brx::Empty(), Deflate::eRaw, kEmptyRaw, sizeof(kEmptyRaw)));
+    static const TByte kEmptyZlib[] = { 0x78, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01 };
+    TEST(Check(Brx::Empty(), Deflate::eZlib, kEmptyZlib, sizeof(kEmptyZlib)));
+    static const TByte kEmptyGzip[] = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+                                        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    TEST(Check(Brx::Empty(), Deflate::eGzip, kEmptyGzip, sizeof(kEmptyGzip)));
+
+    static const TByte kA[] = { 0x4b, 0x04, 0x00 };
+    TEST(Check(Brn("a"), Deflate::eRaw, kA, sizeof(kA)));
+    static const TByte kAZlib[] = { 0x78, 0x01, 0x4b, 0x04, 0x00, 0x00, 0x62, 0x00, 0x62 };
+    TEST(Check(Brn("a"), Deflate::eZlib, kAZlib, sizeof(kAZlib)));
+    static const TByte kAGzip[] = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+                                    0x4b, 0x04, 0x00, 0x43, 0xbe, 0xb7, 0xe8, 0x01, 0x00, 0x00, 0x00 };
+    TEST(Check(Brn("a"), Deflate::eGzip, kAGzip, sizeof(kAGzip)));
+
+    // too short for a match
+    static const TByte kAbc[] = { 0x4b, 0x4c, 0x4a, 0x06, 0x00 };
+    TEST(Check(Brn("abc"), Deflate::eRaw, kAbc, sizeof(kAbc)));
+    // literals then a single length 6, distance 3 match
+    static const TByte kAbcRepeated[] = { 0x4b, 0x4c, 0x4a, 0x86, 0x20, 0x00 };
+    TEST(Check(Brn("abcabcabc"), Deflate::eRaw, kAbcRepeated, sizeof(kAbcRepeated)));
+}
+
+TBool SuiteFixedOutput::Check(const Brx& aData, Deflate::EFormat aFormat, const TByte* aExpected, TUint aExpectedBytes)
+{
+    Bwh compressed;
+    Compress(aData, aFormat, compressed);
+    return (compressed == Brn(aExpected, aExpectedBytes));
+}
+
+
+class SuiteRoundTrip : public Suite
+{
+public:
+    SuiteRoundTrip() : Suite("Deflate round trips") {}
+    void Test();
+};
+
+void SuiteRoundTrip::Test()
+{
+    TEST(RoundTrips(Brx::Empty()));
+    TEST(RoundTrips(Brn("x")));
+    TEST(RoundTrips(Brn("xy")));
+    TEST(RoundTrips(Brn("xyz")));
+    TEST(RoundTrips(Brn("xxx")));
+    TEST(RoundTrips(Brn("xxxx")));
+    TEST(RoundTrips(Brn("\xff\x90\x8f\x00")));  // literals from each of the fixed code ranges
+
+    // runs longer than the longest match
+    for (TUint bytes=257; bytes<=1000; bytes+=(bytes<262? 1 : 369)) {
+        Bwh run(bytes);
+        run.SetBytes(bytes);
+        run.Fill('r');
+        TEST(RoundTrips(run));
+        Bwh compressed;
+        Compress(run, Deflate::eRaw, compressed);
+        TEST(compressed.Bytes() < 16);
+    }
+
+    // a match at the greatest distance deflate allows
+    {
+        const TUint kWindowBytes = 32 * 1024;
+        Bwh data(kWindowBytes + 300);
+        FillPseudoRandom(data, kWindowBytes, 1);
+        data.Append(data.Split(0, 300));
+        Bwh compressed;
+        Compress(data, Deflate::eRaw, compressed);
+        Inflater inflater(compressed);
+        Bwh output(data.Bytes());
+        inflater.Inflate(output);
+        TEST(output == data);
+        TEST(inflater.BytesRead() == compressed.Bytes());
+        TEST(inflater.MaxDistance() == kWindowBytes);
+        // ...but no further
+        Bwh tooFar(kWindowBytes + 301);
+        FillPseudoRandom(tooFar, kWindowBytes + 1, 2);
+        tooFar.Append(tooFar.Split(0, 300));
+        TEST(RoundTrips(tooFar));
+    }
+
+    // mixed literals and matches, longer than the window
+    {
+        Bwh text(100 * 1024);
+        FillPseudoRandom(text, 2048, 3);
+        while (text.Bytes() + 1000 <= text.MaxBytes()) {
+            const TUint offset = (text.Bytes() * 7) % 1500;
+            text.Append(text.Split(offset, 1 + (text.Bytes() % 300)));
+            text.Append((TByte)text.Bytes());
+        }
+        TEST(RoundTrips(text));
+    }
+}
+
+
+class SuiteContainers : public Suite
+{
+public:
+    SuiteContainers() : Suite("Deflate zlib and gzip containers") {}
+    void Test();
+};
+
+void SuiteContainers::Test()
+{
+    Bwh data(5000);
+    FillPseudoRandom(data, 1000, 4);
+    data.Append(data.Split(0, 1000));
+    data.Append(Brn("the quick brown fox jumps over the lazy dog"));
+
+    Bwh zlib;
+    Compress(data, Deflate::eZlib, zlib);
+    TEST(zlib[0] == 0x78);
+    TEST((zlib[0] * 256 + zlib[1]) % 31 == 0);
+    Brn zlibBody(zlib.Split(2));
+    Inflater zlibInflater(zlibBody);
+    Bwh output(data.Bytes());
+    zlibInflater.Inflate(output);
+    TEST(output == data);
+    TEST(zlibInflater.BytesRead() + 4 == zlibBody.Bytes());
+    const TUint32 adler = Deflate::Adler32(data);
+    const TByte* trailer = zlib.Ptr() + zlib.Bytes() - 4;
+    TEST(((TUint32)trailer[0] << 24 | (TUint32)trailer[1] << 16 | (TUint32)trailer[2] << 8 | trailer[3]) == adler);
+
+    Bwh gzip;
+    Compress(data, Deflate::eGzip, gzip);
+    TEST(gzip[0] == 0x1f && gzip[1] == 0x8b && gzip[2] == 0x08);
+    Brn gzipBody(gzip.Split(10));
+    Inflater gzipInflater(gzipBody);
+    output.SetBytes(0);
+    gzipInflater.Inflate(output);
+    TEST(output == data);
+    TEST(gzipInflater.BytesRead() + 8 == gzipBody.Bytes());
+    trailer = gzip.Ptr() + gzip.Bytes() - 8;
+    TEST(((TUint32)trailer[3] << 24 | (TUint32)trailer[2] << 16 | (TUint32)trailer[1] << 8 | trailer[0]) == Deflate::Crc32(data));
+    TEST(((TUint32)trailer[7] << 24 | (TUint32)trailer[6] << 16 | (TUint32)trailer[5] << 8 | trailer[4]) == data.Bytes());
+}
+
+
+void TestDeflate()
+{
+    Runner runner("Deflate testing\n");
+    runner.Add(new SuiteChecksums());
+    runner.Add(new SuiteFixedOutput());
+    runner.Add(new SuiteRoundTrip());
+    runner.Add(new SuiteContainers());
+    runner.Run();
+}
@@ -0,0 +1,10 @@
+#include <OpenHome/Private/TestFramework.h>
+
+extern void TestDeflate();
+
+void OpenHome::TestFramework::Runner::Main(TInt /*aArgc*/, TChar* /*aArgv*/[], Net::InitialisationParams* aInitParams)
+{
+    Net::UpnpLibrary::Initialise(aInitParams);
+    TestDeflate();
+    Net::UpnpLibrary::Close();
+}
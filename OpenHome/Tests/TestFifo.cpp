@@ -1,6 +1,7 @@
 #include <OpenHome/Private/TestFramework.h>
 #include <OpenHome/Private/Fifo.h>
 #include <OpenHome/Private/Thread.h>
+#include <OpenHome/OsWrapper.h>
 
 using namespace OpenHome;
 using namespace OpenHome::TestFramework;
@@ -79,6 +80,25 @@ void SuiteFifoBasic::Test()
     TEST(q.SlotsUsed() == 0);
     TEST_THROWS(q.Read(50), Timeout);
     TEST(q.SlotsFree() == 4);
+
+    q.ReadInterrupt();
+    TEST_THROWS(q.Read(), FifoReadError);
+    q.Write(&i1);
+    TEST(q.Read() == &i1);
+
+    // slot counts which aren't a power of two
+    Fifo<I*> q3(3);
+    for (TUint lap=0; lap<10; lap++) {
+        q3.Write(&i1);
+        q3.Write(&i2);
+        q3.Write(&i3);
+        TEST(q3.SlotsUsed() == 3);
+        TEST_THROWS(q3.Write(&i4, 20), Timeout);
+        TEST(q3.Read() == &i1);
+        TEST(q3.Read() == &i2);
+        TEST(q3.Read() == &i3);
+        TEST(q3.SlotsFree() == 3);
+    }
 }
 
 typedef Fifo<I*> FifoTest;
@@ -248,6 +268,179 @@ void SuiteFifoThreadSafety::Test()
     delete th;
 }
 
+class SuiteFifoContention : public Suite
+{
+public:
+    SuiteFifoContention();
+    void Test();
+private:
+    void Run(TUint aNumWriters, TUint aNumReaders);
+    void Write();
+    void Read();
+private:
+    static const TUint kSlots = 64;
+    static const TUint kEntriesPerWriter = 200000;
+    static const TUint kMaxThreads = 4;
+    Fifo<TUint>* iFifo;
+    Semaphore iDone;
+    Mutex iLock;
+    TUint iEntriesPerReader;
+    TUint64 iSum;
+};
+
+SuiteFifoContention::SuiteFifoContention()
+    : Suite("Fifo contention benchmark")
+    , iFifo(NULL)
+    , iDone("TFCD", 0)
+    , iLock("TFCL")
+    , iEntriesPerReader(0)
+    , iSum(0)
+{
+}
+
+void SuiteFifoContention::Write()
+{
+    for (TUint i=1; i<=kEntriesPerWriter; i++) {
+        iFifo->Write(i);
+    }
+    iDone.Signal();
+}
+
+void SuiteFifoContention::Read()
+{
+    TUint64 sum = 0;
+    for (TUint i=0; i<iEntriesPerReader; i++) {
+        sum += iFifo->Read();
+    }
+    iLock.Wait();
+    iSum += sum;
+    iLock.Signal();
+    iDone.Signal();
+}
+
+void SuiteFifoContention::Run(TUint aNumWriters, TUint aNumReaders)
+{
+    ASSERT(aNumWriters <= kMaxThreads && aNumReaders <= kMaxThreads);
+    ASSERT((aNumWriters * kEntriesPerWriter) % aNumReaders == 0);
+    iFifo = new Fifo<TUint>(kSlots);
+    iEntriesPerReader = (aNumWriters * kEntriesPerWriter) / aNumReaders;
+    iSum = 0;
+    ThreadFunctor* threads[2 * kMaxThreads];
+    TUint count = 0;
+    TChar name[5] = "TFR ";
+    for (TUint i=0; i<aNumReaders; i++) {
+        name[3] = (TChar)('0' + i);
+        threads[count++] = new ThreadFunctor(name, MakeFunctor(*this, &SuiteFifoContention::Read));
+    }
+    name[2] = 'W';
+    for (TUint i=0; i<aNumWriters; i++) {
+        name[3] = (TChar)('0' + i);
+        threads[count++] = new ThreadFunctor(name, MakeFunctor(*this, &SuiteFifoContention::Write));
+    }
+    const TUint start = Os::TimeInMs();
+    for (TUint i=0; i<count; i++) {
+        threads[i]->Start();
+    }
+    for (TUint i=0; i<count; i++) {
+        iDone.Wait();
+    }
+    const TUint ms = Os::TimeInMs() - start;
+    const TUint64 expected = (TUint64)aNumWriters * kEntriesPerWriter * (kEntriesPerWriter + 1) / 2;
+    TEST(iSum == expected);
+    TEST(iFifo->SlotsUsed() == 0);
+    Print("%u writer(s), %u reader(s): %u entries took %ums\n", aNumWriters, aNumReaders, aNumWriters * kEntriesPerWriter, ms);
+    for (TUint i=0; i<count; i++) {
+        delete threads[i];
+    }
+    delete iFifo;
+    iFifo = NULL;
+}
+
+void SuiteFifoContention::Test()
+{
+    Run(1, 1);
+    Run(2, 2);
+    Run(4, 1);
+    Run(1, 4);
+    Run(4, 4);
+}
+
+class SuiteFifoByte : public Suite
+{
+public:
+    SuiteFifoByte();
+    void Test();
+private:
+    void Write();
+private:
+    static const TUint kSlots = 4096;
+    static const TUint kChunkBytes = 1500;
+    static const TUint kNumChunks = 20000;
+    FifoByte* iFifo;
+    Semaphore iDone;
+};
+
+SuiteFifoByte::SuiteFifoByte()
+    : Suite("FifoByte span reads and writes")
+    , iFifo(NULL)
+    , iDone("TFBD", 0)
+{
+}
+
+void SuiteFifoByte::Write()
+{
+    Bws<kChunkBytes> chunk;
+    for (TUint i=0; i<kNumChunks; i++) {
+        chunk.SetBytes(0);
+        for (TUint j=0; j<kChunkBytes; j++) {
+            chunk.Append((TByte)(i + j));
+        }
+        iFifo->Write(chunk);
+    }
+    iDone.Signal();
+}
+
+void SuiteFifoByte::Test()
+{
+    // writes and reads which wrap around the end of the ring
+    FifoByte q(10);
+    Bws<10> buf;
+    for (TUint lap=0; lap<10; lap++) {
+        q.Write(Brn("abcdef"));
+        TEST(q.SlotsUsed() == 6);
+        q.Read(buf, 4);
+        TEST(buf == Brn("abcd"));
+        q.Write(Brn("ghijklmn"));
+        TEST(q.SlotsFree() == 0);
+        q.Read(buf);
+        TEST(buf == Brn("efghijklmn"));
+        TEST(q.SlotsUsed() == 0);
+    }
+
+    // stream through a second thread, checking every byte
+    iFifo = new FifoByte(kSlots);
+    ThreadFunctor* writer = new ThreadFunctor("TFBW", MakeFunctor(*this, &SuiteFifoByte::Write));
+    const TUint start = Os::TimeInMs();
+    writer->Start();
+    Bws<kChunkBytes> chunk;
+    TBool ok = true;
+    for (TUint i=0; i<kNumChunks; i++) {
+        iFifo->Read(chunk);
+        for (TUint j=0; j<kChunkBytes; j++) {
+            if (chunk[j] != (TByte)(i + j)) {
+                ok = false;
+            }
+        }
+    }
+    iDone.Wait();
+    const TUint ms = Os::TimeInMs() - start;
+    TEST(ok);
+    Print("Streamed %u bytes in %ums\n", kChunkBytes * kNumChunks, ms);
+    delete writer;
+    delete iFifo;
+    iFifo = NULL;
+}
+
 class SuiteFifoLiteBasic : public Suite
 {
 public:
@@ -367,6 +560,8 @@ void TestFifo()
     Runner runner("FifoS testing\n");
     runner.Add(new SuiteFifoBasic());
     runner.Add(new SuiteFifoThreadSafety());
+    runner.Add(new SuiteFifoContention());
+    runner.Add(new SuiteFifoByte());
     runner.Add(new SuiteFifoLiteBasic());
     runner.Run();
 }
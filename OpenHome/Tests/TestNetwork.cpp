@@ -8,6 +8,13 @@
 #include <OpenHome/Private/Arch.h>
 #include <OpenHome/Net/Private/Stack.h>
 
+#include <stdio.h>
+#include <vector>
+#ifndef _WIN32
+# include <sys/resource.h>
+# include <unistd.h>
+#endif
+
 using namespace OpenHome;
 using namespace OpenHome::TestFramework;
 
@@ -689,6 +696,398 @@ void SuiteUnicast::Receiver()
     } while (val != kQuit);
 }
 
+// SuiteNetworkReactor
+
+class SuiteNetworkReactor : public Suite, public INonCopyable
+{
+public:
+    SuiteNetworkReactor(TIpAddress aInterface) : Suite("NetworkReactor tests"), iInterface(aInterface) {}
+    void Test();
+private:
+    TIpAddress iInterface;
+};
+
+void SuiteNetworkReactor::Test()
+{
+    NetworkReactor* reactor = NULL;
+    try {
+        reactor = new NetworkReactor();
+    }
+    catch (NetworkError&) {
+        Print("NetworkReactor not supported on this platform, skipping tests\n");
+        return;
+    }
+    NetworkReactor::Event events[4];
+    SocketUdp receiver(0, iInterface);
+    SocketUdp sender(0, iInterface);
+    TUint arg = 0;
+    reactor->Add(receiver, NetworkReactor::kReadable, &arg);
+
+    // nothing sent so no readiness reported
+    TEST(reactor->Wait(events, 4, 50) == 0);
+
+    sender.Send(Brn("reactor"), Endpoint(receiver.Port(), iInterface));
+    TUint count = reactor->Wait(events, 4, 1000);
+    TEST(count == 1);
+    TEST(events[0].iArg == &arg);
+    TEST((events[0].iReadiness & NetworkReactor::kReadable) != 0);
+
+    // registration is one-shot so unread data isn't reported again until re-armed
+    TEST(reactor->Wait(events, 4, 50) == 0);
+    reactor->Rearm(receiver, NetworkReactor::kReadable, &arg);
+    TEST(reactor->Wait(events, 4, 1000) == 1);
+    TEST(events[0].iArg == &arg);
+
+    // once data is read, re-arming reports nothing
+    Bws<64> buf;
+    (void)receiver.Receive(buf);
+    TEST(buf == Brn("reactor"));
+    reactor->Rearm(receiver, NetworkReactor::kReadable, &arg);
+    TEST(reactor->Wait(events, 4, 50) == 0);
+
+    // Interrupt() causes an indefinite Wait() to return without events
+    reactor->Interrupt();
+    TEST(reactor->Wait(events, 4) == 0);
+
+    reactor->Remove(receiver);
+    delete reactor;
+}
+
+// SuiteWriteNonBlocking
+
+class TcpSessionDelayedSink : public SocketTcpSession
+{
+public:
+    TcpSessionDelayedSink(Semaphore& aStart, Semaphore& aDone, Bwx& aReceived)
+        : iStart(aStart), iDone(aDone), iReceived(aReceived) {}
+private:
+    virtual void Run();
+private:
+    Semaphore& iStart;
+    Semaphore& iDone;
+    Bwx& iReceived;
+};
+
+void TcpSessionDelayedSink::Run()
+{
+    // don't read anything until told to so that the client's send buffer fills
+    iStart.Wait();
+    Bws<4096> buf;
+    try {
+        while (iReceived.Bytes() < iReceived.MaxBytes()) {
+            Read(buf);
+            iReceived.Append(buf);
+        }
+    }
+    catch (ReaderError&) {
+    }
+    iDone.Signal();
+}
+
+class SuiteWriteNonBlocking : public Suite, public INonCopyable
+{
+public:
+    SuiteWriteNonBlocking(TIpAddress aInterface) : Suite("Non-blocking TCP writes"), iInterface(aInterface) {}
+    void Test();
+private:
+    static const TUint kBytes = 1024 * 1024;
+    TIpAddress iInterface;
+};
+
+void SuiteWriteNonBlocking::Test()
+{
+    NetworkReactor* reactor = NULL;
+    try {
+        reactor = new NetworkReactor();
+    }
+    catch (NetworkError&) {
+        Print("NetworkReactor not supported on this platform, skipping tests\n");
+        return;
+    }
+    Bwh data(kBytes);
+    for (TUint i=0; i<kBytes; i++) {
+        data.Append((TByte)(i * 13));
+    }
+    Bwh received(kBytes);
+    Semaphore start("SWNS", 0);
+    Semaphore done("SWND", 0);
+    SocketTcpServer server("TSWN", 0, iInterface);
+    server.Add("TWN1", new TcpSessionDelayedSink(start, done, received));
+    SocketTcpClient client;
+    client.Open();
+    client.SetSendBufBytes(4 * 1024);
+    client.Connect(Endpoint(server.Port(), iInterface), 1000);
+
+    // nothing is being read so only part of the data can be sent
+    TUint sent = client.WriteNonBlocking(data);
+    TEST(sent > 0);
+    TEST(sent < kBytes);
+    TEST(client.WriteNonBlocking(data.Split(sent)) == 0);
+
+    // the remainder goes as the reactor reports the socket writable again
+    start.Signal();
+    NetworkReactor::Event events[4];
+    TUint arg = 0;
+    reactor->Add(client, NetworkReactor::kWritable, &arg);
+    while (sent < kBytes) {
+        TUint count = reactor->Wait(events, 4, 5000);
+        TEST(count == 1);
+        if (count != 1) {
+            break;
+        }
+        TEST((events[0].iReadiness & NetworkReactor::kWritable) != 0);
+        sent += client.WriteNonBlocking(data.Split(sent));
+        reactor->Rearm(client, NetworkReactor::kWritable, &arg);
+    }
+    TEST(sent == kBytes);
+    done.Wait(5000);
+    TEST(received == data);
+
+    reactor->Remove(client);
+    delete reactor;
+    client.Close();
+}
+
+// SuiteSendFile
+
+class TcpSessionSendFile : public SocketTcpSession
+{
+public:
+    TcpSessionSendFile(TInt aFile, TUint aOffset, TUint aBytes) : iFile(aFile), iOffset(aOffset), iBytes(aBytes) {}
+private:
+    virtual void Run() { SendFile(iFile, iOffset, iBytes); }
+private:
+    TInt iFile;
+    TUint iOffset;
+    TUint iBytes;
+};
+
+class SuiteSendFile : public Suite, public INonCopyable
+{
+public:
+    SuiteSendFile(TIpAddress aInterface) : Suite("Sending files over TCP"), iInterface(aInterface) {}
+    void Test();
+private:
+    static const TUint kFileBytes = 100 * 1024;
+    static const TUint kOffset = 1000;
+    TIpAddress iInterface;
+};
+
+void SuiteSendFile::Test()
+{
+    FILE* tmp = tmpfile();
+    if (tmp == NULL) {
+        Print("Unable to create temporary tmp, skipping tests\n");
+        return;
+    }
+    Bwh content(kFileBytes);
+    for (TUint i=0; i<kFileBytes; i++) {
+        content.Append((TByte)(i * 7));
+    }
+    TEST(fwrite(content.Ptr(), 1, content.Bytes(), tmp) == content.Bytes());
+    (void)fflush(tmp);
+
+    const TUint bytes = kFileBytes - kOffset - 10;
+    SocketTcpServer server("TSSF", 0, iInterface);
+    server.Add("TSF1", new TcpSessionSendFile(fileno(tmp), kOffset, bytes));
+    SocketTcpClient client;
+    client.Open();
+    client.Connect(Endpoint(server.Port(), iInterface), 1000);
+    Bwh received(bytes);
+    client.Receive(received, bytes);
+    TEST(received == content.Split(kOffset, bytes));
+    client.Close();
+    (void)fclose(tmp);
+}
+
+// SuiteTcpServerParked
+
+class TcpSessionRequestEcho : public SocketTcpSession
+{
+private:
+    virtual void Run();
+};
+
+void TcpSessionRequestEcho::Run()
+{
+    // echo a single "\r\n\r\n" terminated request then close the connection
+    Bws<256> request;
+    Bws<64> buf;
+    do {
+        Read(buf);
+        request.Append(buf);
+    } while (request.Bytes() < 4 || Brn(request.Ptr() + request.Bytes() - 4, 4) != Brn("\r\n\r\n"));
+    Write(request);
+}
+
+class TcpSessionKeepAliveEcho : public SocketTcpSession
+{
+private:
+    virtual void Run();
+};
+
+void TcpSessionKeepAliveEcho::Run()
+{
+    // echo a single "\r\n\r\n" terminated request, leaving the connection open for any which follow
+    const Brn terminator("\r\n\r\n");
+    Bws<256> request;
+    Bws<64> buf;
+    TUint end = 0;
+    for (;;) {
+        for (; end + terminator.Bytes() <= request.Bytes(); end++) {
+            if (Brn(request.Ptr() + end, terminator.Bytes()) == terminator) {
+                break;
+            }
+        }
+        if (end + terminator.Bytes() <= request.Bytes()) {
+            break;
+        }
+        Read(buf);
+        request.Append(buf);
+        end = 0;
+    }
+    end += terminator.Bytes();
+    Write(request.Split(0, end));
+    KeepAlive(request.Split(end));
+}
+
+class SuiteTcpServerParked : public Suite, public INonCopyable
+{
+public:
+    SuiteTcpServerParked(TIpAddress aInterface) : Suite("TCP server with parked connections"), iInterface(aInterface) {}
+    void Test();
+private:
+    static const TUint kNumClients = 20;
+    static const TUint kParkTimeoutMs = 200;
+    TIpAddress iInterface;
+};
+
+void SuiteTcpServerParked::Test()
+{
+    SocketTcpServer server("TSPK", 0, iInterface, kPriorityHigh, Thread::kDefaultStackBytes, kNumClients);
+    if (!server.ParkConnections(kNumClients + 1, Brn("\r\n\r\n"), kParkTimeoutMs)) {
+        Print("NetworkReactor not supported on this platform, skipping tests\n");
+        return;
+    }
+    server.Add("TSP1", new TcpSessionRequestEcho());
+    Endpoint endpoint(server.Port(), iInterface);
+
+    // many more connections than sessions.  Requests are sent in the reverse of connection order,
+    // with the first half of each sent before any are completed, so would deadlock if the single
+    // session were assigned to the first connection accepted
+    SocketTcpClient clients[kNumClients];
+    for (TUint i=0; i<kNumClients; i++) {
+        clients[i].Open();
+        clients[i].Connect(endpoint, 1000);
+    }
+    Brn request("GET / HTTP/1.1\r\nHost: test\r\n\r\n");
+    const TUint split = 10;
+    for (TUint i=0; i<kNumClients; i++) {
+        clients[kNumClients-1-i].Write(request.Split(0, split));
+    }
+    for (TUint i=0; i<kNumClients; i++) {
+        SocketTcpClient& client = clients[kNumClients-1-i];
+        client.Write(request.Split(split));
+        Bws<64> response;
+        client.Receive(response, request.Bytes());
+        TEST(response == request);
+        client.Close();
+    }
+
+    // a connection which never completes its request is closed by the server
+    SocketTcpClient idle;
+    idle.Open();
+    idle.Connect(endpoint, 1000);
+    idle.Write(request.Split(0, split));
+    Bws<64> buf;
+    TBool closed = false;
+    try {
+        idle.Read(buf);
+    }
+    catch (ReaderError&) {
+        closed = true;
+    }
+    TEST(closed);
+    idle.Close();
+
+    // server remains usable after the idle connection is closed
+    SocketTcpClient client;
+    client.Open();
+    client.Connect(endpoint, 1000);
+    client.Write(request);
+    client.Receive(buf, request.Bytes());
+    TEST(buf == request);
+    client.Close();
+
+    // keep-alive sessions serve sequential and pipelined requests on one connection
+    SocketTcpServer serverKeepAlive("TSKA", 0, iInterface);
+    TEST(serverKeepAlive.ParkConnections(1, Brn("\r\n\r\n"), kParkTimeoutMs));
+    serverKeepAlive.Add("TSK1", new TcpSessionKeepAliveEcho());
+    Endpoint endpointKeepAlive(serverKeepAlive.Port(), iInterface);
+    client.Open();
+    client.Connect(endpointKeepAlive, 1000);
+    Brn request2("GET /2 HTTP/1.1\r\nHost: test\r\n\r\n");
+    for (TUint i=0; i<3; i++) {
+        client.Write(request);
+        client.Receive(buf, request.Bytes());
+        TEST(buf == request);
+    }
+    Bws<128> pipelined(request);
+    pipelined.Append(request2);
+    client.Write(pipelined);
+    client.Receive(buf, request.Bytes());
+    TEST(buf == request);
+    client.Receive(buf, request2.Bytes());
+    TEST(buf == request2);
+    // ...and the connection is still closed once it has been idle for the park timeout
+    closed = false;
+    try {
+        client.Read(buf);
+    }
+    catch (ReaderError&) {
+        closed = true;
+    }
+    TEST(closed);
+    client.Close();
+
+#ifndef _WIN32
+    // a failed accept (here, from running out of file descriptors) doesn't stop the server
+    // accepting the same connection once descriptors are available again
+    struct rlimit limit;
+    TEST(getrlimit(RLIMIT_NOFILE, &limit) == 0);
+    struct rlimit lowLimit = limit;
+    if (lowLimit.rlim_cur > 1024) {
+        lowLimit.rlim_cur = 1024;
+        TEST(setrlimit(RLIMIT_NOFILE, &lowLimit) == 0);
+    }
+    client.Open(); // allocate all the client's descriptors before exhausting them
+    std::vector<int> fds;
+    for (;;) {
+        int fd = dup(0);
+        if (fd == -1) {
+            break;
+        }
+        fds.push_back(fd);
+    }
+    client.Connect(endpointKeepAlive, 1000); // completed by the kernel, not by accept()
+    client.Write(request);
+    Thread::Sleep(100);
+    for (TUint i=0; i<(TUint)fds.size(); i++) {
+        (void)close(fds[i]);
+    }
+    TEST(setrlimit(RLIMIT_NOFILE, &limit) == 0);
+    client.SetRecvTimeout(5000);
+    try {
+        client.Receive(buf, request.Bytes());
+        TEST(buf == request);
+    }
+    catch (NetworkError&) {
+        TEST(0);
+    }
+    client.Close();
+#endif // !_WIN32
+}
+
 class MainNetworkTestThread : public Thread
 {
 public:
@@ -706,6 +1105,10 @@ void MainNetworkTestThread::Run()
     runner.Add(new SuiteSocketServer(iInterface));
     runner.Add(new SuiteTcpServerShutdown(iInterface));
     runner.Add(new SuiteEndpoint());
+    runner.Add(new SuiteNetworkReactor(iInterface));
+    runner.Add(new SuiteTcpServerParked(iInterface));
+    runner.Add(new SuiteSendFile(iInterface));
+    runner.Add(new SuiteWriteNonBlocking(iInterface));
     //runner.Add(new SuiteUnicast(iInterface));
     // SuiteMulticast disabled because Linn network setup means that each multicast message is duplicated when
     // running on a core server (used for automated post-commit tests)
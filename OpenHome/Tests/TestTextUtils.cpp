@@ -2,8 +2,14 @@
 #include <OpenHome/Private/Ascii.h>
 #include <OpenHome/Private/Parser.h>
 #include <OpenHome/Private/Uri.h>
+#include <OpenHome/Net/Private/XmlParser.h>
+#include <OpenHome/Private/Converter.h>
+#include <OpenHome/Private/Stream.h>
+#include <OpenHome/Private/Maths.h>
+#include <OpenHome/OsWrapper.h>
 
 using namespace OpenHome;
+using namespace OpenHome::Net;
 using namespace OpenHome::TestFramework;
 
 class SuiteAscii : public Suite
@@ -1469,11 +1475,180 @@ void SuiteUri::Test()
 }
 
 
+class SuiteXmlParserChildIndex : public Suite
+{
+public:
+    SuiteXmlParserChildIndex() : Suite("XmlParserChildIndex") {}
+    void Test();
+};
+
+void SuiteXmlParserChildIndex::Test()
+{
+    Brn action("<?xml version=\"1.0\"?><s:Envelope xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\"><s:Body>"
+               "<u:Play xmlns:u=\"urn:av-openhome-org:service:Playlist:1\">\r\n"
+               "  <Id>12</Id>\r\n"
+               "  <Empty/>\r\n"
+               "  <Metadata>&lt;DIDL-Lite&gt;</Metadata>\r\n"
+               "  <Nested><Id>3</Id><Nested>x</Nested></Nested>\r\n"
+               "  <Blank></Blank>\r\n"
+               "</u:Play></s:Body></s:Envelope>");
+    Brn args = XmlParserBasic::Find("Play", XmlParserBasic::Find("Body", XmlParserBasic::Find("Envelope", action)));
+    XmlParserChildIndex index;
+    index.Set(args);
+    TEST(index.Count() == 5);
+
+    // in-order lookups give the same results as XmlParserBasic
+    TEST(index.Find("Id") == XmlParserBasic::Find("Id", args));
+    TEST(index.Find("Id") == Brn("12"));
+    TEST(index.Find("Empty") == Brx::Empty());
+    TEST(index.Find("Metadata") == Brn("&lt;DIDL-Lite&gt;"));
+    TEST(index.Find("Nested") == Brn("<Id>3</Id><Nested>x</Nested>"));
+    TEST(index.Find("Blank") == Brx::Empty());
+
+    // out of order and case insensitive lookups
+    TEST(index.Find("metadata") == Brn("&lt;DIDL-Lite&gt;"));
+    TEST(index.Find(Brn("ID")) == Brn("12"));
+    TEST_THROWS(index.Find("Missing"), XmlError);
+
+    index.Set(Brn("  \r\n "));
+    TEST(index.Count() == 0);
+    TEST_THROWS(index.Find("Id"), XmlError);
+
+    TEST_THROWS(index.Set(Brn("<a>1</b>")), XmlError);
+    TEST_THROWS(index.Set(Brn("<a><b>1</a>")), XmlError);
+    TEST_THROWS(index.Set(Brn("<a>1</a></b>")), XmlError);
+    TEST_THROWS(index.Set(Brn("<x:a>1</y:a>")), XmlError);
+    index.Clear();
+    TEST(index.Count() == 0);
+}
+
+
+class SuiteXmlEscape : public Suite
+{
+public:
+    SuiteXmlEscape() : Suite("Xml (un)escaping") {}
+    void Test();
+private:
+    static void ReferenceEscape(IWriter& aWriter, const Brx& aValue);
+    static void RandomText(Bwx& aBuf, TUint aBytes);
+    void Check(const Brx& aValue);
+    void Benchmark(const Brx& aValue);
+};
+
+// byte at a time escaping, as Converter::ToXmlEscaped used to do
+void SuiteXmlEscape::ReferenceEscape(IWriter& aWriter, const Brx& aValue)
+{
+    TUint utf8CharBytesRemaining = 0;
+    for (TUint i=0; i<aValue.Bytes(); i++) {
+        TByte ch = aValue[i];
+        if (utf8CharBytesRemaining == 0 && (ch & 0xC0) == 0xC0) {
+            utf8CharBytesRemaining = ((ch & 0xF0) == 0xF0? 4 : ((ch & 0xE0) == 0xE0? 3 : 2));
+        }
+        if (utf8CharBytesRemaining > 0) {
+            utf8CharBytesRemaining--;
+            aWriter.Write(ch);
+            continue;
+        }
+        switch (ch) {
+        case '<':  aWriter.Write(Brn("&lt;")); break;
+        case '>':  aWriter.Write(Brn("&gt;")); break;
+        case '&':  aWriter.Write(Brn("&amp;")); break;
+        case '\'': aWriter.Write(Brn("&apos;")); break;
+        case '\"': aWriter.Write(Brn("&quot;")); break;
+        default:   aWriter.Write(ch); break;
+        }
+    }
+}
+
+void SuiteXmlEscape::RandomText(Bwx& aBuf, TUint aBytes)
+{
+    static const TChar* kFragments[] = { "a", "Z", " ", "<", ">", "&", "'", "\"", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x8e\xb5" };
+    static const TUint kNumFragments = sizeof(kFragments) / sizeof(kFragments[0]);
+    aBuf.SetBytes(0);
+    while (aBuf.Bytes() + 4 <= aBytes) {
+        // mostly plain text so that long clean runs are scanned as well as single reserved chars
+        const TUint index = (Random(9) > 0? Random(2) : Random(kNumFragments - 1));
+        aBuf.Append(kFragments[index]);
+    }
+}
+
+void SuiteXmlEscape::Check(const Brx& aValue)
+{
+    WriterBwh expected(1024);
+    ReferenceEscape(expected, aValue);
+    WriterBwh escaped(1024);
+    Converter::ToXmlEscaped(escaped, aValue);
+    TEST(escaped.Buffer() == expected.Buffer());
+    Bwh unescaped(escaped.Buffer());
+    Converter::FromXmlEscaped(unescaped);
+    TEST(unescaped == aValue);
+}
+
+void SuiteXmlEscape::Benchmark(const Brx& aValue)
+{
+    static const TUint kIterations = 2000;
+    WriterBwh writer(aValue.Bytes() * 2);
+    TUint start = Os::TimeInMs();
+    for (TUint i=0; i<kIterations; i++) {
+        writer.Reset();
+        ReferenceEscape(writer, aValue);
+    }
+    const TUint referenceMs = Os::TimeInMs() - start;
+    start = Os::TimeInMs();
+    for (TUint i=0; i<kIterations; i++) {
+        writer.Reset();
+        Converter::ToXmlEscaped(writer, aValue);
+    }
+    const TUint escapeMs = Os::TimeInMs() - start;
+    Bwh unescaped(writer.Buffer().Bytes());
+    start = Os::TimeInMs();
+    for (TUint i=0; i<kIterations; i++) {
+        unescaped.Replace(writer.Buffer());
+        Converter::FromXmlEscaped(unescaped);
+    }
+    const TUint unescapeMs = Os::TimeInMs() - start;
+    Print("Escaping %u bytes %u times: %ums byte at a time, %ums Converter::ToXmlEscaped\n", aValue.Bytes(), kIterations, referenceMs, escapeMs);
+    Print("Unescaping %u bytes %u times: %ums Converter::FromXmlEscaped\n", writer.Buffer().Bytes(), kIterations, unescapeMs);
+}
+
+void SuiteXmlEscape::Test()
+{
+    Check(Brx::Empty());
+    Check(Brn("plain"));
+    Check(Brn("<>&'\""));
+    Check(Brn("0123456789abcde<0123456789abcdef>0123456789abcdef0123456789abcdef&"));
+    Check(Brn("caf\xc3\xa9 costs \xe2\x82\xac" "5 & rising"));
+    // continuation bytes of a (malformed) multi-byte char are passed through unescaped
+    Check(Brn("x\xe2<>y<"));
+
+    Bwh unescaped("0123456789abcdef0123456789&lt;0123456789abcdef&amp;&quot;&apos;&gt;0123456789abcdef");
+    Converter::FromXmlEscaped(unescaped);
+    TEST(unescaped == Brn("0123456789abcdef0123456789<0123456789abcdef&\"'>0123456789abcdef"));
+
+    Bwh text(4096);
+    for (TUint i=0; i<500; i++) {
+        RandomText(text, Random(200));
+        Check(text);
+    }
+
+    // DIDL-Lite style metadata: long runs of text with occasional reserved chars
+    Bwh didl(16 * 1024);
+    while (didl.Bytes() + 200 < didl.MaxBytes()) {
+        didl.Append("<DIDL-Lite xmlns=\"urn:schemas-upnp-org:metadata-1-0/DIDL-Lite/\"><item id=\"1\" parentID=\"0\">"
+                    "<dc:title>A Track Title &amp; Another</dc:title><upnp:class>object.item.audioItem</upnp:class>");
+    }
+    Check(didl);
+    Benchmark(didl);
+}
+
+
 void TestTextUtils()
 {
     Runner runner("Ascii System");
     runner.Add(new SuiteAscii()); 
     runner.Add(new SuiteParser()); 
     runner.Add(new SuiteUri()); 
+    runner.Add(new SuiteXmlParserChildIndex());
+    runner.Add(new SuiteXmlEscape());
     runner.Run();
 }
@@ -599,6 +599,101 @@ void SuitePerformance::Test()
 }
 
 
+class SuiteLockPerformance : public Suite
+{
+public:
+    SuiteLockPerformance() : Suite("Mutex and Semaphore vs OS primitives") {}
+    void Test();
+private:
+    void Contend();
+    void Report(const TChar* aOperation, TUint aStartMs);
+private:
+    static const TUint kIterations = 1000000;
+    static const TUint kContendingThreads = 4;
+    static const TUint kContendedIterations = 100000;
+    Mutex* iMutex;
+    TUint iCounter;
+    Semaphore* iDone;
+};
+
+void SuiteLockPerformance::Report(const TChar* aOperation, TUint aStartMs)
+{
+    Print("%s: %u iterations took %ums\n", aOperation, kIterations, Os::TimeInMs() - aStartMs);
+}
+
+void SuiteLockPerformance::Contend()
+{
+    for (TUint i=0; i<kContendedIterations; i++) {
+        iMutex->Wait();
+        iCounter++;
+        iMutex->Signal();
+    }
+    iDone->Signal();
+}
+
+void SuiteLockPerformance::Test()
+{
+    // uncontended costs
+    Mutex mutex("LKPM");
+    TUint start = Os::TimeInMs();
+    for (TUint i=0; i<kIterations; i++) {
+        mutex.Wait();
+        mutex.Signal();
+    }
+    Report("Mutex Wait/Signal", start);
+
+    THandle osMutex = Os::MutexCreate("LKPO");
+    start = Os::TimeInMs();
+    for (TUint i=0; i<kIterations; i++) {
+        (void)Os::MutexLock(osMutex);
+        Os::MutexUnlock(osMutex);
+    }
+    Report("OS mutex Lock/Unlock", start);
+    Os::MutexDestroy(osMutex);
+
+    Semaphore sem("LKPS", 0);
+    start = Os::TimeInMs();
+    for (TUint i=0; i<kIterations; i++) {
+        sem.Signal();
+        sem.Wait();
+    }
+    Report("Semaphore Signal/Wait", start);
+
+    THandle osSem = Os::SemaphoreCreate("LKPT", 0);
+    start = Os::TimeInMs();
+    for (TUint i=0; i<kIterations; i++) {
+        Os::SemaphoreSignal(osSem);
+        Os::SemaphoreWait(osSem);
+    }
+    Report("OS semaphore Signal/Wait", start);
+    Os::SemaphoreDestroy(osSem);
+
+    // contended mutex must still exclude
+    iMutex = &mutex;
+    iCounter = 0;
+    iDone = new Semaphore("LKPD", 0);
+    ThreadFunctor* threads[kContendingThreads];
+    TChar name[5] = "LKP ";
+    for (TUint i=0; i<kContendingThreads; i++) {
+        name[3] = (TChar)('0' + i);
+        threads[i] = new ThreadFunctor(name, MakeFunctor(*this, &SuiteLockPerformance::Contend));
+    }
+    start = Os::TimeInMs();
+    for (TUint i=0; i<kContendingThreads; i++) {
+        threads[i]->Start();
+    }
+    for (TUint i=0; i<kContendingThreads; i++) {
+        iDone->Wait();
+    }
+    Print("Contended Mutex: %u threads x %u iterations took %ums\n", kContendingThreads, kContendedIterations, Os::TimeInMs() - start);
+    TEST(iCounter == kContendingThreads * kContendedIterations);
+    for (TUint i=0; i<kContendingThreads; i++) {
+        delete threads[i];
+    }
+    delete iDone;
+}
+
+
 class SuiteAutoMutex : public Suite
 {
 public:
@@ -671,6 +766,65 @@ void SuiteThreadKill::Test()
 }
 
 
+class AtomicIncrementer : public Thread
+{
+public:
+    AtomicIncrementer(AtomicInt& aValue, TUint aCount, Semaphore& aDone)
+        : Thread("ATIN"), iValue(aValue), iCount(aCount), iDone(aDone) {}
+    void Run()
+    {
+        for (TUint i=0; i<iCount; i++) {
+            (void)iValue.Inc();
+            (void)iValue.Dec();
+            (void)iValue.Inc();
+        }
+        iDone.Signal();
+    }
+private:
+    AtomicInt& iValue;
+    TUint iCount;
+    Semaphore& iDone;
+};
+
+class SuiteAtomicInt : public Suite
+{
+public:
+    SuiteAtomicInt() : Suite("AtomicInt") {}
+    void Test();
+};
+
+void SuiteAtomicInt::Test()
+{
+    AtomicInt value(1);
+    TEST(value.Value() == 1);
+    TEST(value.Inc() == 2);
+    TEST(value.Dec() == 1);
+    TEST(value.IncIfNonZero());
+    TEST(value.Value() == 2);
+    value.Set(0);
+    TEST(!value.IncIfNonZero());
+    TEST(value.Value() == 0);
+    TEST(value.Dec() == -1);
+    TEST(value.Inc() == 0);
+
+    const TUint kThreads = 4;
+    const TUint kCount = 100000;
+    Semaphore done("ATSM", 0);
+    Thread* threads[kThreads];
+    for (TUint i=0; i<kThreads; i++) {
+        threads[i] = new AtomicIncrementer(value, kCount, done);
+        threads[i]->Start();
+    }
+    for (TUint i=0; i<kThreads; i++) {
+        done.Wait();
+    }
+    for (TUint i=0; i<kThreads; i++) {
+        delete threads[i];
+    }
+    TEST(value.Value() == (TInt)(kThreads * kCount));
+}
+
+
 class MainTestThread : public Thread
 {
 public:
@@ -684,10 +838,12 @@ void MainTestThread::Run()
     runner.Add(new SuiteSemaphore());
     runner.Add(new SuiteMutex());
     runner.Add(new SuiteAutoMutex());
+    runner.Add(new SuiteAtomicInt());
     runner.Add(new SuiteStartStop());
     // Performance tests disabled as they cause intermittent failures for automated tests
     // (which run on servers with variable loads)
     //runner.Add(new SuitePerformance());
+    //runner.Add(new SuiteLockPerformance());
     runner.Add(new SuiteThreadKill());
     if (OpenHome::Thread::SupportsPriorities())
     {
@@ -1,6 +1,7 @@
 #include <OpenHome/Private/TestFramework.h>
 #include <OpenHome/Private/Timer.h>
 #include <OpenHome/Private/Maths.h>
+#include <OpenHome/OsWrapper.h>
 
 using namespace OpenHome;
 using namespace OpenHome::TestFramework;
@@ -225,15 +226,154 @@ void SuiteTimerThrash::Test()
     }
 }
 
+class SuiteTimerStress : public Suite
+{
+public:
+    SuiteTimerStress() : Suite("Timer stress benchmark") {}
+    void Test();
+private:
+    void Fire();
+    void Report(const TChar* aOperation, TUint aStartMs);
+private:
+    static const TUint kNumTimers = 100000;
+    static const TUint kSpreadMs = 2000;
+    TUint iCount;
+    Semaphore* iAllFired;
+};
+
+void SuiteTimerStress::Fire()
+{
+    if (++iCount == kNumTimers) {
+        iAllFired->Signal();
+    }
+}
+
+void SuiteTimerStress::Report(const TChar* aOperation, TUint aStartMs)
+{
+    TUint ms = Os::TimeInMs() - aStartMs;
+    Print("%s %u live timers took %ums\n", aOperation, kNumTimers, ms);
+}
+
+void SuiteTimerStress::Test()
+{
+    Functor f = MakeFunctor(*this, &SuiteTimerStress::Fire);
+    Timer** timers = new Timer*[kNumTimers];
+    for (TUint i=0; i<kNumTimers; i++) {
+        timers[i] = new Timer(f);
+    }
+    iAllFired = new Semaphore("TSTR", 0);
+    iCount = 0;
+
+    // schedule far in the future so that nothing fires while we measure insert/move/cancel costs
+    TUint start = Os::TimeInMs();
+    for (TUint i=0; i<kNumTimers; i++) {
+        timers[i]->FireIn(60000 + Random(60000));
+    }
+    Report("Adding", start);
+    start = Os::TimeInMs();
+    for (TUint i=0; i<kNumTimers; i++) {
+        timers[i]->FireIn(60000 + Random(60000));
+    }
+    Report("Rescheduling", start);
+    start = Os::TimeInMs();
+    for (TUint i=0; i<kNumTimers; i++) {
+        timers[i]->Cancel();
+    }
+    Report("Cancelling", start);
+    TEST(iCount == 0);
+
+    Print("Firing %u timers over %ums\n", kNumTimers, kSpreadMs);
+    for (TUint i=0; i<kNumTimers; i++) {
+        timers[i]->FireIn(Random(kSpreadMs));
+    }
+    start = Os::TimeInMs();
+    try {
+        iAllFired->Wait(kSpreadMs + 10000);
+    }
+    catch (Timeout&) {}
+    Report("Firing", start);
+    TEST(iCount == kNumTimers);
+
+    for (TUint i=0; i<kNumTimers; i++) {
+        delete timers[i];
+    }
+    delete[] timers;
+    delete iAllFired;
+}
+
+class SuiteTimerPool : public Suite
+{
+public:
+    SuiteTimerPool() : Suite("Timer callback pool") {}
+    void Test();
+private:
+    void Slow();
+    void Fast();
+private:
+    static const TUint kSlowCallbackMs = 1000;
+    Semaphore* iSlowStarted;
+    TBool iSlowCompleted;
+    TUint iFastFiredAt;
+    Semaphore* iFastFired;
+};
+
+void SuiteTimerPool::Slow()
+{
+    iSlowStarted->Signal();
+    Thread::Sleep(kSlowCallbackMs);
+    iSlowCompleted = true;
+}
+
+void SuiteTimerPool::Fast()
+{
+    iFastFiredAt = Os::TimeInMs();
+    iFastFired->Signal();
+}
+
+void SuiteTimerPool::Test()
+{
+    iSlowStarted = new Semaphore("TSLS", 0);
+    iFastFired = new Semaphore("TFST", 0);
+    iSlowCompleted = false;
+    Timer slow(MakeFunctor(*this, &SuiteTimerPool::Slow));
+    Timer fast(MakeFunctor(*this, &SuiteTimerPool::Fast));
+
+    // a slow callback shouldn't delay other timers
+    const TUint start = Os::TimeInMs();
+    slow.FireIn(10);
+    fast.FireIn(100);
+    iSlowStarted->Wait();
+    iFastFired->Wait();
+    TEST(!iSlowCompleted);
+    TEST(iFastFiredAt - start < kSlowCallbackMs / 2);
+
+    // Cancel() of a running timer blocks until its callback completes
+    slow.Cancel();
+    TEST(iSlowCompleted);
+
+    // ...and a cancelled timer doesn't fire
+    iSlowCompleted = false;
+    slow.FireIn(50);
+    slow.Cancel();
+    Thread::Sleep(200);
+    TEST(!iSlowCompleted);
+
+    delete iSlowStarted;
+    delete iFastFired;
+}
+
 class TimerTestThread : public Thread
 {
 public:
-    TimerTestThread();
+    TimerTestThread(TBool aCallbackPool);
     void Run();
+private:
+    TBool iCallbackPool;
 };
 
-TimerTestThread::TimerTestThread()
+TimerTestThread::TimerTestThread(TBool aCallbackPool)
     : Thread("MAIN", kPriorityNormal)
+    , iCallbackPool(aCallbackPool)
 {
 }
 
@@ -242,15 +382,31 @@ void TimerTestThread::Run()
     //Debug::SetLevel(Debug::kTimer);
     Runner runner("Timer testing\n");
     runner.Add(new SuiteTimerBasic());
-    runner.Add(new SuiteTimerThrash());
+    if (iCallbackPool) {
+        runner.Add(new SuiteTimerPool());
+    }
+    else {
+        runner.Add(new SuiteTimerThrash());
+        runner.Add(new SuiteTimerStress());
+    }
     runner.Run();
     Signal();
 }
 
-void TestTimer()
+static void RunTimerTests(TBool aCallbackPool)
 {
-    Thread* th = new TimerTestThread();
+    Thread* th = new TimerTestThread(aCallbackPool);
     th->Start();
     th->Wait();
     delete th;
 }
+
+void TestTimer()
+{
+    RunTimerTests(false);
+}
+
+void TestTimerPool()
+{
+    RunTimerTests(true);
+}
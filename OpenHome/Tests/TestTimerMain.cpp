@@ -4,10 +4,18 @@
 using namespace OpenHome;
 
 extern void TestTimer();
+extern void TestTimerPool();
 
 void OpenHome::TestFramework::Runner::Main(TInt /*aArgc*/, TChar* /*aArgv*/[], Net::InitialisationParams* aInitParams)
 {
     Net::UpnpLibrary::Initialise(aInitParams);
     TestTimer();
     Net::UpnpLibrary::Close();
+
+    // repeat with timer callbacks dispatched to a pool of threads
+    Net::InitialisationParams* initParams = Net::InitialisationParams::Create();
+    initParams->SetNumTimerThreads(4);
+    Net::UpnpLibrary::Initialise(initParams);
+    TestTimerPool();
+    Net::UpnpLibrary::Close();
 }
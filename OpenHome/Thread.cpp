@@ -2,7 +2,6 @@
 #include <OpenHome/Private/Debug.h>
 #include <OpenHome/OsWrapper.h>
 #include <exception>
-#include <OpenHome/Net/Private/Stack.h>
 
 using namespace OpenHome;
 
@@ -13,8 +12,9 @@ static const Brn kThreadNameUnknown("____");
 //
 
 Semaphore::Semaphore(const TChar* aName, TUint aCount)
+    : iCount(aCount)
 {
-    iHandle = OpenHome::Os::SemaphoreCreate(aName, aCount);
+    iHandle = OpenHome::Os::SemaphoreCreate(aName, 0);
     if (iHandle == kHandleNull) {
         throw std::bad_alloc();
     }
@@ -25,29 +25,51 @@ Semaphore::~Semaphore()
     OpenHome::Os::SemaphoreDestroy(iHandle);
 }
 
-void Semaphore::Wait()
-{
-    OpenHome::Os::SemaphoreWait(iHandle);
-}
-
 void Semaphore::Wait(TUint aTimeoutMs)
 {
     if (aTimeoutMs == 0) {
         return (Wait());
     }
+    if ((TInt)Atomic::Add(iCount, -1) >= 0) {
+        return;
+    }
     ASSERT(iHandle != kHandleNull);
-    if (!OpenHome::Os::SemaphoreTimedWait(iHandle, aTimeoutMs)) {
-        THROW(Timeout);
+    if (OpenHome::Os::SemaphoreTimedWait(iHandle, aTimeoutMs)) {
+        return;
+    }
+    // Timed out.  Withdraw as a waiter unless a Signal() has already been directed at us,
+    // in which case the OS semaphore will complete immediately.
+    for (;;) {
+        const TUint count = Atomic::Load(iCount);
+        if ((TInt)count >= 0) {
+            OpenHome::Os::SemaphoreWait(iHandle);
+            return;
+        }
+        if (Atomic::CompareAndSwap(iCount, count, count + 1)) {
+            THROW(Timeout);
+        }
     }
 }
 
 TBool Semaphore::Clear()
 {
-    ASSERT(iHandle != kHandleNull);
-    return OpenHome::Os::SemaphoreClear(iHandle);
+    for (;;) {
+        const TUint count = Atomic::Load(iCount);
+        if ((TInt)count <= 0) {
+            return false;
+        }
+        if (Atomic::CompareAndSwap(iCount, count, 0)) {
+            return true;
+        }
+    }
 }
 
-void Semaphore::Signal()
+void Semaphore::Block()
+{
+    OpenHome::Os::SemaphoreWait(iHandle);
+}
+
+void Semaphore::Wake()
 {
     OpenHome::Os::SemaphoreSignal(iHandle);
 }
@@ -57,8 +79,9 @@ void Semaphore::Signal()
 //
 
 Mutex::Mutex(const TChar* aName)
+    : iCount(0)
 {
-    iHandle = OpenHome::Os::MutexCreate(aName);
+    iHandle = OpenHome::Os::SemaphoreCreate(aName, 0);
     if (iHandle == kHandleNull) {
         throw std::bad_alloc();
     }
@@ -68,31 +91,24 @@ Mutex::Mutex(const TChar* aName)
 
 Mutex::~Mutex()
 {
-    OpenHome::Os::MutexDestroy(iHandle);
+    OpenHome::Os::SemaphoreDestroy(iHandle);
 }
 
-void Mutex::Wait()
+void Mutex::Block()
 {
-    TInt err = OpenHome::Os::MutexLock(iHandle);
-    if (err != 0) {
-        const char* msg;
-        if (err == -1) {
-            msg = "Recursive lock attempted on mutex";
-        }
-        else {
-            msg = "Lock attempted on uninitialised mutex";
-        }    
-        Brhz thBuf;
-        Bws<5> thName(Thread::CurrentThreadName());
-        thName.PtrZ();
-        Log::Print("ERROR: %s %s from thread %s\n", msg, iName, thName.Ptr());
-        ASSERT(err == 0);
-    }
+    OpenHome::Os::SemaphoreWait(iHandle);
 }
 
-void Mutex::Signal()
+void Mutex::Wake(TUint aCount)
 {
-    OpenHome::Os::MutexUnlock(iHandle);
+    if ((TInt)aCount < 0) {
+        Bws<5> thName(Thread::CurrentThreadName());
+        thName.PtrZ();
+        Log::Print("ERROR: Unlock attempted on unlocked mutex %s from thread %s\n", iName, thName.Ptr());
+        ASSERTS();
+    }
+    // hand ownership directly to one waiter
+    OpenHome::Os::SemaphoreSignal(iHandle);
 }
 
 //
@@ -162,7 +178,7 @@ Thread::Thread(const TChar* aName, TUint aPriority, TUint aStackBytes)
     : iHandle(kHandleNull)
     , iSema("TSEM", 0)
     , iTerminated(aName, 0)
-    , iKill(false)
+    , iKill(0)
     , iStackBytes(aStackBytes)
     , iPriority(aPriority)
 {
@@ -209,6 +225,7 @@ void Thread::EntryPoint(void* aArg)
         UnhandledExceptionHandler( "Unknown Exception", "Unknown File", 0 );
     }
     LOG(kThread, "Thread::Entry(): Thread::Run returned, exiting thread %s(%p)\n", self->iName.Ptr(), self);
+    Log::FlushTrace();
     self->iTerminated.Signal();
 }
 
@@ -256,6 +273,15 @@ Thread* Thread::Current()
     return (Thread*)th;
 }
 
+LogBuffer* Thread::CurrentLogBuffer()
+{ // static
+    Thread* th = Current();
+    if (th == NULL) {
+        return NULL;
+    }
+    return &th->iLogBuffer;
+}
+
 TBool Thread::SupportsPriorities()
 { // static
     return OpenHome::Os::ThreadSupportsPriorities();
@@ -263,10 +289,7 @@ TBool Thread::SupportsPriorities()
 
 void Thread::CheckForKill() const
 {
-    Net::Stack::Mutex().Wait();
-    TBool kill = iKill;
-    Net::Stack::Mutex().Signal();
-    if (kill) {
+    if (iKill.Value() != 0) {
         THROW(ThreadKill);
     }
 }
@@ -274,9 +297,7 @@ void Thread::CheckForKill() const
 void Thread::Kill()
 {
     LOG(kThread, "Thread::Kill() called for thread: %p\n", this);
-    Net::Stack::Mutex().Wait();
-    iKill = true;
-    Net::Stack::Mutex().Signal();
+    iKill.Set(1);
     Signal();
 }
 
@@ -336,33 +357,3 @@ AutoMutex::~AutoMutex()
     iMutex.Signal();
 }
 
-//
-// AtomicInt
-//
-
-AtomicInt::AtomicInt(TInt aInitialValue)
-    : iInt(aInitialValue)
-{
-}
-
-AtomicInt::AtomicInt()
-    : iInt(0)
-{
-}
-
-TInt AtomicInt::Inc()
-{
-    Net::Stack::Mutex().Wait();
-    TInt value = ++iInt;
-    Net::Stack::Mutex().Signal();
-    return value;
-}
-
-TInt AtomicInt::Dec()
-{
-    Net::Stack::Mutex().Wait();
-    TInt value = --iInt;
-    Net::Stack::Mutex().Signal();
-    return value;
-}
-
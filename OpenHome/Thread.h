@@ -5,6 +5,8 @@
 #include <OpenHome/Buffer.h>
 #include <OpenHome/Functor.h>
 #include <OpenHome/OsTypes.h>
+#include <OpenHome/Private/Atomic.h>
+#include <OpenHome/Private/Printer.h>
 
 EXCEPTION(ThreadKill);
 EXCEPTION(Timeout);
@@ -34,6 +36,12 @@ enum ThreadPriority {
    ,kPrioritySystemHighest = 150
 };
 
+/*
+ * Semaphore and Mutex keep their state in an atomic counter so that uncontended calls
+ * complete inline without entering the OS layer.  The OS semaphore they hold is only
+ * used to block and wake threads when there is contention.
+ */
+
 class Semaphore : public INonCopyable
 {
 public:
@@ -41,7 +49,7 @@ public:
     Semaphore(const TChar* aName, TUint aCount);
     virtual ~Semaphore();
 
-    void Wait();
+    inline void Wait();
     // Note: aTimeoutMs == 0 means wait forever
     void Wait(TUint aTimeoutMs);
     /**
@@ -50,8 +58,12 @@ public:
      * @return  true if signals were cleared; false otherwise
      */
     TBool Clear();
-    void Signal();
+    inline void Signal();
+private:
+    void Block();
+    void Wake();
 private:
+    volatile TUint iCount; // signals available or, if negative, -(number of waiters)
     THandle iHandle;
 };
 
@@ -61,13 +73,85 @@ public:
     DllExport Mutex(const TChar* aName);
     DllExport virtual ~Mutex();
 
-    DllExport void Wait();
-    DllExport void Signal();
+    inline void Wait();
+    inline void Signal();
 private:
+    DllExport void Block();
+    DllExport void Wake(TUint aCount);
+private:
+    volatile TUint iCount; // 1 for the owner plus 1 per waiter
     THandle iHandle;
     TChar iName[5];
 };
 
+inline void Semaphore::Wait()
+{
+    if ((TInt)Atomic::Add(iCount, -1) < 0) {
+        Block();
+    }
+}
+
+inline void Semaphore::Signal()
+{
+    if ((TInt)Atomic::Add(iCount, 1) <= 0) {
+        Wake();
+    }
+}
+
+inline void Mutex::Wait()
+{
+    if (Atomic::Add(iCount, 1) != 1) {
+        Block();
+    }
+}
+
+inline void Mutex::Signal()
+{
+    const TUint count = Atomic::Add(iCount, -1);
+    if (count != 0) {
+        Wake(count);
+    }
+}
+
+/**
+ * Integer which can be safely updated from many threads without a lock.
+ *
+ * Every operation is a full barrier, so provides (at least) acquire and release
+ * semantics.  Suitable for reference counts: writes made before a Dec() are visible to
+ * the thread which sees the count reach zero.
+ */
+class AtomicInt : public INonCopyable
+{
+public:
+    inline AtomicInt(TInt aInitialValue) : iValue((TUint)aInitialValue) {}
+    inline AtomicInt() : iValue(0) {}
+    inline TInt Value() const { return (TInt)Atomic::Load(iValue); }
+    inline void Set(TInt aValue) { Atomic::Store(iValue, (TUint)aValue); }
+    inline TInt Inc() { return (TInt)Atomic::Add(iValue, 1); }  // returns new value
+    inline TInt Dec() { return (TInt)Atomic::Add(iValue, -1); } // returns new value
+    /**
+     * Increment, unless the current value is zero.
+     *
+     * @return  true if the value was incremented; false if it was zero
+     */
+    TBool IncIfNonZero();
+private:
+    volatile TUint iValue;
+};
+
+inline TBool AtomicInt::IncIfNonZero()
+{
+    for (;;) {
+        const TUint value = Atomic::Load(iValue);
+        if (value == 0) {
+            return false;
+        }
+        if (Atomic::CompareAndSwap(iValue, value, value + 1)) {
+            return true;
+        }
+    }
+}
+
 /**
  * Abstract runnable thread class
  *
@@ -126,6 +210,11 @@ public:
      */
     static Thread* Current();
 
+    /**
+     * Return the current thread's trace buffer, or NULL if running in a non-OpenHome thread.
+     */
+    static OpenHome::LogBuffer* CurrentLogBuffer();
+
     /**
      * Query whether the platform port supports thread priorities
      */
@@ -172,9 +261,10 @@ protected:
     Semaphore iSema;
 private:
     Semaphore iTerminated;
-    TBool     iKill;
+    AtomicInt iKill;
     TUint     iStackBytes;
     TUint     iPriority;
+    OpenHome::LogBuffer iLogBuffer;
 };
 
 /**
@@ -231,17 +321,6 @@ private:
     Mutex& iMutex;
 };
 
-class AtomicInt : public INonCopyable
-{
-public:
-    AtomicInt(TInt aInitialValue);
-    AtomicInt();
-    TInt Inc();
-    TInt Dec();
-private:
-    TInt iInt;
-};
-
 } // namespace OpenHome
 
 #endif
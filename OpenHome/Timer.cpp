@@ -4,6 +4,8 @@
 #include <OpenHome/Private/Thread.h>
 #include <OpenHome/Private/Debug.h>
 
+#include <stdio.h>
+
 using namespace OpenHome;
 
 // Time
@@ -43,7 +45,10 @@ TInt Time::TimeToWaitFor(TUint aTime)
 // Timer
 
 Timer::Timer(Functor aFunctor)
-: iFunctor(aFunctor)
+    : iFunctor(aFunctor)
+    , iTime(0)
+    , iIndex(TimerManager::kNotQueued)
+    , iDispatched(false)
 {
 }
 
@@ -57,25 +62,14 @@ void Timer::FireIn(TUint aTime)
 void Timer::FireAt(TUint aTime)
 {
     LOG(kTimer, ">Timer::FireAt(%d)\n", aTime);
-    TimerManager& manager = OpenHome::Net::Stack::TimerManager();
-    manager.Remove(*this);
-    iTime = aTime;
-    manager.Add(*this);
+    OpenHome::Net::Stack::TimerManager().Add(*this, aTime);
     LOG(kTimer, "<Timer::FireAt(%d)\n", aTime);
 }
 
 void Timer::Cancel()
 {
     LOG(kTimer, ">Timer::Cancel()\n");
-    TimerManager& mgr = Net::Stack::TimerManager();
-    TBool lock = !IsInManagerThread();
-    if (lock) {
-        mgr.CallbackLock();
-    }
     OpenHome::Net::Stack::TimerManager().Remove(*this);
-    if (lock) {
-        mgr.CallbackUnlock();
-    }
     LOG(kTimer, "<Timer::Cancel()\n");
 }
 
@@ -86,7 +80,7 @@ TBool Timer::IsInManagerThread()
         current = Thread::Current();
     }
     catch (ThreadUnknown&) {}
-    return (current == Net::Stack::TimerManager().Thread());
+    return Net::Stack::TimerManager().IsCallbackThread(current);
 }
 
 Timer::~Timer()
@@ -94,21 +88,43 @@ Timer::~Timer()
     Cancel();
 }
 
+// TimerManager::CallbackThread
+
+TimerManager::CallbackThread::CallbackThread(OpenHome::Thread* aThread)
+    : iThread(aThread)
+    , iTimer(NULL)
+    , iRefire(false)
+{
+}
+
 // TimerManager
 
-TimerManager::TimerManager()
-    : iMutexNow("NOWM")
-    , iRemoving(false)
-    , iSemaphore("TIMM", 0)
+TimerManager::TimerManager(TUint aNumCallbackThreads)
+    : iSemaphore("TIMM", 0)
+    , iDispatchSem("TIMD", 0)
+    , iCallbackComplete("TIMC", 0)
+    , iCancelWaiters(0)
     , iMutex("TIMM")
-    , iNextTimer(0)
     , iStop(false)
     , iStopped("MTS2", 0)
-    , iCallbackMutex("TMCB")
-    , iThreadHandle(NULL)
 {
     LOG(kTimer, ">TimerManager::TimerManager()\n");
     iThread = new ThreadFunctor("TIMM", MakeFunctor(*this, &TimerManager::Run), kPriorityHigh);
+    if (aNumCallbackThreads == 0) {
+        iCallbackThreads.push_back(CallbackThread(iThread));
+    }
+    else {
+        TChar thName[5];
+        for (TUint i=0; i<aNumCallbackThreads; i++) {
+            (void)sprintf(&thName[0], "TC%2lu", (unsigned long)(i % 100));
+            ThreadFunctor* th = new ThreadFunctor(&thName[0], MakeFunctor(*this, &TimerManager::RunCallbacks), kPriorityHigh);
+            iPool.push_back(th);
+            iCallbackThreads.push_back(CallbackThread(th));
+        }
+        for (TUint i=0; i<iPool.size(); i++) {
+            iPool[i]->Start();
+        }
+    }
     iThread->Start();
     LOG(kTimer, "<TimerManager::TimerManager()\n");
 }
@@ -118,6 +134,9 @@ TimerManager::~TimerManager()
     LOG(kTimer, ">TimerManager::~TimerManager()\n");
     Stop();
     delete iThread;
+    for (TUint i=0; i<iPool.size(); i++) {
+        delete iPool[i];
+    }
     LOG(kTimer, "<TimerManager::~TimerManager()\n");
 }
 
@@ -131,6 +150,9 @@ void TimerManager::Stop()
         iStop = true;
         iMutex.Signal();
         iSemaphore.Signal();
+        for (TUint i=0; i<iPool.size(); i++) {
+            iDispatchSem.Signal();
+        }
         LOG(kTimer, "-TimerManager::Stop() Wait for stopped\n");
         iStopped.Wait();
     }
@@ -142,119 +164,276 @@ void TimerManager::Stop()
     LOG(kTimer, "<TimerManager::Stop()\n");
 }
 
-void TimerManager::CallbackLock()
+// Queue (or re-queue) a timer
+// The manager thread only needs to be woken if aTimer is now the first to expire
+
+void TimerManager::Add(Timer& aTimer, TUint aTime)
 {
-    iCallbackMutex.Wait();
+    iMutex.Wait();
+    if (aTimer.iIndex != kNotQueued) {
+        RemoveLocked(aTimer);
+    }
+    aTimer.iTime = aTime;
+    const TUint index = (TUint)iTimers.size();
+    iTimers.push_back(&aTimer);
+    aTimer.iIndex = index;
+    SiftUp(index);
+    const TBool headChanged = (aTimer.iIndex == 0);
+    iMutex.Signal();
+    if (headChanged) {
+        LOG(kTimer, "-TimerManager::Add() retrigger timer\n");
+        iSemaphore.Signal();
+    }
 }
 
-void TimerManager::CallbackUnlock()
+// Dequeue a timer, waiting for its callback to complete if it is running on another thread
+
+void TimerManager::Remove(Timer& aTimer)
 {
-    iCallbackMutex.Signal();
+    OpenHome::Thread* current = NULL;
+    try {
+        current = OpenHome::Thread::Current();
+    }
+    catch (ThreadUnknown&) {}
+    iMutex.Wait();
+    if (aTimer.iIndex != kNotQueued) {
+        RemoveLocked(aTimer);
+    }
+    if (aTimer.iDispatched) {
+        aTimer.iDispatched = false;
+        for (std::deque<Timer*>::iterator it = iDispatched.begin(); it != iDispatched.end(); ++it) {
+            if (*it == &aTimer) {
+                iDispatched.erase(it);
+                break;
+            }
+        }
+    }
+    for (;;) {
+        TBool running = false;
+        for (TUint i=0; i<iCallbackThreads.size(); i++) {
+            CallbackThread& cb = iCallbackThreads[i];
+            if (cb.iTimer == &aTimer) {
+                cb.iRefire = false;
+                if (cb.iThread != current) {
+                    running = true;
+                }
+            }
+        }
+        if (!running) {
+            break;
+        }
+        iCancelWaiters++;
+        iMutex.Signal();
+        iCallbackComplete.Wait();
+        iMutex.Wait();
+    }
+    iMutex.Signal();
 }
 
-// Called when the head item in the base timer queue changes
-// Prime the master timer accordingly, unless this change in the head item
-// is due to us removing already expired items
+// Removing the head timer doesn't retrigger the manager thread; it'll just wake early and find nothing to do
 
-void TimerManager::HeadChanged(QueueSortedEntry& aEntry)
+void TimerManager::RemoveLocked(Timer& aTimer)
 {
-    LOG(kTimer, ">TimerManager::HeadChanged()\n", iRemoving);
+    const TUint index = aTimer.iIndex;
+    ASSERT(index < iTimers.size() && iTimers[index] == &aTimer);
+    aTimer.iIndex = kNotQueued;
+    Timer* last = iTimers.back();
+    iTimers.pop_back();
+    if (last != &aTimer) {
+        Place(*last, index);
+        SiftUp(index);
+        SiftDown(last->iIndex);
+    }
+}
 
-    if(IsTail(aEntry)) {
-        LOG(kTimer, "<TimerManager::HeadChanged() queue is empty\n");
-        return;
+Timer* TimerManager::RemoveHeadLocked(TUint aNow)
+{
+    if (iTimers.size() == 0 || Time::IsAfter(iTimers[0]->iTime, aNow)) {
+        return NULL;
     }
+    Timer* head = iTimers[0];
+    RemoveLocked(*head);
+    return head;
+}
 
-    iMutexNow.Wait();
+void TimerManager::Place(Timer& aTimer, TUint aIndex)
+{
+    iTimers[aIndex] = &aTimer;
+    aTimer.iIndex = aIndex;
+}
 
-    if (!iRemoving) {
-        iMutexNow.Signal();
-        iMutex.Wait();
-        iNextTimer = Entry(aEntry).iTime;
-        iMutex.Signal();
-        iSemaphore.Signal();
-        LOG(kTimer, "<TimerManager::HeadChanged() retrigger timer\n");
-        return;
+void TimerManager::SiftUp(TUint aIndex)
+{
+    Timer* timer = iTimers[aIndex];
+    while (aIndex > 0) {
+        const TUint parent = (aIndex - 1) / kArity;
+        TInt diff = timer->iTime - iTimers[parent]->iTime;
+        if (diff >= 0) {
+            break;
+        }
+        Place(*iTimers[parent], aIndex);
+        aIndex = parent;
     }
+    Place(*timer, aIndex);
+}
 
-    if (&aEntry == &iNow) {
-        iRemoving = false;
+void TimerManager::SiftDown(TUint aIndex)
+{
+    const TUint count = (TUint)iTimers.size();
+    Timer* timer = iTimers[aIndex];
+    for (;;) {
+        const TUint first = aIndex * kArity + 1;
+        if (first >= count) {
+            break;
+        }
+        TUint earliest = first;
+        const TUint end = (first + kArity < count? first + kArity : count);
+        for (TUint i=first+1; i<end; i++) {
+            if (IsEarlier(i, earliest)) {
+                earliest = i;
+            }
+        }
+        TInt diff = iTimers[earliest]->iTime - timer->iTime;
+        if (diff >= 0) {
+            break;
+        }
+        Place(*iTimers[earliest], aIndex);
+        aIndex = earliest;
     }
+    Place(*timer, aIndex);
+}
 
-    iMutexNow.Signal();
-
-    LOG(kTimer, "<TimerManager::HeadChanged() while removing\n");
+TBool TimerManager::IsEarlier(TUint aIndex1, TUint aIndex2) const
+{
+    TInt diff = iTimers[aIndex1]->iTime - iTimers[aIndex2]->iTime;
+    return (diff < 0);
 }
 
 // Fire expired timers
 //
-// This is achieved by inserting a dummy entry that represents 'now' into the sorted timer queue,
-// then removing head items until we reach this 'now' item. All queue entries removed during this process
-// represent expired timers.
-//
-// Note that during this process any change to the head item in the queue does does not cause the master timer
-// to be retriggered. (See HeadChanged) 
+// Timers due at or before the time Fire() was entered are removed from the head of the heap
+// one at a time and either have their callbacks run immediately or are passed to the pool of
+// callback threads.  Timers re-queued by a callback for a later time will be picked up by Run()
+// on its next iteration.
 
 void TimerManager::Fire()
 {
-    TUint now = Os::TimeInMs();
-    iMutexNow.Wait();
-    iRemoving = true;
-    iNow.iTime = now + 1; // will go after all the entries before or at now
-    iMutexNow.Signal();
-
-    // Add an entry for now, then ...
-
-    DoAdd(iNow);
-    
-    LOG(kTimer, "-TimerManager::Fire() - TimerExpired, removing entries before %d\n", iNow.iTime);
-
-    // remove all the entries before now
-    // See HeadChanged() for how iRemoving gets turned off
-    // Note that it has to be done this way so that the first
-    // item to become the head after the dummy now entry has
-    // been removed gets to prime the timer driver
+    const TUint now = Os::TimeInMs();
+    LOG(kTimer, "-TimerManager::Fire() - TimerExpired, removing entries at or before %d\n", now);
 
-    CallbackLock();
+    iMutex.Wait();
     for (;;) {
-        Timer& head = RemoveHead();
-        if(&head == &iNow) {
+        Timer* head = RemoveHeadLocked(now);
+        if (head == NULL) {
             LOG(kTimer, "-TimerManager::Fire() done signalling\n");
             break;
         }
-        head.iFunctor(); // run the timer's callback
+        if (iPool.size() == 0) {
+            RunCallbackLocked(iCallbackThreads[0], *head);
+        }
+        else {
+            DispatchLocked(*head);
+        }
         LOG(kTimer, "-TimerManager::Fire() signaling consumer\n");
     }
-    CallbackUnlock();
+    iMutex.Signal();
 }
 
-OpenHome::Thread* TimerManager::Thread() const
+TBool TimerManager::IsCallbackThread(OpenHome::Thread* aThread) const
 {
-    return iThreadHandle;
+    for (TUint i=0; i<iCallbackThreads.size(); i++) {
+        if (iCallbackThreads[i].iThread == aThread) {
+            return true;
+        }
+    }
+    return false;
 }
 
-TInt TimerManager::Compare(QueueSortedEntry& aEntry1, QueueSortedEntry& aEntry2)
+void TimerManager::DispatchLocked(Timer& aTimer)
 {
-    return (Entry(aEntry1).iTime - Entry(aEntry2).iTime);
+    for (TUint i=0; i<iCallbackThreads.size(); i++) {
+        CallbackThread& cb = iCallbackThreads[i];
+        if (cb.iTimer == &aTimer) {
+            // run again on the same thread once the current callback completes
+            cb.iRefire = true;
+            return;
+        }
+    }
+    if (!aTimer.iDispatched) {
+        aTimer.iDispatched = true;
+        iDispatched.push_back(&aTimer);
+        iDispatchSem.Signal();
+    }
+}
+
+// Called with iMutex held; releases it while the callback runs.
+// aTimer may be deleted by its callback so is only used again if it refired (which Cancel() prevents)
+
+void TimerManager::RunCallbackLocked(CallbackThread& aCallbackThread, Timer& aTimer)
+{
+    aCallbackThread.iTimer = &aTimer;
+    do {
+        aCallbackThread.iRefire = false;
+        iMutex.Signal();
+        aTimer.iFunctor(); // run the timer's callback
+        iMutex.Wait();
+    } while (aCallbackThread.iRefire);
+    aCallbackThread.iTimer = NULL;
+    while (iCancelWaiters > 0) {
+        iCancelWaiters--;
+        iCallbackComplete.Signal();
+    }
+}
+
+void TimerManager::RunCallbacks()
+{
+    CallbackThread* cb = NULL;
+    OpenHome::Thread* current = OpenHome::Thread::Current();
+    for (TUint i=0; i<iCallbackThreads.size(); i++) {
+        if (iCallbackThreads[i].iThread == current) {
+            cb = &iCallbackThreads[i];
+        }
+    }
+    ASSERT(cb != NULL);
+    for (;;) {
+        iDispatchSem.Wait();
+        iMutex.Wait();
+        if (iStop) {
+            iMutex.Signal();
+            break;
+        }
+        if (iDispatched.size() > 0) { // may be empty if the timer was cancelled after being dispatched
+            Timer* timer = iDispatched.front();
+            iDispatched.pop_front();
+            timer->iDispatched = false;
+            RunCallbackLocked(*cb, *timer);
+        }
+        iMutex.Signal();
+    }
 }
 
 void TimerManager::Run()
 {
-    iThreadHandle = Thread::Current();
-    iSemaphore.Wait();
     iMutex.Wait();
     while (!iStop) {
-        TInt delay = Time::TimeToWaitFor(iNextTimer);
-        iMutex.Signal();
-        if (delay <= 0) { // in the past or now
-            Fire();
+        // signals are only ever sent after iMutex is released so any pending now are stale
+        (void)iSemaphore.Clear();
+        if (iTimers.size() == 0) {
+            iMutex.Signal();
             iSemaphore.Wait();
         }
-        else { // in the future
-            try {
-                iSemaphore.Wait(delay);
+        else {
+            TInt delay = Time::TimeToWaitFor(iTimers[0]->iTime);
+            iMutex.Signal();
+            if (delay <= 0) { // in the past or now
+                Fire();
             }
-            catch (Timeout&) {
+            else { // in the future
+                try {
+                    iSemaphore.Wait(delay);
+                }
+                catch (Timeout&) {
+                }
             }
         }
         iMutex.Wait();
@@ -262,4 +441,3 @@ void TimerManager::Run()
     iMutex.Signal();
     iStopped.Signal();
 }
-
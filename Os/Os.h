@@ -406,6 +406,37 @@ int32_t OsNetworkConnect(THandle aHandle, TIpAddress aAddress, uint16_t aPort, u
  */
 int32_t OsNetworkSend(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes);
 
+/**
+ * Send as much data as will fit in the socket's send buffer without waiting
+ *
+ * Intended for sockets monitored by a reactor, which should wait for the socket to
+ * become writable before sending the remainder.  Like the reactor functions, non-trivial
+ * implementation of this is optional.
+ *
+ * @param[in] aHandle      Socket handle returned from OsNetworkCreate()
+ * @param[in] aBuffer      Data to send
+ * @param[in] aBytes       Number of bytes of 'aBuffer' to send
+ *
+ * @return  number of bytes sent (0..aBytes) on success; -1 on failure
+ */
+int32_t OsNetworkSendNonBlocking(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes);
+
+/**
+ * Send part of a file to the endpoint we're OsNetworkConnect()ed to
+ *
+ * Uses sendfile() where available so that file data isn't copied through user space.
+ * Other platforms read the file and send it in blocks.
+ *
+ * @param[in] aHandle      Socket handle returned from OsNetworkCreate()
+ * @param[in] aFile        Native file descriptor, open for reading
+ * @param[in] aOffset      Offset into aFile of the first byte to send
+ * @param[in] aBytes       Number of bytes to send
+ *
+ * @return  number of bytes sent (>0) on success; -1 on failure.  The position of aFile
+ *          is undefined on return.
+ */
+int32_t OsNetworkSendFile(THandle aHandle, int32_t aFile, uint64_t aOffset, uint32_t aBytes);
+
 /**
  * Send data to the specified endpoint
  *
@@ -500,6 +531,147 @@ int32_t OsNetworkListen(THandle aHandle, uint32_t aSlots);
  */
 THandle OsNetworkAccept(THandle aHandle);
 
+/**
+ * Accept a pending connection without waiting for one to arrive.
+ *
+ * Intended for listening sockets monitored by a reactor, which may report a connection
+ * that has gone by the time it is accepted.  Like the reactor functions, non-trivial
+ * implementation of this is optional.
+ *
+ * @param[in]  aHandle     Socket handle returned from OsNetworkCreate() and passed to OsNetworkListen()
+ * @param[out] aAccepted   Handle for the new connection.  Only set on success
+ *
+ * @return  0 on success; 1 if no connection was pending; -1 on failure
+ */
+int32_t OsNetworkAcceptNonBlocking(THandle aHandle, THandle* aAccepted);
+
+/**
+ * Readiness conditions a socket can be monitored for by a reactor
+ */
+typedef enum
+{
+    eOsNetworkReadable = 1 /**< data (or a connection, for listening sockets) is available */
+   ,eOsNetworkWritable = 2 /**< data can be sent without blocking */
+   ,eOsNetworkHangup   = 4 /**< error or remote close.  Reported only, never requested */
+} OsNetworkReadiness;
+
+/**
+ * Notification of a ready socket, returned by OsNetworkReactorWait()
+ */
+typedef struct OsNetworkReactorEvent
+{
+    void*    iArg;       /**< value passed to OsNetworkReactorAdd() or OsNetworkReactorRearm() */
+    uint32_t iReadiness; /**< bitmask of OsNetworkReadiness values */
+} OsNetworkReactorEvent;
+
+/**
+ * Create a reactor, allowing a single thread to wait on readiness of many sockets.
+ *
+ * Non-trivial implementation of this, and every other OsNetworkReactor function is
+ * entirely optional.  Callers will fall back to blocking one thread per socket if
+ * this returns kHandleNull.
+ *
+ * @return  a valid handle on success; kHandleNull if creation failed or reactors
+ *          are not supported.
+ */
+THandle OsNetworkReactorCreate();
+
+/**
+ * Destroy a reactor.
+ *
+ * Sockets which are still registered are not closed.
+ *
+ * @param[in] aReactor     Handle returned from OsNetworkReactorCreate()
+ */
+void OsNetworkReactorDestroy(THandle aReactor);
+
+/**
+ * Register a socket with a reactor.
+ *
+ * Registration is one-shot: once readiness has been reported by OsNetworkReactorWait(),
+ * the socket will not be reported again until OsNetworkReactorRearm() is called.
+ * This allows a ready socket to be handed to a worker thread without other waiters
+ * seeing it.
+ *
+ * @param[in] aReactor     Handle returned from OsNetworkReactorCreate()
+ * @param[in] aHandle      Socket handle returned from OsNetworkCreate() or OsNetworkAccept()
+ * @param[in] aReadiness   Bitmask of eOsNetworkReadable and/or eOsNetworkWritable
+ * @param[in] aArg         Value to report in OsNetworkReactorEvent
+ *
+ * @return  0 on success; -1 on failure
+ */
+int32_t OsNetworkReactorAdd(THandle aReactor, THandle aHandle, uint32_t aReadiness, void* aArg);
+
+/**
+ * Re-enable reporting for a socket previously registered with OsNetworkReactorAdd().
+ *
+ * @param[in] aReactor     Handle returned from OsNetworkReactorCreate()
+ * @param[in] aHandle      Socket handle previously passed to OsNetworkReactorAdd()
+ * @param[in] aReadiness   Bitmask of eOsNetworkReadable and/or eOsNetworkWritable
+ * @param[in] aArg         Value to report in OsNetworkReactorEvent
+ *
+ * @return  0 on success; -1 on failure
+ */
+int32_t OsNetworkReactorRearm(THandle aReactor, THandle aHandle, uint32_t aReadiness, void* aArg);
+
+/**
+ * Deregister a socket.  Must be called before the socket is closed.
+ *
+ * @param[in] aReactor     Handle returned from OsNetworkReactorCreate()
+ * @param[in] aHandle      Socket handle previously passed to OsNetworkReactorAdd()
+ *
+ * @return  0 on success; -1 on failure
+ */
+int32_t OsNetworkReactorRemove(THandle aReactor, THandle aHandle);
+
+/**
+ * Wait for one or more registered sockets to become ready.
+ *
+ * @param[in]  aReactor    Handle returned from OsNetworkReactorCreate()
+ * @param[out] aEvents     Array to be filled with details of ready sockets
+ * @param[in]  aMaxEvents  Maximum number of entries to write to aEvents
+ * @param[in]  aTimeoutMs  Maximum time to wait.  0 means wait indefinitely.
+ *
+ * @return  number of entries written to aEvents; 0 on timeout or if
+ *          OsNetworkReactorInterrupt() was called; -1 on failure
+ */
+int32_t OsNetworkReactorWait(THandle aReactor, OsNetworkReactorEvent* aEvents, uint32_t aMaxEvents, uint32_t aTimeoutMs);
+
+/**
+ * Cause a current (or the next) call to OsNetworkReactorWait() to return early.
+ *
+ * @param[in] aReactor     Handle returned from OsNetworkReactorCreate()
+ *
+ * @return  0 on success; -1 on failure
+ */
+int32_t OsNetworkReactorInterrupt(THandle aReactor);
+
+/**
+ * Begin connecting to a (possibly remote) socket without waiting for the connection to complete.
+ *
+ * Intended for use with a reactor.  If the connection is in progress, the socket will be
+ * reported as writable (see OsNetworkReactorAdd()) once the attempt completes or fails;
+ * OsNetworkConnectComplete() must then be called to fetch the result.
+ * Like the reactor functions, non-trivial implementation of this is optional.
+ *
+ * @param[in] aHandle      Socket handle returned from OsNetworkCreate()
+ * @param[in] aAddress     IpV4 address (in network byte order) to connect to
+ * @param[in] aPort        Port [0..65535] to connect to
+ *
+ * @return  0 if the connection completed immediately; 1 if it is in progress; -1 on failure
+ */
+int32_t OsNetworkConnectStart(THandle aHandle, TIpAddress aAddress, uint16_t aPort);
+
+/**
+ * Fetch the result of a connection begun by OsNetworkConnectStart() which reported
+ * it was in progress.  The socket reverts to blocking operation.
+ *
+ * @param[in] aHandle      Socket handle previously passed to OsNetworkConnectStart()
+ *
+ * @return  0 on success; -1 on failure
+ */
+int32_t OsNetworkConnectComplete(THandle aHandle);
+
 /**
  * Convert a string into a IpV4 address
  *
@@ -83,6 +83,74 @@ void OpenHome::Os::NetworkConnect(THandle aHandle, const Endpoint& aEndpoint, TU
     }
 }
 
+TBool OpenHome::Os::NetworkConnectStart(THandle aHandle, const Endpoint& aEndpoint)
+{
+    int32_t err = OsNetworkConnectStart(aHandle, aEndpoint.Address(), aEndpoint.Port());
+    if (err < 0) {
+        LOG2F(kNetwork, kError, "Os::NetworkConnectStart H = %d, RETURN VALUE = %d\n", aHandle, err);
+        THROW(NetworkError);
+    }
+    return (err == 0);
+}
+
+void OpenHome::Os::NetworkConnectComplete(THandle aHandle)
+{
+    int32_t err = OsNetworkConnectComplete(aHandle);
+    if (err != 0) {
+        LOG2F(kNetwork, kError, "Os::NetworkConnectComplete H = %d, RETURN VALUE = %d\n", aHandle, err);
+        THROW(NetworkError);
+    }
+}
+
+THandle OpenHome::Os::NetworkAcceptNonBlocking(THandle aHandle)
+{
+    THandle accepted = kHandleNull;
+    int32_t err = OsNetworkAcceptNonBlocking(aHandle, &accepted);
+    if (err < 0) {
+        LOG2F(kNetwork, kError, "Os::NetworkAcceptNonBlocking H = %d, RETURN VALUE = %d\n", aHandle, err);
+        THROW(NetworkError);
+    }
+    return accepted;
+}
+
+TUint OpenHome::Os::NetworkSendNonBlocking(THandle aHandle, const Brx& aBuffer)
+{
+    int32_t sent = OsNetworkSendNonBlocking(aHandle, aBuffer.Ptr(), aBuffer.Bytes());
+    if (sent < 0) {
+        LOG2F(kNetwork, kError, "Os::NetworkSendNonBlocking H = %d, RETURN VALUE = %d\n", aHandle, sent);
+        THROW(NetworkError);
+    }
+    return (TUint)sent;
+}
+
+void OpenHome::Os::NetworkReactorAdd(THandle aReactor, THandle aHandle, TUint aReadiness, void* aArg)
+{
+    int32_t err = OsNetworkReactorAdd(aReactor, aHandle, aReadiness, aArg);
+    if (err != 0) {
+        LOG2F(kNetwork, kError, "Os::NetworkReactorAdd H = %d, RETURN VALUE = %d\n", aHandle, err);
+        THROW(NetworkError);
+    }
+}
+
+void OpenHome::Os::NetworkReactorRearm(THandle aReactor, THandle aHandle, TUint aReadiness, void* aArg)
+{
+    int32_t err = OsNetworkReactorRearm(aReactor, aHandle, aReadiness, aArg);
+    if (err != 0) {
+        LOG2F(kNetwork, kError, "Os::NetworkReactorRearm H = %d, RETURN VALUE = %d\n", aHandle, err);
+        THROW(NetworkError);
+    }
+}
+
+TUint OpenHome::Os::NetworkReactorWait(THandle aReactor, OsNetworkReactorEvent* aEvents, TUint aMaxEvents, TUint aTimeoutMs)
+{
+    int32_t count = OsNetworkReactorWait(aReactor, aEvents, aMaxEvents, aTimeoutMs);
+    if (count < 0) {
+        LOG2F(kNetwork, kError, "Os::NetworkReactorWait RETURN VALUE = %d\n", count);
+        THROW(NetworkError);
+    }
+    return (TUint)count;
+}
+
 TInt OpenHome::Os::NetworkReceiveFrom(THandle aHandle, Bwx& aBuffer, Endpoint& aEndpoint)
 {
     TIpAddress address;
@@ -49,7 +49,10 @@ public:
     static TInt NetworkBindMulticast(THandle aHandle, TIpAddress aAdapter, const Endpoint& aMulticast);
     static TInt NetworkPort(THandle aHandle, TUint& aPort);
     static void NetworkConnect(THandle aHandle, const Endpoint& aEndpoint, TUint aTimeoutMs);
+    static TBool NetworkConnectStart(THandle aHandle, const Endpoint& aEndpoint);
+    static void NetworkConnectComplete(THandle aHandle);
     inline static TInt NetworkSend(THandle aHandle, const Brx& aBuffer);
+    inline static TInt NetworkSendFile(THandle aHandle, TInt aFile, TUint64 aOffset, TUint aBytes);
     inline static TInt NetworkSendTo(THandle aHandle, const Brx& aBuffer, const Endpoint& aEndpoint);
     inline static TInt NetworkReceive(THandle aHandle, Bwx& aBuffer);
     static TInt NetworkReceiveFrom(THandle aHandle, Bwx& aBuffer, Endpoint& aEndpoint);
@@ -57,6 +60,15 @@ public:
     inline static TInt NetworkClose(THandle aHandle);
     inline static TInt NetworkListen(THandle aHandle, TUint aSlots);
     inline static THandle NetworkAccept(THandle aHandle);
+    static THandle NetworkAcceptNonBlocking(THandle aHandle);
+    static TUint NetworkSendNonBlocking(THandle aHandle, const Brx& aBuffer);
+    inline static THandle NetworkReactorCreate();
+    inline static void NetworkReactorDestroy(THandle aReactor);
+    static void NetworkReactorAdd(THandle aReactor, THandle aHandle, TUint aReadiness, void* aArg);
+    static void NetworkReactorRearm(THandle aReactor, THandle aHandle, TUint aReadiness, void* aArg);
+    inline static TInt NetworkReactorRemove(THandle aReactor, THandle aHandle);
+    static TUint NetworkReactorWait(THandle aReactor, OsNetworkReactorEvent* aEvents, TUint aMaxEvents, TUint aTimeoutMs);
+    inline static TInt NetworkReactorInterrupt(THandle aReactor);
     static TIpAddress NetworkGetHostByName(const Brx& aAddress);
     static void NetworkSocketSetSendBufBytes(THandle aHandle, TUint aBytes);
     static void NetworkSocketSetRecvBufBytes(THandle aHandle, TUint aBytes);
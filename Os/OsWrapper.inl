@@ -70,6 +70,8 @@ inline TBool Os::ThreadSupportsPriorities()
 
 inline TInt Os::NetworkSend(THandle aHandle, const Brx& aBuffer)
 { return OsNetworkSend(aHandle, aBuffer.Ptr(), aBuffer.Bytes()); }
+inline TInt Os::NetworkSendFile(THandle aHandle, TInt aFile, TUint64 aOffset, TUint aBytes)
+{ return OsNetworkSendFile(aHandle, (int32_t)aFile, aOffset, aBytes); }
 inline TInt Os::NetworkSendTo(THandle aHandle, const Brx& aBuffer, const Endpoint& aEndpoint)
 { return OsNetworkSendTo(aHandle, aBuffer.Ptr(), aBuffer.Bytes(), aEndpoint.Address(), aEndpoint.Port()); }
 inline TInt Os::NetworkReceive(THandle aHandle, Bwx& aBuffer)
@@ -82,6 +84,14 @@ inline TInt Os::NetworkListen(THandle aHandle, TUint aSlots)
 { return OsNetworkListen(aHandle, aSlots); }
 inline THandle Os::NetworkAccept(THandle aHandle)
 { return OsNetworkAccept(aHandle); }
+inline THandle Os::NetworkReactorCreate()
+{ return OsNetworkReactorCreate(); }
+inline void Os::NetworkReactorDestroy(THandle aReactor)
+{ OsNetworkReactorDestroy(aReactor); }
+inline TInt Os::NetworkReactorRemove(THandle aReactor, THandle aHandle)
+{ return OsNetworkReactorRemove(aReactor, aHandle); }
+inline TInt Os::NetworkReactorInterrupt(THandle aReactor)
+{ return OsNetworkReactorInterrupt(aReactor); }
 void Os::NetworkSetInterfaceChangedObserver(InterfaceListChanged aCallback, void* aArg)
 { OsNetworkSetInterfaceChangedObserver(aCallback, aArg); }
 
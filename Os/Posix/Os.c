@@ -14,8 +14,8 @@
 #endif
 #include <string.h>
 #include <sys/types.h>
-#include <sys/select.h>
 #include <sys/socket.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <net/if.h>
 #include <netinet/in.h>
@@ -23,6 +23,14 @@
 #ifndef PLATFORM_MACOSX_GNU
 # include <linux/netlink.h>
 # include <linux/rtnetlink.h>
+# include <sys/epoll.h>
+# include <sys/eventfd.h>
+# include <sys/syscall.h>
+# include <linux/futex.h>
+# include <sys/sendfile.h>
+# define USE_EPOLL
+# define USE_FUTEX
+# define USE_SENDFILE
 #endif /* !PLATFORM_MACOSX_GNU */
 #include <arpa/inet.h>
 #include <netdb.h>
@@ -48,10 +56,7 @@
 do __result = (long int) (expression); \
 while (__result == -1L && errno == EINTR); \
 __result; }))
-# define MAX_FILE_DESCRIPTOR FD_SETSIZE
 # define MSG_NOSIGNAL 0
-#else
-# define MAX_FILE_DESCRIPTOR __FD_SETSIZE
 #endif
 
 
@@ -271,6 +276,120 @@ void OsGetPlatformNameAndVersion(char** aName, uint32_t* aMajor, uint32_t* aMino
     *aMinor = 0;
 }
 
+#ifdef USE_FUTEX
+
+/* Semaphores are a single counter.  Waiters only enter the kernel (via futex) while the
+   count is zero; signallers only do so when a waiter has registered. */
+typedef struct
+{
+    volatile int32_t  iValue;
+    volatile int32_t  iWaiters;
+} SemaphoreData;
+
+static int futexWait(volatile int32_t* aAddress, int32_t aExpected, const struct timespec* aTimeout)
+{
+    return (int)syscall(SYS_futex, aAddress, FUTEX_WAIT_PRIVATE, aExpected, aTimeout, NULL, 0);
+}
+
+static void futexWake(volatile int32_t* aAddress, int32_t aCount)
+{
+    (void)syscall(SYS_futex, aAddress, FUTEX_WAKE_PRIVATE, aCount, NULL, NULL, 0);
+}
+
+static int semaphoreTryDecrement(SemaphoreData* aData)
+{
+    int32_t value = aData->iValue;
+    while (value > 0) {
+        int32_t prev = __sync_val_compare_and_swap(&aData->iValue, value, value - 1);
+        if (prev == value) {
+            return 1;
+        }
+        value = prev;
+    }
+    return 0;
+}
+
+THandle OsSemaphoreCreate(const char* aName, uint32_t aCount)
+{
+    SemaphoreData* data = (SemaphoreData*)calloc(1, sizeof(*data));
+    if (data == NULL)
+        return kHandleNull;
+    data->iValue = (int32_t)aCount;
+    return (THandle)data;
+}
+
+void OsSemaphoreDestroy(THandle aSem)
+{
+    free((SemaphoreData*)aSem);
+}
+
+int32_t OsSemaphoreWait(THandle aSem)
+{
+    SemaphoreData* data = (SemaphoreData*)aSem;
+    while (!semaphoreTryDecrement(data)) {
+        (void)__sync_add_and_fetch(&data->iWaiters, 1);
+        if (futexWait(&data->iValue, 0, NULL) != 0 && errno != EAGAIN && errno != EINTR) {
+            (void)__sync_sub_and_fetch(&data->iWaiters, 1);
+            return -1;
+        }
+        (void)__sync_sub_and_fetch(&data->iWaiters, 1);
+    }
+    return 0;
+}
+
+int32_t OsSemaphoreTimedWait(THandle aSem, uint32_t aTimeoutMs)
+{
+    SemaphoreData* data = (SemaphoreData*)aSem;
+    struct timespec now;
+    struct timespec end;
+    struct timespec remaining;
+    (void)clock_gettime(CLOCK_MONOTONIC, &end);
+    end.tv_sec += aTimeoutMs / 1000;
+    end.tv_nsec += (aTimeoutMs % 1000) * 1000000;
+    if (end.tv_nsec >= 1000000000) {
+        end.tv_sec++;
+        end.tv_nsec -= 1000000000;
+    }
+    while (!semaphoreTryDecrement(data)) {
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        remaining.tv_sec = end.tv_sec - now.tv_sec;
+        remaining.tv_nsec = end.tv_nsec - now.tv_nsec;
+        if (remaining.tv_nsec < 0) {
+            remaining.tv_sec--;
+            remaining.tv_nsec += 1000000000;
+        }
+        if (remaining.tv_sec < 0) {
+            return 0;
+        }
+        (void)__sync_add_and_fetch(&data->iWaiters, 1);
+        if (futexWait(&data->iValue, 0, &remaining) != 0 &&
+            errno != EAGAIN && errno != EINTR && errno != ETIMEDOUT) {
+            (void)__sync_sub_and_fetch(&data->iWaiters, 1);
+            return -1;
+        }
+        (void)__sync_sub_and_fetch(&data->iWaiters, 1);
+    }
+    return 1;
+}
+
+uint32_t OsSemaphoreClear(THandle aSem)
+{
+    SemaphoreData* data = (SemaphoreData*)aSem;
+    return (__sync_lock_test_and_set(&data->iValue, 0) > 0? 1 : 0);
+}
+
+int32_t OsSemaphoreSignal(THandle aSem)
+{
+    SemaphoreData* data = (SemaphoreData*)aSem;
+    (void)__sync_add_and_fetch(&data->iValue, 1);
+    if (data->iWaiters > 0) {
+        futexWake(&data->iValue, 1);
+    }
+    return 0;
+}
+
+#else /* !USE_FUTEX */
+
 static void getAbsTimespec(struct timespec* aTime, uint32_t aMsecs)
 {
     struct timeval now;
@@ -395,6 +514,8 @@ int32_t OsSemaphoreSignal(THandle aSem)
     return (status==0? 0 : -1);
 }
 
+#endif /* USE_FUTEX */
+
 THandle OsMutexCreate(const char* aName)
 {
     pthread_mutexattr_t attr;
@@ -545,22 +666,10 @@ int32_t OsThreadSupportsPriorities()
 typedef struct OsNetworkHandle
 {
     int32_t iSocket;
-    int32_t iPipe[2];
+    int32_t iInterruptFd[2]; /* [0] is polled, [1] is signalled.  Both refer to a single eventfd where available */
     int32_t iInterrupted;
 }OsNetworkHandle;
 
-static int nfds(const OsNetworkHandle* aHandle)
-{
-    int nfds = aHandle->iPipe[1];
-    if (aHandle->iPipe[0] > nfds) {
-        nfds = aHandle->iPipe[0];
-    }
-    if (aHandle->iSocket > nfds) {
-        nfds = aHandle->iSocket;
-    }
-    return nfds+1;
-}
-
 static void SetFdBlocking(int32_t aSocket)
 {
     uint32_t state = fcntl(aSocket, F_GETFL, 0);
@@ -575,6 +684,75 @@ static void SetFdNonBlocking(int32_t aSocket)
     fcntl(aSocket, F_SETFL, state);
 }
 
+static int32_t InterruptFdCreate(int32_t aFd[2])
+{
+#ifdef USE_EPOLL
+    int32_t fd = eventfd(0, EFD_NONBLOCK);
+    if (fd == -1) {
+        return -1;
+    }
+    aFd[0] = aFd[1] = fd;
+#else
+    if (pipe(aFd) == -1) {
+        return -1;
+    }
+    SetFdNonBlocking(aFd[0]);
+#endif
+    return 0;
+}
+
+static int32_t InterruptFdSignal(int32_t aFd[2])
+{
+    uint64_t val = 1; /* eventfd requires an 8 byte write */
+    if (TEMP_FAILURE_RETRY(write(aFd[1], &val, sizeof(val))) == -1) {
+        return -1;
+    }
+    return 0;
+}
+
+static void InterruptFdClear(int32_t aFd[2])
+{
+    uint64_t val;
+    while (TEMP_FAILURE_RETRY(read(aFd[0], &val, sizeof(val))) > 0) {
+        ;
+    }
+}
+
+static int32_t InterruptFdClose(int32_t aFd[2])
+{
+    int32_t err = TEMP_FAILURE_RETRY(close(aFd[0]));
+    if (aFd[1] != aFd[0]) {
+        err |= TEMP_FAILURE_RETRY(close(aFd[1]));
+    }
+    return err;
+}
+
+/**
+ * Block until aHandle's socket reports any of aEvents or the handle is interrupted.
+ * Uses poll() rather than select() so isn't limited to FD_SETSIZE descriptors.
+ *
+ * @return  1 if the socket is ready; 0 on timeout; -1 if interrupted or on error
+ */
+static int32_t SocketWait(const OsNetworkHandle* aHandle, short aEvents, int aTimeoutMs)
+{
+    struct pollfd fds[2];
+    int32_t ret;
+    fds[0].fd = aHandle->iSocket;
+    fds[0].events = aEvents;
+    fds[0].revents = 0;
+    fds[1].fd = aHandle->iInterruptFd[0];
+    fds[1].events = POLLIN;
+    fds[1].revents = 0;
+    ret = TEMP_FAILURE_RETRY(poll(fds, 2, aTimeoutMs));
+    if (ret <= 0) {
+        return ret;
+    }
+    if (fds[1].revents != 0 || fds[0].revents == 0) {
+        return -1;
+    }
+    return 1;
+}
+
 static int32_t SocketInterrupted(const OsNetworkHandle* aHandle)
 {
     int32_t interrupted;
@@ -602,13 +780,11 @@ static OsNetworkHandle* CreateHandle(int32_t aSocket)
     if (handle == NULL) {
         return kHandleNull;
     }
-    if (pipe(handle->iPipe) == -1) {
+    if (aSocket < 0 || InterruptFdCreate(handle->iInterruptFd) == -1) {
         free(handle);
         return kHandleNull;
     }
-    SetFdNonBlocking(handle->iPipe[0]);
     handle->iSocket = aSocket;
-    assert(aSocket >= 0 && aSocket < MAX_FILE_DESCRIPTOR);
     handle->iInterrupted = 0;
 
     return handle;
@@ -618,7 +794,7 @@ THandle OsNetworkCreate(OsNetworkSocketType aSocketType)
 {
     int32_t socketH = socket(2, aSocketType, 0);
     OsNetworkHandle* handle = CreateHandle(socketH);
-    if (handle == kHandleNull) {
+    if (handle == kHandleNull && socketH != -1) {
         TEMP_FAILURE_RETRY(close(socketH));
     }
     return (THandle)handle;
@@ -672,25 +848,50 @@ int32_t OsNetworkConnect(THandle aHandle, TIpAddress aAddress, uint16_t aPort, u
 
     struct sockaddr_in addr;
     sockaddrFromEndpoint(&addr, aAddress, aPort);
-    /* ignore err as we expect this to fail due to EINPROGRESS */
-    (void)connect(handle->iSocket, (struct sockaddr*)&addr, sizeof(addr));
-
-    fd_set read;
-    FD_ZERO(&read);
-    FD_SET(handle->iPipe[0], &read);
-    fd_set write;
-    FD_ZERO(&write);
-    FD_SET(handle->iSocket, &write);
-    fd_set error;
-    FD_ZERO(&error);
-    FD_SET(handle->iSocket, &error);
+    if (connect(handle->iSocket, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+        err = 0;
+    }
+    else if (errno == EINPROGRESS && SocketWait(handle, POLLOUT, (int)aTimeoutMs) > 0) {
+        int32_t sockErr = -1;
+        socklen_t len = sizeof(sockErr);
+        if (getsockopt(handle->iSocket, SOL_SOCKET, SO_ERROR, &sockErr, &len) == 0 && sockErr == 0) {
+            err = 0;
+        }
+    }
+    SetFdBlocking(handle->iSocket);
+    return err;
+}
 
-    struct timeval tv;
-    tv.tv_sec = aTimeoutMs / 1000;
-    tv.tv_usec = (aTimeoutMs % 1000) * 1000;
+int32_t OsNetworkConnectStart(THandle aHandle, TIpAddress aAddress, uint16_t aPort)
+{
+    OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
+    if (SocketInterrupted(handle)) {
+        return -1;
+    }
+
+    SetFdNonBlocking(handle->iSocket);
 
-    int32_t selectErr = TEMP_FAILURE_RETRY(select(nfds(handle), &read, &write, &error, &tv));
-    if (selectErr > 0 && FD_ISSET(handle->iSocket, &write)) {
+    struct sockaddr_in addr;
+    sockaddrFromEndpoint(&addr, aAddress, aPort);
+    if (connect(handle->iSocket, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+        SetFdBlocking(handle->iSocket);
+        return 0;
+    }
+    if (errno == EINPROGRESS) {
+        return 1; /* left non-blocking until OsNetworkConnectComplete() */
+    }
+    SetFdBlocking(handle->iSocket);
+    return -1;
+}
+
+int32_t OsNetworkConnectComplete(THandle aHandle)
+{
+    OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
+    int32_t err = -1;
+    int32_t sockErr = -1;
+    socklen_t len = sizeof(sockErr);
+    if (!SocketInterrupted(handle) &&
+        getsockopt(handle->iSocket, SOL_SOCKET, SO_ERROR, &sockErr, &len) == 0 && sockErr == 0) {
         err = 0;
     }
     SetFdBlocking(handle->iSocket);
@@ -715,6 +916,71 @@ int32_t OsNetworkSend(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes)
     return sent;
 }
 
+int32_t OsNetworkSendNonBlocking(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes)
+{
+    OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
+    if (SocketInterrupted(handle)) {
+        return -1;
+    }
+
+    int32_t sent = 0;
+    while (sent < (int32_t)aBytes) {
+        int32_t bytes = TEMP_FAILURE_RETRY(send(handle->iSocket, &aBuffer[sent], aBytes-sent, MSG_NOSIGNAL | MSG_DONTWAIT));
+        if (bytes == -1) {
+            if (errno==EWOULDBLOCK || errno==EAGAIN) {
+                break;
+            }
+            return -1;
+        }
+        sent += bytes;
+    }
+    return sent;
+}
+
+int32_t OsNetworkSendFile(THandle aHandle, int32_t aFile, uint64_t aOffset, uint32_t aBytes)
+{
+    OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
+    uint32_t sent = 0;
+    if (SocketInterrupted(handle)) {
+        return -1;
+    }
+
+#ifdef USE_SENDFILE
+    /* sendfile() has no equivalent of MSG_NOSIGNAL so block SIGPIPE for this thread,
+       discarding any raised by a send to a closed connection */
+    sigset_t pipeSet, oldSet;
+    off_t offset = (off_t)aOffset;
+    ssize_t bytes = 0;
+    sigemptyset(&pipeSet);
+    sigaddset(&pipeSet, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipeSet, &oldSet);
+    while (sent < aBytes) {
+        bytes = TEMP_FAILURE_RETRY(sendfile(handle->iSocket, aFile, &offset, aBytes - sent));
+        if (bytes <= 0) {
+            break;
+        }
+        sent += (uint32_t)bytes;
+    }
+    if (bytes == -1 && errno == EPIPE) {
+        struct timespec noWait = { 0, 0 };
+        (void)sigtimedwait(&pipeSet, NULL, &noWait);
+    }
+    pthread_sigmask(SIG_SETMASK, &oldSet, NULL);
+#else
+    uint8_t buf[16 * 1024];
+    while (sent < aBytes) {
+        size_t len = (aBytes - sent < sizeof(buf)? aBytes - sent : sizeof(buf));
+        ssize_t bytes = TEMP_FAILURE_RETRY(pread(aFile, buf, len, (off_t)(aOffset + sent)));
+        if (bytes <= 0 || OsNetworkSend(aHandle, buf, (uint32_t)bytes) != (int32_t)bytes) {
+            break;
+        }
+        sent += (uint32_t)bytes;
+    }
+#endif /* USE_SENDFILE */
+
+    return (sent > 0 || aBytes == 0? (int32_t)sent : -1);
+}
+
 int32_t OsNetworkSendTo(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes, TIpAddress aAddress, uint16_t aPort)
 {
     OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
@@ -740,25 +1006,14 @@ int32_t OsNetworkReceive(THandle aHandle, uint8_t* aBuffer, uint32_t aBytes)
     if (SocketInterrupted(handle)) {
         return -1;
     }
-    SetFdNonBlocking(handle->iSocket);
 
-    fd_set read;
-    FD_ZERO(&read);
-    FD_SET(handle->iPipe[0], &read);
-    FD_SET(handle->iSocket, &read);
-    fd_set error;
-    FD_ZERO(&error);
-    FD_SET(handle->iSocket, &error);
-
-    int32_t received = TEMP_FAILURE_RETRY(recv(handle->iSocket, aBuffer, aBytes, MSG_NOSIGNAL));
-    if (received==-1 && errno==EWOULDBLOCK) {
-        int32_t selectErr = TEMP_FAILURE_RETRY(select(nfds(handle), &read, NULL, &error, NULL));
-        if (selectErr > 0 && FD_ISSET(handle->iSocket, &read)) {
-            received = TEMP_FAILURE_RETRY(recv(handle->iSocket, aBuffer, aBytes, MSG_NOSIGNAL));
+    /* MSG_DONTWAIT avoids toggling O_NONBLOCK on the socket for every call */
+    int32_t received = TEMP_FAILURE_RETRY(recv(handle->iSocket, aBuffer, aBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
+    if (received==-1 && (errno==EWOULDBLOCK || errno==EAGAIN)) {
+        if (SocketWait(handle, POLLIN, -1) > 0) {
+            received = TEMP_FAILURE_RETRY(recv(handle->iSocket, aBuffer, aBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
         }
     }
-
-    SetFdBlocking(handle->iSocket);
     return received;
 }
 
@@ -772,24 +1027,12 @@ int32_t OsNetworkReceiveFrom(THandle aHandle, uint8_t* aBuffer, uint32_t aBytes,
     sockaddrFromEndpoint(&addr, 0, 0);
     socklen_t addrLen = sizeof(addr);
 
-    SetFdNonBlocking(handle->iSocket);
-
-    fd_set read;
-    FD_ZERO(&read);
-    FD_SET(handle->iPipe[0], &read);
-    FD_SET(handle->iSocket, &read);
-    fd_set error;
-    FD_ZERO(&error);
-    FD_SET(handle->iSocket, &error);
-
-    int32_t received = TEMP_FAILURE_RETRY(recvfrom(handle->iSocket, aBuffer, aBytes, MSG_NOSIGNAL, (struct sockaddr*)&addr, &addrLen));
-    if (received==-1 && errno==EWOULDBLOCK) {
-        int32_t selectErr = TEMP_FAILURE_RETRY(select(nfds(handle), &read, NULL, &error, NULL));
-        if (selectErr > 0 && FD_ISSET(handle->iSocket, &read)) {
-            received = TEMP_FAILURE_RETRY(recvfrom(handle->iSocket, aBuffer, aBytes, MSG_NOSIGNAL, (struct sockaddr*)&addr, &addrLen));
+    int32_t received = TEMP_FAILURE_RETRY(recvfrom(handle->iSocket, aBuffer, aBytes, MSG_NOSIGNAL | MSG_DONTWAIT, (struct sockaddr*)&addr, &addrLen));
+    if (received==-1 && (errno==EWOULDBLOCK || errno==EAGAIN)) {
+        if (SocketWait(handle, POLLIN, -1) > 0) {
+            received = TEMP_FAILURE_RETRY(recvfrom(handle->iSocket, aBuffer, aBytes, MSG_NOSIGNAL | MSG_DONTWAIT, (struct sockaddr*)&addr, &addrLen));
         }
     }
-    SetFdBlocking(handle->iSocket);
     *aAddress = addr.sin_addr.s_addr;
     *aPort = SwapEndian16(addr.sin_port);
     return received;
@@ -801,16 +1044,11 @@ int32_t OsNetworkInterrupt(THandle aHandle, int32_t aInterrupt)
     OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
     OsMutexLock(gMutex);
     handle->iInterrupted = aInterrupt;
-    int32_t val = 1;
     if (aInterrupt != 0) {
-        if (TEMP_FAILURE_RETRY(write(handle->iPipe[1], &val, sizeof(val))) == -1) {
-            err = -1;
-        }
+        err = InterruptFdSignal(handle->iInterruptFd);
     }
     else {
-        while (TEMP_FAILURE_RETRY(read(handle->iPipe[0], &val, sizeof(val))) > 0) {
-            ;
-        }
+        InterruptFdClear(handle->iInterruptFd);
     }
     OsMutexUnlock(gMutex);
     return err;
@@ -822,8 +1060,7 @@ int32_t OsNetworkClose(THandle aHandle)
     int32_t err = 0;
     if (handle != NULL) {
         err  = TEMP_FAILURE_RETRY(close(handle->iSocket));
-        err |= TEMP_FAILURE_RETRY(close(handle->iPipe[0]));
-        err |= TEMP_FAILURE_RETRY(close(handle->iPipe[1]));
+        err |= InterruptFdClose(handle->iInterruptFd);
         free(handle);
     }
     return err;
@@ -836,9 +1073,28 @@ int32_t OsNetworkListen(THandle aHandle, uint32_t aSlots)
         return -1;
     }
     int32_t err = listen(handle->iSocket, aSlots);
+    if (err == 0) {
+        /* listening sockets are only ever used for accept() so can stay non-blocking */
+        SetFdNonBlocking(handle->iSocket);
+    }
     return err;
 }
 
+static THandle HandleFromAccepted(int32_t aSocket)
+{
+#ifdef PLATFORM_MACOSX_GNU
+    /* BSD derived systems let accepted sockets inherit O_NONBLOCK from the listener */
+    SetFdBlocking(aSocket);
+#endif /* PLATFORM_MACOSX_GNU */
+
+    OsNetworkHandle* newHandle = CreateHandle(aSocket);
+    if (newHandle == NULL) {
+        close(aSocket);
+        return kHandleNull;
+    }
+    return (THandle)newHandle;
+}
+
 THandle OsNetworkAccept(THandle aHandle)
 {
     OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
@@ -849,35 +1105,190 @@ THandle OsNetworkAccept(THandle aHandle)
     sockaddrFromEndpoint(&addr, 0, 0);
     socklen_t len = sizeof(addr);
 
-    SetFdNonBlocking(handle->iSocket);
-
-    fd_set read;
-    FD_ZERO(&read);
-    FD_SET(handle->iPipe[0], &read);
-    FD_SET(handle->iSocket, &read);
-    fd_set error;
-    FD_ZERO(&error);
-    FD_SET(handle->iSocket, &error);
-
     int32_t h = TEMP_FAILURE_RETRY(accept(handle->iSocket, (struct sockaddr*)&addr, &len));
-    if (h==-1 && errno==EWOULDBLOCK) {
-        int32_t selectErr = TEMP_FAILURE_RETRY(select(nfds(handle), &read, NULL, &error, NULL));
-        if (selectErr > 0 && FD_ISSET(handle->iSocket, &read)) {
+    if (h==-1 && (errno==EWOULDBLOCK || errno==EAGAIN)) {
+        if (SocketWait(handle, POLLIN, -1) > 0) {
             h = TEMP_FAILURE_RETRY(accept(handle->iSocket, (struct sockaddr*)&addr, &len));
         }
     }
-    SetFdBlocking(handle->iSocket);
     if (h == -1) {
         return kHandleNull;
     }
+    return HandleFromAccepted(h);
+}
 
-    OsNetworkHandle* newHandle = CreateHandle(h);
-    if (newHandle == NULL) {
-        close(h);
+int32_t OsNetworkAcceptNonBlocking(THandle aHandle, THandle* aAccepted)
+{
+    OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
+    if (SocketInterrupted(handle)) {
+        return -1;
+    }
+    struct sockaddr_in addr;
+    sockaddrFromEndpoint(&addr, 0, 0);
+    socklen_t len = sizeof(addr);
+
+    /* the listening socket is non-blocking (see OsNetworkListen) */
+    int32_t h = TEMP_FAILURE_RETRY(accept(handle->iSocket, (struct sockaddr*)&addr, &len));
+    if (h == -1) {
+        /* ECONNABORTED means the connection we were woken for was reset before we accepted it */
+        return ((errno==EWOULDBLOCK || errno==EAGAIN || errno==ECONNABORTED)? 1 : -1);
+    }
+    THandle accepted = HandleFromAccepted(h);
+    if (accepted == kHandleNull) {
+        return -1;
+    }
+    *aAccepted = accepted;
+    return 0;
+}
+
+typedef struct OsNetworkReactor
+{
+    int32_t iEpoll;
+    int32_t iInterruptFd[2];
+}OsNetworkReactor;
+
+#ifdef USE_EPOLL
+static uint32_t EpollEventsFromReadiness(uint32_t aReadiness)
+{
+    uint32_t events = EPOLLONESHOT;
+    if (aReadiness & eOsNetworkReadable) {
+        events |= EPOLLIN;
+    }
+    if (aReadiness & eOsNetworkWritable) {
+        events |= EPOLLOUT;
+    }
+    return events;
+}
+
+static int32_t ReactorControl(THandle aReactor, int aOp, THandle aHandle, uint32_t aReadiness, void* aArg)
+{
+    OsNetworkReactor* reactor = (OsNetworkReactor*)aReactor;
+    OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EpollEventsFromReadiness(aReadiness);
+    ev.data.ptr = aArg;
+    return (epoll_ctl(reactor->iEpoll, aOp, handle->iSocket, &ev) == 0? 0 : -1);
+}
+#endif /* USE_EPOLL */
+
+THandle OsNetworkReactorCreate()
+{
+#ifdef USE_EPOLL
+    struct epoll_event ev;
+    OsNetworkReactor* reactor = (OsNetworkReactor*)malloc(sizeof(OsNetworkReactor));
+    if (reactor == NULL) {
         return kHandleNull;
     }
+    reactor->iEpoll = epoll_create1(0);
+    if (reactor->iEpoll == -1) {
+        free(reactor);
+        return kHandleNull;
+    }
+    if (InterruptFdCreate(reactor->iInterruptFd) == -1) {
+        TEMP_FAILURE_RETRY(close(reactor->iEpoll));
+        free(reactor);
+        return kHandleNull;
+    }
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = reactor; /* never a valid client arg so identifies interrupts */
+    if (epoll_ctl(reactor->iEpoll, EPOLL_CTL_ADD, reactor->iInterruptFd[0], &ev) != 0) {
+        OsNetworkReactorDestroy(reactor);
+        return kHandleNull;
+    }
+    return (THandle)reactor;
+#else
+    return kHandleNull;
+#endif /* USE_EPOLL */
+}
 
-    return (THandle)newHandle;
+void OsNetworkReactorDestroy(THandle aReactor)
+{
+    OsNetworkReactor* reactor = (OsNetworkReactor*)aReactor;
+    if (reactor == kHandleNull) {
+        return;
+    }
+    TEMP_FAILURE_RETRY(close(reactor->iEpoll));
+    InterruptFdClose(reactor->iInterruptFd);
+    free(reactor);
+}
+
+int32_t OsNetworkReactorAdd(THandle aReactor, THandle aHandle, uint32_t aReadiness, void* aArg)
+{
+#ifdef USE_EPOLL
+    return ReactorControl(aReactor, EPOLL_CTL_ADD, aHandle, aReadiness, aArg);
+#else
+    return -1;
+#endif /* USE_EPOLL */
+}
+
+int32_t OsNetworkReactorRearm(THandle aReactor, THandle aHandle, uint32_t aReadiness, void* aArg)
+{
+#ifdef USE_EPOLL
+    return ReactorControl(aReactor, EPOLL_CTL_MOD, aHandle, aReadiness, aArg);
+#else
+    return -1;
+#endif /* USE_EPOLL */
+}
+
+int32_t OsNetworkReactorRemove(THandle aReactor, THandle aHandle)
+{
+#ifdef USE_EPOLL
+    OsNetworkReactor* reactor = (OsNetworkReactor*)aReactor;
+    OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
+    struct epoll_event ev; /* ignored but must be non-NULL for pre-2.6.9 kernels */
+    return (epoll_ctl(reactor->iEpoll, EPOLL_CTL_DEL, handle->iSocket, &ev) == 0? 0 : -1);
+#else
+    return -1;
+#endif /* USE_EPOLL */
+}
+
+int32_t OsNetworkReactorWait(THandle aReactor, OsNetworkReactorEvent* aEvents, uint32_t aMaxEvents, uint32_t aTimeoutMs)
+{
+#ifdef USE_EPOLL
+# define kMaxEpollEvents 64
+    OsNetworkReactor* reactor = (OsNetworkReactor*)aReactor;
+    struct epoll_event events[kMaxEpollEvents];
+    int timeout = (aTimeoutMs == 0? -1 : (int)aTimeoutMs);
+    int32_t count = 0;
+    int32_t i;
+    int32_t ret;
+    if (aMaxEvents > kMaxEpollEvents) {
+        aMaxEvents = kMaxEpollEvents;
+    }
+    ret = epoll_wait(reactor->iEpoll, events, (int)aMaxEvents, timeout);
+    if (ret == -1) {
+        return (errno == EINTR? 0 : -1);
+    }
+    for (i=0; i<ret; i++) {
+        if (events[i].data.ptr == reactor) {
+            InterruptFdClear(reactor->iInterruptFd);
+            continue;
+        }
+        aEvents[count].iArg = events[i].data.ptr;
+        aEvents[count].iReadiness = 0;
+        if (events[i].events & EPOLLIN) {
+            aEvents[count].iReadiness |= eOsNetworkReadable;
+        }
+        if (events[i].events & EPOLLOUT) {
+            aEvents[count].iReadiness |= eOsNetworkWritable;
+        }
+        if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+            aEvents[count].iReadiness |= eOsNetworkHangup;
+        }
+        count++;
+    }
+    return count;
+#else
+    return -1;
+#endif /* USE_EPOLL */
+}
+
+int32_t OsNetworkReactorInterrupt(THandle aReactor)
+{
+    OsNetworkReactor* reactor = (OsNetworkReactor*)aReactor;
+    return InterruptFdSignal(reactor->iInterruptFd);
 }
 
 int32_t OsNetworkGetHostByName(const char* aAddress, TIpAddress* aHost)
@@ -1204,23 +1615,14 @@ void adapterChangeObserverThread(void* aPtr)
     OsNetworkHandle *handle = observer->netHnd;
     char buffer[4096];
     struct nlmsghdr *nlh;
-    int32_t len, ret;
-    fd_set rfds,errfds;
+    int32_t len;
 
     while (1) {
         if (SocketInterrupted(handle)) {
             return;
         }
 
-        FD_ZERO(&rfds);
-        FD_SET(handle->iPipe[0], &rfds);
-        FD_SET(handle->iSocket, &rfds);
-
-        FD_ZERO(&errfds);
-        FD_SET(handle->iSocket, &errfds);
-
-        ret = TEMP_FAILURE_RETRY(select(nfds(handle), &rfds, NULL, &errfds, NULL));
-        if ((ret > 0) && FD_ISSET(handle->iSocket, &rfds)) {
+        if (SocketWait(handle, POLLIN, -1) > 0) {
             nlh = (struct nlmsghdr *) buffer;
             if ((len = recv(handle->iSocket, nlh, 4096, 0)) > 0) {
                 while (NLMSG_OK(nlh, len) && (nlh->nlmsg_type != NLMSG_DONE)) {
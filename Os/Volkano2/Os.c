@@ -630,6 +630,12 @@ int32_t OsNetworkSend(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes)
     return bytes;
 }
 
+int32_t OsNetworkSendFile(THandle aHandle, int32_t aFile, uint64_t aOffset, uint32_t aBytes)
+{
+    /* no filesystem */
+    return -1;
+}
+
 int32_t OsNetworkSendTo(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes, TIpAddress aAddress, uint16_t aPort )
 {
     if ( OsNetworkHandle_IsInterrupted(aHandle) )
@@ -765,6 +771,89 @@ int32_t OsNetworkListen(THandle aHandle, uint32_t aSlots)
     return result;
 }
 
+int32_t OsNetworkAcceptNonBlocking(THandle aHandle, THandle* aAccepted)
+{
+    /* only required by reactor clients, which are unsupported here */
+    aHandle = aHandle;
+    aAccepted = aAccepted;
+    return -1;
+}
+
+int32_t OsNetworkSendNonBlocking(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes)
+{
+    /* only required by reactor clients, which are unsupported here */
+    aHandle = aHandle;
+    aBuffer = aBuffer;
+    aBytes = aBytes;
+    return -1;
+}
+
+int32_t OsNetworkConnectStart(THandle aHandle, TIpAddress aAddress, uint16_t aPort)
+{
+    /* only required by reactor clients, which are unsupported here */
+    aHandle = aHandle;
+    aAddress = aAddress;
+    aPort = aPort;
+    return -1;
+}
+
+int32_t OsNetworkConnectComplete(THandle aHandle)
+{
+    aHandle = aHandle;
+    return -1;
+}
+
+THandle OsNetworkReactorCreate()
+{
+    /* reactors are optional; callers fall back to a thread per socket */
+    return kHandleNull;
+}
+
+void OsNetworkReactorDestroy(THandle aReactor)
+{
+    aReactor = aReactor;
+}
+
+int32_t OsNetworkReactorAdd(THandle aReactor, THandle aHandle, uint32_t aReadiness, void* aArg)
+{
+    aReactor = aReactor;
+    aHandle = aHandle;
+    aReadiness = aReadiness;
+    aArg = aArg;
+    return -1;
+}
+
+int32_t OsNetworkReactorRearm(THandle aReactor, THandle aHandle, uint32_t aReadiness, void* aArg)
+{
+    aReactor = aReactor;
+    aHandle = aHandle;
+    aReadiness = aReadiness;
+    aArg = aArg;
+    return -1;
+}
+
+int32_t OsNetworkReactorRemove(THandle aReactor, THandle aHandle)
+{
+    aReactor = aReactor;
+    aHandle = aHandle;
+    return -1;
+}
+
+int32_t OsNetworkReactorWait(THandle aReactor, OsNetworkReactorEvent* aEvents, uint32_t aMaxEvents, uint32_t aTimeoutMs)
+{
+    aReactor = aReactor;
+    aEvents = aEvents;
+    aMaxEvents = aMaxEvents;
+    aTimeoutMs = aTimeoutMs;
+    return -1;
+}
+
+int32_t OsNetworkReactorInterrupt(THandle aReactor)
+{
+    aReactor = aReactor;
+    return -1;
+}
+
 int32_t OsNetworkGetHostByName(const char* aAddress, TIpAddress* aHost)
 {
     struct hostent ret;
@@ -10,6 +10,7 @@
 #include <Ws2tcpip.h>
 #include <Iphlpapi.h>
 #include <Dbghelp.h>
+#include <io.h>
 
 static const uint32_t kMinStackBytes = 1024 * 16;
 static const uint32_t kStackPaddingBytes = 1024 * 16;
@@ -554,6 +555,28 @@ int32_t OsNetworkSend(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes)
     return sent;
 }
 
+int32_t OsNetworkSendFile(THandle aHandle, int32_t aFile, uint64_t aOffset, uint32_t aBytes)
+{
+    uint8_t buf[16 * 1024];
+    uint32_t sent = 0;
+    OsNetworkHandle* handle = (OsNetworkHandle*)aHandle;
+    if (SocketInterrupted(handle)) {
+        return -1;
+    }
+    if (_lseeki64(aFile, (__int64)aOffset, SEEK_SET) == -1) {
+        return -1;
+    }
+    while (sent < aBytes) {
+        uint32_t len = (aBytes - sent < sizeof(buf)? aBytes - sent : sizeof(buf));
+        int bytes = _read(aFile, buf, len);
+        if (bytes <= 0 || OsNetworkSend(aHandle, buf, (uint32_t)bytes) != bytes) {
+            break;
+        }
+        sent += (uint32_t)bytes;
+    }
+    return (sent > 0 || aBytes == 0? (int32_t)sent : -1);
+}
+
 int32_t OsNetworkSendTo(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes, TIpAddress aAddress, uint16_t aPort)
 {
     int32_t sent = 0;
@@ -733,6 +756,89 @@ THandle OsNetworkAccept(THandle aHandle)
     return (THandle)newHandle;
 }
 
+int32_t OsNetworkAcceptNonBlocking(THandle aHandle, THandle* aAccepted)
+{
+    /* only required by reactor clients, which are unsupported here */
+    aHandle = aHandle;
+    aAccepted = aAccepted;
+    return -1;
+}
+
+int32_t OsNetworkSendNonBlocking(THandle aHandle, const uint8_t* aBuffer, uint32_t aBytes)
+{
+    /* only required by reactor clients, which are unsupported here */
+    aHandle = aHandle;
+    aBuffer = aBuffer;
+    aBytes = aBytes;
+    return -1;
+}
+
+int32_t OsNetworkConnectStart(THandle aHandle, TIpAddress aAddress, uint16_t aPort)
+{
+    /* only required by reactor clients, which are unsupported here */
+    aHandle = aHandle;
+    aAddress = aAddress;
+    aPort = aPort;
+    return -1;
+}
+
+int32_t OsNetworkConnectComplete(THandle aHandle)
+{
+    aHandle = aHandle;
+    return -1;
+}
+
+THandle OsNetworkReactorCreate()
+{
+    /* reactors are optional; callers fall back to a thread per socket */
+    return kHandleNull;
+}
+
+void OsNetworkReactorDestroy(THandle aReactor)
+{
+    aReactor = aReactor;
+}
+
+int32_t OsNetworkReactorAdd(THandle aReactor, THandle aHandle, uint32_t aReadiness, void* aArg)
+{
+    aReactor = aReactor;
+    aHandle = aHandle;
+    aReadiness = aReadiness;
+    aArg = aArg;
+    return -1;
+}
+
+int32_t OsNetworkReactorRearm(THandle aReactor, THandle aHandle, uint32_t aReadiness, void* aArg)
+{
+    aReactor = aReactor;
+    aHandle = aHandle;
+    aReadiness = aReadiness;
+    aArg = aArg;
+    return -1;
+}
+
+int32_t OsNetworkReactorRemove(THandle aReactor, THandle aHandle)
+{
+    aReactor = aReactor;
+    aHandle = aHandle;
+    return -1;
+}
+
+int32_t OsNetworkReactorWait(THandle aReactor, OsNetworkReactorEvent* aEvents, uint32_t aMaxEvents, uint32_t aTimeoutMs)
+{
+    aReactor = aReactor;
+    aEvents = aEvents;
+    aMaxEvents = aMaxEvents;
+    aTimeoutMs = aTimeoutMs;
+    return -1;
+}
+
+int32_t OsNetworkReactorInterrupt(THandle aReactor)
+{
+    aReactor = aReactor;
+    return -1;
+}
+
 int32_t OsNetworkGetHostByName(const char* aAddress, TIpAddress* aHost)
 {
     int32_t ret = 0;